@@ -0,0 +1,68 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+// nau/async/activity_counter.h
+
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+
+#include "nau/kernel/kernel_config.h"
+
+namespace nau::async
+{
+    /**
+        @brief Counts pending works and wakes up the waiting threads when the count drops to zero.
+
+        The counter itself is lock free: the mutex is touched only by the waiters and by the thread that completes the last work
+        while someone is actually waiting.
+     */
+    class NAU_KERNEL_EXPORT ActivityCounter
+    {
+    public:
+        ActivityCounter() = default;
+        ActivityCounter(const ActivityCounter&) = delete;
+        ActivityCounter& operator=(const ActivityCounter&) = delete;
+
+        ~ActivityCounter();
+
+        /**
+            @brief Registers new pending work.
+        */
+        void increment() noexcept;
+
+        /**
+            @brief Marks one pending work as completed. Notifies the waiters if it was the last one.
+        */
+        void decrement() noexcept;
+
+        /**
+            @brief Returns the count of pending works.
+        */
+        size_t getCount() const noexcept;
+
+        /**
+            @brief Returns total count of works registered with increment().
+        */
+        uint64_t getTotalCount() const noexcept;
+
+        /**
+            @brief Blocks the current thread until there are no pending works.
+            @param[in] timeout wait timeout. Waits infinitely if not specified.
+            @returns true if there are no pending works; otherwise (timeout expired), false.
+        */
+        bool wait(std::optional<std::chrono::milliseconds> timeout = std::nullopt) noexcept;
+
+    private:
+        std::atomic_size_t m_counter = 0;
+        std::atomic_uint64_t m_totalCounter = 0;
+        std::atomic_size_t m_waitersCount = 0;
+        std::mutex m_mutex;
+        std::condition_variable m_signal;
+    };
+
+}  // namespace nau::async
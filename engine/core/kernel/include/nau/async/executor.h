@@ -5,6 +5,7 @@
 #pragma once
 #include <EASTL/span.h>
 
+#include <chrono>
 #include <thread>
 #include <type_traits>
 
@@ -19,6 +20,25 @@
 
 namespace nau::async
 {
+    /**
+        @brief Executor's activity snapshot.
+     */
+    struct ExecutorStatistics
+    {
+        size_t threadsCount = 0;
+
+        // Invocations scheduled since the executor creation.
+        uint64_t scheduledCount = 0;
+
+        // Invocations scheduled but not yet completed.
+        size_t pendingCount = 0;
+
+        // Time the executor's threads spent waiting for the work, summed over all threads.
+        std::chrono::nanoseconds idleTime{0};
+
+        // Time the executor's threads spent outside of the waiting for the work, summed over all threads.
+        std::chrono::nanoseconds busyTime{0};
+    };
 
     /**
      */
@@ -68,6 +88,12 @@ namespace nau::async
 
             void operator()();
 
+            /**
+                @brief Releases the stored callback and its data without invoking it.
+                Used by executors that keep invocations in lock-free storage: the released parts must be put back with Invocation{callback, data1, data2}.
+             */
+            void release(Callback& callback, void*& data1, void*& data2);
+
         private:
             void reset();
 
@@ -118,6 +144,18 @@ namespace nau::async
 
         virtual void waitAnyActivity() noexcept = 0;
 
+        /**
+            @brief Blocks the current thread until the executor has no pending invocations or the timeout expires.
+            The default implementation is for executors that are not able to wait for their activity: it just calls waitAnyActivity().
+            @returns true if the executor has no pending invocations; otherwise, false.
+        */
+        NAU_KERNEL_EXPORT virtual bool waitAnyActivityFor(std::chrono::milliseconds timeout) noexcept;
+
+        /**
+            @brief Returns the executor's activity snapshot. Default implementation returns empty statistics.
+        */
+        NAU_KERNEL_EXPORT virtual ExecutorStatistics getStatistics() const noexcept;
+
     protected:
         NAU_KERNEL_EXPORT static void invoke(Executor&, Invocation) noexcept;
 
@@ -0,0 +1,86 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+// nau/async/parallel_for.h
+
+
+#pragma once
+
+#include <atomic>
+#include <limits>
+#include <type_traits>
+
+#include "nau/async/executor.h"
+#include "nau/kernel/kernel_config.h"
+#include "nau/threading/event.h"
+
+namespace nau::async
+{
+    /**
+        @brief Processes the chunks of the work both by the calling thread and by the executor's threads (helpers).
+
+        The chunks are taken from the shared counter, so a slow helper does not hold back the others.
+        run() blocks until all the chunks are processed. The helpers are used only when the executor has threads
+        and there is more than one chunk, otherwise all the chunks are processed by the calling thread in order.
+
+        The calling thread waits for the helpers: when it is one of the executor's threads, the helpers are not used
+        and the chunks are processed inline (the wait could deadlock the executor).
+     */
+    class NAU_KERNEL_EXPORT ParallelFor
+    {
+    public:
+        /**
+            @brief Processes a single chunk. workerIndex is 0 for the calling thread and [1, getWorkersCount()) for the helpers:
+            it can be used to select the per-thread scratch data.
+         */
+        using ChunkCallback = void (*)(void* data, size_t chunk, size_t workerIndex) noexcept;
+
+        /**
+            @param executor Executor providing the helpers, can be nullptr.
+            @param chunksCount Count of the chunks to process.
+            @param maxHelpersCount Limits the count of the helpers (e.g. 0 when the work is too small to be split).
+         */
+        ParallelFor(Executor* executor, size_t chunksCount, size_t maxHelpersCount = std::numeric_limits<size_t>::max());
+
+        ParallelFor(const ParallelFor&) = delete;
+        ParallelFor& operator=(const ParallelFor&) = delete;
+
+        /**
+            @brief Count of the threads processing the chunks: the helpers and the calling thread.
+         */
+        size_t getWorkersCount() const;
+
+        /**
+            @brief Processes all the chunks. Can be called only once.
+            @param helpersCompleted Signaled by the last finished helper. It must outlive the call and is usually kept by the caller as a member:
+                   the calling thread can be released while the last helper is still inside Event::set().
+         */
+        void run(ChunkCallback callback, void* data, threading::Event& helpersCompleted);
+
+        /**
+            @brief Processes all the chunks with chunkFunc(size_t chunk, size_t workerIndex).
+         */
+        template <typename F>
+            requires(std::is_invocable_v<F&, size_t, size_t>)
+        void run(F&& chunkFunc, threading::Event& helpersCompleted)
+        {
+            run([](void* data, size_t chunk, size_t workerIndex) noexcept
+            {
+                (*reinterpret_cast<std::remove_reference_t<F>*>(data))(chunk, workerIndex);
+            }, &chunkFunc, helpersCompleted);
+        }
+
+    private:
+        void processChunks(size_t workerIndex);
+
+        Executor* const m_executor;
+        const size_t m_chunksCount;
+        const size_t m_helpersCount;
+
+        ChunkCallback m_callback = nullptr;
+        void* m_data = nullptr;
+        threading::Event* m_helpersCompleted = nullptr;
+
+        std::atomic<size_t> m_nextChunk = 0;
+        std::atomic<size_t> m_pendingHelpers = 0;
+    };
+}  // namespace nau::async
@@ -13,6 +13,15 @@ namespace nau::async
 {
     NAU_KERNEL_EXPORT Executor::Ptr createThreadPoolExecutor(std::optional<size_t> threadsCount = std::nullopt);
 
+    /**
+        @brief Creates the thread pool with per-worker work stealing deques.
+
+        Invocations scheduled from the pool's own worker (coroutine continuations) go to that worker's deque and are executed in LIFO order,
+        idle workers steal the oldest invocations from the others. Invocations scheduled from the outside threads go through the shared FIFO queue.
+        By default the pool takes all available cores except one.
+     */
+    NAU_KERNEL_EXPORT Executor::Ptr createWorkStealingThreadPoolExecutor(std::optional<size_t> threadsCount = std::nullopt);
+
     // NAU_KERNEL_EXPORT Executor::Ptr createDagThreadPoolExecutor(bool initCpuJobs, std::optional<size_t> threadsCount = std::nullopt);
 
 }  // namespace nau::async
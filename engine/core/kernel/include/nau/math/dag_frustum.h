@@ -48,6 +48,12 @@ namespace nau::math
 
         inline int testSphere(const BSphere3& sphere) const { return testSphere(sphere.c, Vector4{ sphere.r }); }
 
+        // tests a batch of spheres stored as separate coordinate arrays (4 spheres per SIMD iteration)
+        // bit (i % 32) of visibilityBits[i / 32] is set when the sphere i is at least partially visible,
+        // the bits above count in the last word are cleared. Same result as testSphereB() for each sphere.
+        void testSpheresB(const float* centerX, const float* centerY, const float* centerZ, const float* radius,
+                          size_t count, uint32_t* visibilityBits) const;
+
 
         Vector4 camPlanes[6];
         Vector4 plane03X, plane03Y, plane03Z, plane03W2, plane03W, plane4W2, plane5W2;
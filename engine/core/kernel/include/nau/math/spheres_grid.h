@@ -0,0 +1,107 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/unordered_map.h>
+
+#include "nau/math/dag_frustum.h"
+#include "nau/memory/eastl_aliases.h"
+
+namespace nau::math
+{
+    /**
+        @brief Loose uniform grid of the bounding spheres (e.g. dynamic lights) used for the hierarchical frustum culling.
+
+        The sphere is kept in the cell containing its center, the cell bounds are grown by the largest radius of its spheres.
+        The grid is updated incrementally: moving a sphere within its cell only updates its coordinates,
+        crossing the cell border touches the two involved cells only.
+
+        The culling tests the cell bounds first (batched SIMD test), the cells that are completely inside the frustum
+        accept all of their spheres and only the spheres of the intersected cells are tested one by one (batched as well).
+        The result is conservative in the same way as NauFrustum::testSphereB.
+    */
+    class NAU_KERNEL_EXPORT SpheresGrid
+    {
+    public:
+        explicit SpheresGrid(float cellSize = 32.f);
+
+        /**
+            @brief Adds the sphere with the given id or updates its bounds.
+
+            The ids are expected to be dense (e.g. light indices), a non-positive radius removes the sphere.
+        */
+        void update(uint32_t id, const Vector3& center, float radius);
+
+        void remove(uint32_t id);
+
+        void clear();
+
+        /**
+            @brief Marks the visible spheres in the bit set indexed by the sphere id (bit (id % 32) of visibilityBits[id / 32]).
+
+            The bit set is cleared first; the ids that do not fit into wordCount words are skipped.
+            @returns Count of the visible spheres.
+        */
+        size_t cull(const NauFrustum& frustum, uint32_t* visibilityBits, size_t wordCount) const;
+
+        size_t getSpheresCount() const
+        {
+            return m_spheresCount;
+        }
+
+        size_t getCellsCount() const
+        {
+            return m_cells.size();
+        }
+
+        float getCellSize() const
+        {
+            return m_cellSize;
+        }
+
+    private:
+        static constexpr uint32_t InvalidCell = ~0u;
+
+        struct Cell
+        {
+            uint64_t key = 0;
+            float maxRadius = 0.f;
+            nau::Vector<uint32_t> ids;
+            nau::Vector<float> centerX;
+            nau::Vector<float> centerY;
+            nau::Vector<float> centerZ;
+            nau::Vector<float> radius;
+        };
+
+        struct Location
+        {
+            uint32_t cell = InvalidCell;
+            uint32_t slot = 0;
+        };
+
+        uint64_t getCellKey(const Vector3& center) const;
+        uint32_t getOrAddCell(uint64_t key);
+
+        void removeFromCell(Location& location);
+        void removeCell(uint32_t cellIndex);
+        void updateCellBounds(uint32_t cellIndex);
+
+        const float m_cellSize;
+        const float m_invCellSize;
+        // distance from the cell center to its corner
+        const float m_cellHalfDiagonal;
+
+        nau::Vector<Cell> m_cells;
+        eastl::unordered_map<uint64_t, uint32_t> m_cellIndices;
+        nau::Vector<Location> m_locations;
+        size_t m_spheresCount = 0;
+
+        // cells bounding spheres (parallel to m_cells)
+        nau::Vector<float> m_cellCenterX;
+        nau::Vector<float> m_cellCenterY;
+        nau::Vector<float> m_cellCenterZ;
+        nau::Vector<float> m_cellRadius;
+    };
+}  // namespace nau::math
@@ -8,6 +8,8 @@
 #pragma once
 
 
+#include <atomic>
+#include <bit>
 #include <type_traits>
 #include "nau/memory/heap_allocator.h"
 #include "nau/memory/mem_allocator.h"
@@ -35,6 +37,11 @@ namespace nau
      * and improves performance, especially in multithreaded environments. 
      * By reusing memory blocks and maintaining thread-local free lists, 
      * it provides a robust solution for fixed-size memory allocation needs.
+     *
+     * Blocks are carved from slabs aligned to their size, each slab starts with the header that refers to the owning thread segment.
+     * A block freed by the owning thread goes to its local free list. A block freed by any other thread is pushed to the owner's
+     * lock-free remote free list, which the owner takes back when its local free list runs dry.
+     * So the memory does not migrate between threads in producer/consumer scenarios.
      * 
      * @tparam BlockSize The size of each block to be allocated.
      */
@@ -43,6 +50,57 @@ namespace nau
     class FixedBlocksAllocator final : public IAlignedAllocatorDebug
     {
     public:
+        /**
+         * @brief Usage and cross-thread traffic counters aggregated over all thread segments.
+         */
+        struct Statistics
+        {
+            /**
+             * @brief Count of blocks deallocated by a thread other than the owner of the block.
+             */
+            uint64_t crossThreadFrees = 0;
+
+            /**
+             * @brief How many times the owning threads took back the blocks freed by the other threads.
+             */
+            uint64_t remoteFreeDrains = 0;
+
+            /**
+             * @brief Count of blocks currently allocated.
+             */
+            size_t liveBlocks = 0;
+
+            /**
+             * @brief High-water mark of the allocated blocks count.
+             * Threads publish their usage in batches of PeakSyncBlocks, so a short peak can be missed by up to that many blocks per thread.
+             */
+            size_t peakBlocks = 0;
+
+            /**
+             * @brief Count of slabs carved by all threads, the slabs are never returned while the allocator is alive.
+             */
+            size_t slabsCount = 0;
+
+            /**
+             * @brief Bytes reserved for the blocks, including the slab headers.
+             */
+            size_t reservedBytes = 0;
+
+            /**
+             * @brief Bytes occupied by the allocated blocks.
+             */
+            size_t liveBytes = 0;
+
+            /**
+             * @brief High-water mark of the bytes occupied by the allocated blocks.
+             */
+            size_t peakBytes = 0;
+        };
+
+        /**
+         * @brief How many blocks a thread allocates or frees before it publishes its usage to the shared peak counter.
+         */
+        static constexpr int PeakSyncBlocks = 32;
 
         /**
          * @brief Gets the singleton instance of the FixedBlocksAllocator.  
@@ -56,12 +114,7 @@ namespace nau
             static RAIIFunction releaser(nullptr, [&]()
                 {
                     instance->m_readyToRelease = true;
-                    int total = 0;
-                    instance->m_allocs.visitAll([&total](auto& val)
-                        {
-                            total += val;
-                        });
-                    if (!total)
+                    if (!instance->getTotalAllocs())
                         delete instance;
                 });
 
@@ -78,19 +131,21 @@ namespace nau
         {
             NAU_ASSERT(size <= BlockSize, "Invalid size");
 
-            auto out = getFreePointer();
-            
-            void* next = static_cast<PtrPtr>(out)->next;
-            if( !next )
+            auto& segment = m_segments.value();
+
+            void* out = popFreeBlock(segment);
+            if (!out)
             {
-                next = getSection()->allocate(BlockSize);
-                NAU_ASSERT(next, "Out of memory");
-                if(next)
-                    static_cast<PtrPtr>(next)->next = nullptr;
+                out = allocateFromSlab(segment);
+                NAU_ASSERT(out, "Out of memory");
+                if (!out)
+                    return nullptr;
             }
-            
-            getFreePointer() = next;
-            m_allocs.value()++;
+
+            segment.allocs.fetch_add(1, std::memory_order_relaxed);
+            if (++segment.unsyncedAllocs >= PeakSyncBlocks)
+                syncPeak(segment);
+
             return out;            
         }
 
@@ -114,22 +169,38 @@ namespace nau
 
         /**
          * @brief Deallocates the memory block at the given pointer.
+         * If the block was allocated by another thread, it is returned to the owner through its remote free list.
          * 
          * @param p Pointer to the memory block to deallocate.
          */
         void deallocate(void* p) override
         {            
-            static_cast<PtrPtr>(p)->next = getFreePointer();
-            getFreePointer() = p;
-            m_allocs.value()--;
+            auto& segment = m_segments.value();
+            Segment* const owner = getOwner(p);
+
+            if (owner == &segment)
+            {
+                static_cast<PtrPtr>(p)->next = segment.freeList;
+                segment.freeList = p;
+            }
+            else
+            {
+                void* head = owner->remoteFreeList.load(std::memory_order_relaxed);
+                do
+                {
+                    static_cast<PtrPtr>(p)->next = head;
+                } while (!owner->remoteFreeList.compare_exchange_weak(head, p, std::memory_order_release, std::memory_order_relaxed));
+
+                segment.crossThreadFrees.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            segment.allocs.fetch_sub(1, std::memory_order_relaxed);
+            if (--segment.unsyncedAllocs <= -PeakSyncBlocks)
+                syncPeak(segment);
+
             if (m_readyToRelease)
             {
-                int total = 0;
-                m_allocs.visitAll([&total](auto& val)
-                    {
-                        total += val;
-                    });
-                if (!total)
+                if (!getTotalAllocs())
                     delete this;
             }
 
@@ -146,6 +217,33 @@ namespace nau
             return BlockSize;
         }
 
+        /**
+         * @brief Gets the usage and cross-thread traffic counters. 
+         * 
+         * @return Statistics Counters aggregated over all thread segments.
+         */
+        [[nodiscard]] Statistics getStatistics() const
+        {
+            Statistics statistics;
+            int64_t liveBlocks = 0;
+            m_segments.visitAll([&statistics, &liveBlocks](const Segment& segment)
+                {
+                    statistics.crossThreadFrees += segment.crossThreadFrees.load(std::memory_order_relaxed);
+                    statistics.remoteFreeDrains += segment.remoteFreeDrains.load(std::memory_order_relaxed);
+                    statistics.slabsCount += segment.slabsCount.load(std::memory_order_relaxed);
+                    // A block freed by the other thread decrements that thread's counter, so only the sum is meaningful.
+                    liveBlocks += segment.allocs.load(std::memory_order_relaxed);
+                });
+
+            statistics.liveBlocks = static_cast<size_t>(std::max<int64_t>(liveBlocks, 0));
+            statistics.reservedBytes = statistics.slabsCount * SlabSize;
+            statistics.liveBytes = statistics.liveBlocks * BlockSize;
+            statistics.peakBlocks = std::max(static_cast<size_t>(std::max<int64_t>(m_peakBlocks.load(std::memory_order_relaxed), 0)), statistics.liveBlocks);
+            statistics.peakBytes = statistics.peakBlocks * BlockSize;
+
+            return statistics;
+        }
+
     private:
         struct Ptr
         {
@@ -153,41 +251,119 @@ namespace nau
         };
         using PtrPtr = Ptr*;
 
-        struct FreePointer
+        struct Segment;
+
+        struct SlabHeader
         {
-            void* pointer = nullptr;
+            Segment* owner = nullptr;
+        };
+
+        static constexpr size_t SlabSize = std::bit_ceil(std::max<size_t>(16 * 1024, static_cast<size_t>(BlockSize) * 16));
+        static constexpr size_t SlabHeaderSize = ((sizeof(SlabHeader) + BlockSize - 1) / BlockSize) * BlockSize;
+        static constexpr size_t BlocksPerSlab = (SlabSize - SlabHeaderSize) / BlockSize;
+        static constexpr size_t SlabsPerPage = 8;
+
+        /**
+         * @brief Per thread allocator state.
+         */
+        struct Segment
+        {
+            void* freeList = nullptr;
+            char* slabCursor = nullptr;
+            char* slabEnd = nullptr;
+            // Written only by the owning thread, read by the statistics and the release check from any thread.
+            std::atomic<int> allocs = 0;
+            // Allocations (minus deallocations) not yet added to the shared live counter, owner thread only.
+            int unsyncedAllocs = 0;
+            MemSectionPtr memSection;
+            std::atomic<uint64_t> crossThreadFrees = 0;
+            std::atomic<uint64_t> remoteFreeDrains = 0;
+            std::atomic<size_t> slabsCount = 0;
+
+            // Written by the other threads: kept apart from the owner's data.
+            alignas(64) std::atomic<void*> remoteFreeList = nullptr;
         };
 
         bool m_readyToRelease = false;
-        ThreadLocalValue<int> m_allocs;
-        ThreadLocalValue<eastl::shared_ptr<FreePointer>> m_freePointersPool;
-        ThreadLocalValue<MemSectionPtr> m_memSection;
+        ThreadLocalValue<Segment> m_segments;
+        std::atomic<int64_t> m_syncedLiveBlocks = 0;
+        std::atomic<int64_t> m_peakBlocks = 0;
 
-        FixedBlocksAllocator()
-            : m_allocs([](auto& val) {val = 0; })
+        FixedBlocksAllocator() = default;
+
+        static Segment* getOwner(void* p)
         {
-            getFreePointer() = getSection()->allocate(BlockSize);
-            static_cast<PtrPtr>(getFreePointer())->next = nullptr;
+            const auto slab = reinterpret_cast<uintptr_t>(p) & ~(SlabSize - 1);
+            return reinterpret_cast<SlabHeader*>(slab)->owner;
         }
 
-        MemSectionPtr& getSection()
+        int getTotalAllocs()
         {
-            auto& memSection = m_memSection.value();
-            if(!memSection.valid())
-                memSection = HeapAllocator::instance().getSection("FixedBlocksAllocator<" + eastl::to_string(BlockSize) + ">");
-            return memSection;
+            int total = 0;
+            m_segments.visitAll([&total](Segment& segment)
+                {
+                    total += segment.allocs.load(std::memory_order_relaxed);
+                });
+            return total;
+        }
+
+        void syncPeak(Segment& segment)
+        {
+            const int64_t delta = segment.unsyncedAllocs;
+            segment.unsyncedAllocs = 0;
+
+            const int64_t liveBlocks = m_syncedLiveBlocks.fetch_add(delta, std::memory_order_relaxed) + delta;
+            int64_t peakBlocks = m_peakBlocks.load(std::memory_order_relaxed);
+            while (liveBlocks > peakBlocks && !m_peakBlocks.compare_exchange_weak(peakBlocks, liveBlocks, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        void* popFreeBlock(Segment& segment)
+        {
+            if (!segment.freeList)
+            {
+                segment.freeList = segment.remoteFreeList.exchange(nullptr, std::memory_order_acquire);
+                if (!segment.freeList)
+                    return nullptr;
+
+                segment.remoteFreeDrains.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            void* out = segment.freeList;
+            segment.freeList = static_cast<PtrPtr>(out)->next;
+            return out;
+        }
+
+        void* allocateFromSlab(Segment& segment)
+        {
+            if (segment.slabCursor == segment.slabEnd)
+            {
+                auto slab = static_cast<char*>(getSection(segment)->allocate(SlabSize, SlabSize));
+                if (!slab)
+                    return nullptr;
+
+                NAU_ASSERT(nau::isAligned(slab, SlabSize));
+                reinterpret_cast<SlabHeader*>(slab)->owner = &segment;
+                segment.slabCursor = slab + SlabHeaderSize;
+                segment.slabEnd = segment.slabCursor + BlocksPerSlab * BlockSize;
+                segment.slabsCount.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            void* out = segment.slabCursor;
+            segment.slabCursor += BlockSize;
+            return out;
         }
 
-        void*& getFreePointer()
+        MemSectionPtr& getSection(Segment& segment)
         {
-            auto& val = m_freePointersPool.value();
-            if (!val)
+            auto& memSection = segment.memSection;
+            if(!memSection.valid())
             {
-                val = eastl::make_shared<FreePointer>();
-                val->pointer = getSection()->allocate(BlockSize);
-                static_cast<PtrPtr>(val->pointer)->next = nullptr;
+                memSection = HeapAllocator::instance().getSection("FixedBlocksAllocator<" + eastl::to_string(BlockSize) + ">");
+                memSection->setPageSize(SlabSize * SlabsPerPage);
             }
-            return val->pointer;
+            return memSection;
         }
     };
 }
@@ -7,6 +7,9 @@
  */
 #pragma once
 
+#include <EASTL/array.h>
+#include <cstddef>
+
 #include "nau/memory/mem_allocator.h"
 #include "nau/memory/mem_section_ptr.h"
 #include "nau/memory/aligned_allocator_debug.h"
@@ -70,14 +73,25 @@ namespace nau
      * Before using the FrameAllocator, you need to set it as the global frame allocator:
      * FrameAllocator frameAllocator;
      * IFrameAllocator::setFrameAllocator(&frameAllocator);
+     *
+     * The allocator can keep several frames in flight: memory allocated during the frame K remains valid
+     * until the frame K + framesInFlight begins, so the data can be consumed by the GPU/worker threads in the next frames.
+     * Each thread allocates from its own memory section per frame.
      */
     class NAU_KERNEL_EXPORT FrameAllocator final : public IFrameAllocator
     {
     public:
+        /**
+         * @brief Maximum count of frames that can be kept in flight.
+         */
+        static constexpr size_t MaxFramesInFlight = 4;
+
         /**
          * @brief Constructs a new FrameAllocator object.
+         * 
+         * @param framesInFlight Count of frames during which the allocated memory remains valid (1..MaxFramesInFlight).
          */
-        FrameAllocator();
+        explicit FrameAllocator(size_t framesInFlight = 1);
         /**
          * @brief Destroys the FrameAllocator object.
          */
@@ -92,9 +106,10 @@ namespace nau
         /**
          * @brief Prepares the allocator for a new frame. Not thread safe
          * Call the prepareFrame method at the beginning of each frame to reset the allocator for new allocations:
+         * the memory of the oldest frame in flight is reused.
          * 
          * @return true if preparation is successful.
-         * @return false otherwise.
+         * @return false if some allocations of the reused frame have not been deallocated.
          */
         [[nodiscard]] bool prepareFrame() override;
 
@@ -102,10 +117,21 @@ namespace nau
          * @brief Allocates memory of the given size. Thread safe
          * 
          * @param size Size of the memory to allocate.
-         * @return void* Pointer to the allocated memory.
+         * @return void* Pointer to the allocated memory, aligned to alignof(std::max_align_t).
          */
         [[nodiscard]] void* allocate(size_t size) override;
 
+        /**
+         * @brief Allocates memory without the size header. Thread safe
+         * The memory is not tracked and must not be passed to deallocate(), reallocate() or getSize():
+         * it is reclaimed as a whole when its frame is reused.
+         * 
+         * @param size Size of the memory to allocate.
+         * @param alignment Alignment of the memory, must be a power of 2.
+         * @return void* Pointer to the allocated memory.
+         */
+        [[nodiscard]] void* allocateHeaderless(size_t size, size_t alignment = alignof(std::max_align_t));
+
         /**
          * @brief Reallocates memory to a new size.
          * 
@@ -130,10 +156,35 @@ namespace nau
          */
         virtual size_t getSize(const void* ptr) const override;
 
+        /**
+         * @brief Gets the count of frames during which the allocated memory remains valid.
+         */
+        [[nodiscard]] size_t getFramesInFlight() const;
+
     private:
+        /**
+         * @brief Per thread memory of the frames in flight.
+         */
+        struct ThreadFrames
+        {
+            eastl::array<MemSectionPtr, MaxFramesInFlight> memSections;
+            eastl::array<int, MaxFramesInFlight> numAllocs = {};
+        };
+
+        /**
+         * @brief Header of the tracked allocation, keeps the user memory aligned to alignof(std::max_align_t).
+         */
+        struct alignas(std::max_align_t) Header
+        {
+            size_t size;
+            size_t frame;
+        };
+
+        int takeAllocsCount(size_t frame);
 
-        ThreadLocalValue<MemSectionPtr> m_memSection;
-        ThreadLocalValue<int> m_numAllocs;
+        const size_t m_framesInFlight;
+        size_t m_currentFrame = 0;
+        ThreadLocalValue<ThreadFrames> m_frames;
     };
 }
 
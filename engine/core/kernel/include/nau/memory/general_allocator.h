@@ -4,7 +4,10 @@
 
 #pragma once
 
+#include <EASTL/array.h>
+
 #include "nau/memory/array_allocator.h"
+#include "nau/meta/class_info.h"
 
 namespace nau
 {
@@ -19,6 +22,40 @@ namespace nau
     class NAU_KERNEL_EXPORT GeneralAllocator final : public IAlignedAllocatorDebug
     {
     public:
+        /**
+         * @brief Usage and cross-thread traffic of a single fixed-size class.
+         */
+        struct SizeClassStatistics
+        {
+            size_t blockSize = 0;
+            uint64_t crossThreadFrees = 0;
+            uint64_t remoteFreeDrains = 0;
+            size_t liveBlocks = 0;
+            size_t slabsCount = 0;
+            size_t reservedBytes = 0;
+            size_t liveBytes = 0;
+            size_t peakBlocks = 0;
+            size_t peakBytes = 0;
+
+#pragma region Class Info
+            NAU_CLASS_FIELDS(
+                CLASS_FIELD(blockSize),
+                CLASS_FIELD(crossThreadFrees),
+                CLASS_FIELD(remoteFreeDrains),
+                CLASS_FIELD(liveBlocks),
+                CLASS_FIELD(slabsCount),
+                CLASS_FIELD(reservedBytes),
+                CLASS_FIELD(liveBytes),
+                CLASS_FIELD(peakBlocks),
+                CLASS_FIELD(peakBytes))
+#pragma endregion
+        };
+
+        /**
+         * @brief Count of fixed-size classes (32..1024 bytes), larger blocks are served by the array allocator.
+         */
+        static constexpr size_t SizeClassesCount = 6;
+
         /**
          * @brief Allocates a block of memory of the specified size.
          * @param size The size of the memory block to be allocated, in bytes.
@@ -45,6 +82,12 @@ namespace nau
          */
         size_t getSize(const void* ptr) const override;
 
+        /**
+         * @brief Retrieves the usage and cross-thread traffic counters for each fixed-size class.
+         * @return Statistics ordered by the block size.
+         */
+        [[nodiscard]] eastl::array<SizeClassStatistics, SizeClassesCount> getSizeClassStatistics() const;
+
     private:
         using ArrayAllocator = ArrayAllocator<2048>;
     };
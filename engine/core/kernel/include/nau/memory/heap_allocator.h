@@ -6,6 +6,7 @@
 #include "nau/kernel/kernel_config.h"
 #include "nau/memory/mem_allocator.h"
 #include "nau/memory/mem_section_ptr.h"
+#include "nau/meta/class_info.h"
 #include "nau/threading/thread_local_value.h"
 #include "nau/rtti/ptr.h"
 #include <thread>
@@ -15,6 +16,7 @@
 #include <EASTL/set.h>
 #include <EASTL/string.h>
 #include <EASTL/unordered_map.h>
+#include <EASTL/vector.h>
 
 namespace nau
 { 
@@ -24,6 +26,28 @@ namespace nau
     class NAU_KERNEL_EXPORT HeapAllocator final
     {
     public:
+        /**
+         * @brief Memory usage of all sections of the same kind, aggregated over all threads.
+         */
+        struct SectionStatistics
+        {
+            eastl::string kind;
+            size_t sectionsCount = 0;   ///< Count of the sections of this kind, including the ones returned to the pool.
+            size_t pagesCount = 0;      ///< Count of the allocated pages.
+            size_t reservedBytes = 0;   ///< Total size of the allocated pages.
+            size_t usedBytes = 0;       ///< Bytes handed out by the sections.
+            size_t peakUsedBytes = 0;   ///< Sum of the sections high-water marks of the used bytes.
+
+#pragma region Class Info
+            NAU_CLASS_FIELDS(
+                CLASS_FIELD(kind),
+                CLASS_FIELD(sectionsCount),
+                CLASS_FIELD(pagesCount),
+                CLASS_FIELD(reservedBytes),
+                CLASS_FIELD(usedBytes),
+                CLASS_FIELD(peakUsedBytes))
+#pragma endregion
+        };
 
         /**
          * @brief Gets the singleton instance of the HeapAllocator.
@@ -47,6 +71,13 @@ namespace nau
          */
         void releaseSection(MemSectionPtr& ptr);
 
+        /**
+         * @brief Collects the memory usage of the sections grouped by kind.
+         * 
+         * @return Statistics for each section kind, sorted by kind.
+         */
+        [[nodiscard]] eastl::vector<SectionStatistics> getSectionsStatistics();
+
     private:
         HeapAllocator()
             : m_allocs([](auto& val) {val = 0; })
@@ -7,6 +7,7 @@
  */
 #pragma once
 
+#include <atomic>
 #include <set>
 #include "nau/diag/assertion.h"
 #include "nau/memory/mem_page.h"
@@ -20,6 +21,16 @@ namespace nau
     {
         friend class HeapAllocator;
     public:
+        /**
+         * @brief Memory usage counters of the section.
+         */
+        struct Statistics
+        {
+            size_t pagesCount = 0;      ///< Count of the allocated pages.
+            size_t reservedBytes = 0;   ///< Total size of the allocated pages.
+            size_t usedBytes = 0;       ///< Bytes handed out since the last reset.
+            size_t peakUsedBytes = 0;   ///< The largest usedBytes value reached, not cleared by reset().
+        };
 
         MemSection() = default;
         ~MemSection();
@@ -48,7 +59,7 @@ namespace nau
          * 
          * @param size The size of the block of memory to allocate.
          * @param alignment The alignment of the block of memory to allocate.
-         * @return A pointer to the allocated block of memory.
+         * @return A pointer to the allocated block of memory, aligned to the requested alignment.
          */
         [[nodiscard]] void* allocate(size_t size, size_t alignment = 4);
 
@@ -65,6 +76,13 @@ namespace nau
          */
         void reset();
 
+        /**
+         * @brief Gets the memory usage counters. Can be called from any thread.
+         * 
+         * @return The section's memory usage counters.
+         */
+        [[nodiscard]] Statistics getStatistics() const;
+
     private:
         using BytePtr = char*;
 
@@ -74,6 +92,14 @@ namespace nau
         size_t m_pageSize = 64 * 1024; // typical L1 cache size in bytes.
         bool m_inWork = false;
 
+        // Written only by the owning thread, atomic to be readable by the statistics collector.
+        std::atomic<size_t> m_pagesCount = 0;
+        std::atomic<size_t> m_reservedBytes = 0;
+        std::atomic<size_t> m_usedBytes = 0;
+        std::atomic<size_t> m_peakUsedBytes = 0;
+
+        void addPage(MemPage* page);
+
         void freeMem();
     };
 
@@ -0,0 +1,54 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+/**
+ * @file memory_statistics.h
+ * @brief Snapshot of the engine allocators usage.
+ */
+#pragma once
+
+#include <EASTL/vector.h>
+
+#include "nau/io/stream.h"
+#include "nau/kernel/kernel_config.h"
+#include "nau/memory/general_allocator.h"
+#include "nau/memory/heap_allocator.h"
+#include "nau/meta/class_info.h"
+#include "nau/utils/result.h"
+
+namespace nau
+{
+    /**
+     * @brief Usage of the general allocator size classes and of the heap sections.
+     *
+     * The difference between reserved and live/used bytes shows how much memory is kept by the allocators
+     * but is not occupied by the allocations (i.e. fragmentation and free lists).
+     */
+    struct MemoryStatistics
+    {
+        eastl::vector<GeneralAllocator::SizeClassStatistics> sizeClasses;
+        eastl::vector<HeapAllocator::SectionStatistics> sections;
+
+#pragma region Class Info
+        NAU_CLASS_FIELDS(
+            CLASS_FIELD(sizeClasses),
+            CLASS_FIELD(sections))
+#pragma endregion
+    };
+
+    /**
+     * @brief Collects the current memory usage.
+     *
+     * The counters are gathered without stopping the other threads, so the snapshot is not exact while they allocate.
+     */
+    NAU_KERNEL_EXPORT MemoryStatistics getMemoryStatistics();
+
+    /**
+     * @brief Writes the current memory usage as json.
+     *
+     * @param writer Stream to write the report to.
+     * @param pretty Whether to write human readable (indented) json.
+     */
+    NAU_KERNEL_EXPORT Result<> writeMemoryStatistics(io::IStreamWriter& writer, bool pretty = true);
+
+}  // namespace nau
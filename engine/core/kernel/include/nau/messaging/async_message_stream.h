@@ -7,9 +7,11 @@
 
 #include <EASTL/string.h>
 #include <EASTL/string_view.h>
+#include <EASTL/vector.h>
 
 #include "nau/async/task.h"
 #include "nau/kernel/kernel_config.h"
+#include "nau/rtti/type_info.h"
 #include "nau/runtime/async_disposable.h"
 #include "nau/runtime/disposable.h"
 #include "nau/serialization/runtime_value.h"
@@ -17,6 +19,68 @@
 
 namespace nau
 {
+    /**
+        Stream name with the precomputed hash.
+        Intended to be created once (i.e. as a static or as a part of the message declaration) for the frequently posted messages:
+        lookup by the key neither hashes the name nor constructs a temporary string.
+        The referenced name must outlive the key.
+     */
+    class MessageStreamKey
+    {
+    public:
+        MessageStreamKey(eastl::string_view name) noexcept :
+            m_name(name),
+            m_hash(eastl::hash<eastl::string_view>{}(name))
+        {
+        }
+
+        eastl::string_view getName() const noexcept
+        {
+            return m_name;
+        }
+
+        size_t getHash() const noexcept
+        {
+            return m_hash;
+        }
+
+    private:
+        eastl::string_view m_name;
+        size_t m_hash;
+    };
+
+    /**
+        Type of the messages that are transported as raw bytes (see AsyncMessageSource::postBatch).
+        Types are compared by the rtti type info, so the type made in the different modules is the same, use getBinaryMessageType<T>().
+     */
+    struct BinaryMessageType
+    {
+        rtti::TypeInfo typeInfo;
+        size_t size;
+
+        /**
+            Makes the runtime value from the single message: used for the receivers that consume messages as RuntimeValue.
+         */
+        RuntimeValue::Ptr (*makeValue)(const void* data);
+    };
+
+    /**
+        Binary messages taken from the stream at once: count messages of the type->size bytes each.
+     */
+    struct BinaryMessages
+    {
+        const BinaryMessageType* type = nullptr;
+        eastl::vector<std::byte> data;
+        size_t count = 0;
+
+        void clear()
+        {
+            type = nullptr;
+            data.clear();
+            count = 0;
+        }
+    };
+
     class NAU_KERNEL_EXPORT AsyncMessageStream
     {
     public:
@@ -40,6 +104,19 @@ namespace nau
 
         async::Task<RuntimeValue::Ptr> getNextMessage();
 
+        /**
+            Returns task that is ready when the stream has any message.
+            Must not be mixed with the pending getNextMessage().
+        */
+        async::Task<> waitMessages();
+
+        /**
+            Takes all pending messages at once.
+            Messages posted as RuntimeValue and the binary messages are returned separately, the order between them is not preserved.
+            The output containers are swapped with the stream's ones, so their memory is reused by the subsequent posts.
+        */
+        void takeMessages(eastl::vector<RuntimeValue::Ptr>& messages, BinaryMessages& binaryMessages);
+
         void reset();
 
     private:
@@ -99,12 +176,27 @@ namespace nau
 
         virtual bool hasSubscribers(eastl::string_view) const = 0;
 
+        virtual bool hasSubscribers(const MessageStreamKey&) const = 0;
+
         virtual AsyncMessageStream getStream(eastl::string_view streamName) = 0;
 
         // virtual subscribeInplace(Functor<void (const Runtime::Ptr&)) = 0;
 
         virtual void post(eastl::string_view streamName, RuntimeValue::Ptr = nullptr) = 0;
 
+        /**
+            Posts the message by the pre-registered stream key: does not allocate while the stream subscribers are not changed.
+        */
+        virtual void post(const MessageStreamKey& stream, RuntimeValue::Ptr = nullptr) = 0;
+
+        /**
+            Posts count messages of the trivially copyable type as raw bytes: each receiver gets the copy of the whole batch.
+            All binary messages posted to the same stream must have the same type.
+            The receivers get the binary messages after the messages posted as RuntimeValue (see AsyncMessageStream::takeMessages),
+            so the order between the two kinds of the messages is not preserved.
+        */
+        virtual void postBatch(const MessageStreamKey& stream, const BinaryMessageType& type, const void* data, size_t count) = 0;
+
         /**
                 template <typename T>
                 TypedMessageStream<T> getTypedStream(const std::string& streamName);
@@ -5,9 +5,12 @@
 
 #pragma once
 
+#include <EASTL/span.h>
 #include <EASTL/string_view.h>
 
+#include <cstring>
 #include <mutex>
+#include <new>
 
 #include "nau/async/task.h"
 #include "nau/kernel/kernel_config.h"
@@ -45,22 +48,27 @@ namespace nau::nau_detail
         using ValueType = T;
 
         MessageDeclaration(const char streamName[]) :
-            m_streamName(streamName)
+            m_streamKey(streamName)
         {
         }
 
         eastl::string_view getStreamName() const
         {
-            return m_streamName;
+            return m_streamKey.getName();
+        }
+
+        const MessageStreamKey& getStreamKey() const
+        {
+            return m_streamKey;
         }
 
         operator eastl::string_view() const
         {
-            return m_streamName;
+            return m_streamKey.getName();
         }
 
     private:
-        const eastl::string_view m_streamName;
+        const MessageStreamKey m_streamKey;
     };
 
 }  // namespace nau::nau_detail
@@ -70,6 +78,27 @@ namespace nau
     NAU_KERNEL_EXPORT
     AsyncMessageSource& getBroadcaster();
 
+    /**
+        Returns the type of messages that can be posted through AsyncMessageSource::postBatch.
+        Each module has its own instance, the instances are equal by the type info.
+     */
+    template <typename T>
+        requires(std::is_trivially_copyable_v<T> && rtti::HasTypeInfo<T>)
+    const BinaryMessageType& getBinaryMessageType()
+    {
+        static const BinaryMessageType type{
+            rtti::getTypeInfo<T>(),
+            sizeof(T),
+            [](const void* data) -> RuntimeValue::Ptr
+            {
+                alignas(T) std::byte storage[sizeof(T)];
+                std::memcpy(storage, data, sizeof(T));
+                return nau::makeValueCopy(*std::launder(reinterpret_cast<T*>(storage)));
+            }};
+
+        return type;
+    }
+
     /**
      */
     class [[nodiscard]]
@@ -109,6 +138,9 @@ namespace nau
         template <typename Callable, typename ResultType>
         static ResultType invokeHandler(Callable& handler, RuntimeValue::Ptr messageValue);
 
+        template <typename Callable, typename ResultType>
+        static ResultType invokeBinaryHandler(Callable& handler, const BinaryMessageType& type, const std::byte* data);
+
         async::Task<> m_task;
         CancellationSource m_cancellationSource;
     };
@@ -123,7 +155,18 @@ namespace nau
 
         inline void post(AsyncMessageSource& broadcaster, T value) const
         {
-            broadcaster.post(this->getStreamName(), nau::makeValueCopy(std::move(value)));
+            broadcaster.post(this->getStreamKey(), nau::makeValueCopy(std::move(value)));
+        }
+
+        /**
+            Posts all values at once: the values are copied to the receivers as raw bytes.
+            The receivers get them after the messages posted by post(), so the stream should use only one of the two methods
+            when the order matters.
+        */
+        inline void postBatch(AsyncMessageSource& broadcaster, eastl::span<const T> values) const
+            requires(std::is_trivially_copyable_v<T> && rtti::HasTypeInfo<T>)
+        {
+            broadcaster.postBatch(this->getStreamKey(), getBinaryMessageType<T>(), values.data(), values.size());
         }
 
         template <typename Callable>
@@ -144,7 +187,7 @@ namespace nau
 
         inline void post(AsyncMessageSource& broadcaster = getBroadcaster()) const
         {
-            broadcaster.post(this->getStreamName());
+            broadcaster.post(this->getStreamKey());
         }
 
         template <typename Callable>
@@ -185,9 +228,13 @@ namespace nau
             co_await executor;
         }
 
+        // Messages are taken from the stream at once: binary messages are passed to the handler without the intermediate RuntimeValue.
+        eastl::vector<RuntimeValue::Ptr> messages;
+        BinaryMessages binaryMessages;
+
         while(!cancellation.isCancelled())
         {
-            Task<RuntimeValue::Ptr> task = stream.getNextMessage();
+            Task<> task = stream.waitMessages();
 
             if(!task.isReady())
             {
@@ -205,17 +252,48 @@ namespace nau
                 co_yield task.getError();
             }
 
-            RuntimeValue::Ptr message = *std::move(task);
-            if constexpr(std::is_same_v<ResultType, void>)
+            stream.takeMessages(messages, binaryMessages);
+
+            for(RuntimeValue::Ptr& message : messages)
             {
-                invokeHandler<Callable, void>(handler, std::move(message));
+                if(cancellation.isCancelled())
+                {
+                    co_return;
+                }
+
+                if constexpr(std::is_same_v<ResultType, void>)
+                {
+                    invokeHandler<Callable, void>(handler, std::move(message));
+                }
+                else
+                {
+                    Task<> continuation = invokeHandler<Callable, Task<>>(handler, std::move(message));
+                    if(continuation)
+                    {
+                        co_await continuation;
+                    }
+                }
             }
-            else
+
+            for(size_t i = 0; i < binaryMessages.count; ++i)
             {
-                Task<> continuation = invokeHandler<Callable, Task<>>(handler, std::move(message));
-                if(continuation)
+                if(cancellation.isCancelled())
+                {
+                    co_return;
+                }
+
+                const std::byte* const data = binaryMessages.data.data() + i * binaryMessages.type->size;
+                if constexpr(std::is_same_v<ResultType, void>)
                 {
-                    co_await continuation;
+                    invokeBinaryHandler<Callable, void>(handler, *binaryMessages.type, data);
+                }
+                else
+                {
+                    Task<> continuation = invokeBinaryHandler<Callable, Task<>>(handler, *binaryMessages.type, data);
+                    if(continuation)
+                    {
+                        co_await continuation;
+                    }
                 }
             }
         }
@@ -267,6 +345,29 @@ namespace nau
         }
     }
 
+    template <typename Callable, typename ResultType>
+    ResultType AsyncMessageSubscription::invokeBinaryHandler(Callable& handler, const BinaryMessageType& type, const std::byte* data)
+    {
+        using CallableInfo = meta::template GetCallableTypeInfo<Callable>;
+        using ArgumentType = std::decay_t<typename nau_detail::MessageHandlerArgument<typename CallableInfo::ParametersList>::type>;
+
+        if constexpr(std::is_same_v<ArgumentType, void>)
+        {
+            return handler();
+        }
+        else if constexpr(std::is_trivially_copyable_v<ArgumentType> && rtti::HasTypeInfo<ArgumentType>)
+        {
+            if(type.typeInfo == rtti::getTypeInfo<ArgumentType>() && type.size == sizeof(ArgumentType))
+            {
+                alignas(ArgumentType) std::byte storage[sizeof(ArgumentType)];
+                std::memcpy(storage, data, sizeof(ArgumentType));
+                return handler(*std::launder(reinterpret_cast<const ArgumentType*>(storage)));
+            }
+        }
+
+        return invokeHandler<Callable, ResultType>(handler, type.makeValue(data));
+    }
+
 }  // namespace nau
 
 #define NAU_DECLARE_MESSAGE(Descriptor, StreamName, ValueType)   \
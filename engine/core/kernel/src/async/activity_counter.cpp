@@ -0,0 +1,80 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+// activity_counter.cpp
+
+
+#include "nau/async/activity_counter.h"
+
+#include "nau/diag/assertion.h"
+#include "nau/utils/scope_guard.h"
+
+namespace nau::async
+{
+    ActivityCounter::~ActivityCounter()
+    {
+        NAU_ASSERT(m_waitersCount.load() == 0);
+    }
+
+    void ActivityCounter::increment() noexcept
+    {
+        m_counter.fetch_add(1);
+        m_totalCounter.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void ActivityCounter::decrement() noexcept
+    {
+        const size_t prevCount = m_counter.fetch_sub(1);
+        NAU_ASSERT(prevCount > 0);
+
+        // Both operations are sequentially consistent (pairs with wait()):
+        // either the waiter observes zero counter or this thread observes the waiter.
+        if (prevCount == 1 && m_waitersCount.load() > 0)
+        {
+            {
+                // Lock is required to not to miss the waiter that already checked the counter but not yet blocked.
+                const std::lock_guard lock{m_mutex};
+            }
+            m_signal.notify_all();
+        }
+    }
+
+    size_t ActivityCounter::getCount() const noexcept
+    {
+        return m_counter.load();
+    }
+
+    uint64_t ActivityCounter::getTotalCount() const noexcept
+    {
+        return m_totalCounter.load(std::memory_order_relaxed);
+    }
+
+    bool ActivityCounter::wait(std::optional<std::chrono::milliseconds> timeout) noexcept
+    {
+        if (m_counter.load() == 0)
+        {
+            return true;
+        }
+
+        std::unique_lock lock{m_mutex};
+
+        m_waitersCount.fetch_add(1);
+        scope_on_leave
+        {
+            m_waitersCount.fetch_sub(1);
+        };
+
+        const auto isIdle = [this]
+        {
+            return m_counter.load() == 0;
+        };
+
+        if (timeout)
+        {
+            return m_signal.wait_for(lock, *timeout, isIdle);
+        }
+
+        m_signal.wait(lock, isIdle);
+        return true;
+    }
+
+}  // namespace nau::async
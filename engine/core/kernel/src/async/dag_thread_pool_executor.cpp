@@ -5,6 +5,7 @@
 #if __has_include ("util/dag_threadPool.h")
 
 #include "osApiWrappers/dag_cpuJobs.h"
+#include "nau/async/activity_counter.h"
 #include "nau/async/executor.h"
 #include "nau/diag/assertion.h"
 #include "nau/rtti/rtti_impl.h"
@@ -22,7 +23,8 @@ namespace nau::async
 
     public:
         DagThreadPoolExecutor(bool manageCpuJobs, int maxThreads) :
-            m_manageCpuJobs{manageCpuJobs}
+            m_manageCpuJobs{manageCpuJobs},
+            m_threadsCount{static_cast<size_t>(maxThreads)}
         {
             if(m_manageCpuJobs)
             {
@@ -33,7 +35,7 @@ namespace nau::async
 
         ~DagThreadPoolExecutor()
         {
-            NAU_ASSERT(m_taskCounter == 0);
+            NAU_ASSERT(m_activity.getCount() == 0);
 
             threadpool::shutdown();
 
@@ -54,7 +56,7 @@ namespace nau::async
             {
                 lock_(m_mutex);
                 m_invocations.emplace_back(std::move(invocation));
-                ++m_taskCounter;
+                m_activity.increment();
             }
 
             threadpool::add(this);
@@ -62,14 +64,22 @@ namespace nau::async
 
         void waitAnyActivity() noexcept override
         {
-            using namespace std::chrono_literals;
+            m_activity.wait();
+        }
 
-            constexpr auto SleepTimeout = 2ms;
+        bool waitAnyActivityFor(std::chrono::milliseconds timeout) noexcept override
+        {
+            return m_activity.wait(timeout);
+        }
 
-            while(m_taskCounter.load() > 0)
-            {
-                std::this_thread::sleep_for(SleepTimeout);
-            }
+        ExecutorStatistics getStatistics() const noexcept override
+        {
+            ExecutorStatistics statistics;
+            statistics.scheduledCount = m_activity.getTotalCount();
+            statistics.pendingCount = m_activity.getCount();
+            statistics.threadsCount = m_threadsCount;
+
+            return statistics;
         }
 
         void doJob() override
@@ -91,10 +101,9 @@ namespace nau::async
 
             if(invocation)
             {
-                NAU_ASSERT(m_taskCounter > 0);
                 scope_on_leave
                 {
-                    --m_taskCounter;
+                    m_activity.decrement();
                 };
 
                 const Executor::InvokeGuard guard{*this};
@@ -116,11 +125,12 @@ namespace nau::async
         }
 
         const bool m_manageCpuJobs;
+        const size_t m_threadsCount;
         std::list<Invocation> m_invocations;
         //std::vector<Invocation> m_invocations;
         //threading::SpinLock m_mutex;
         std::mutex m_mutex;
-        std::atomic_size_t m_taskCounter = 0;
+        ActivityCounter m_activity;
     };
 
     Executor::Ptr createDagThreadPoolExecutor(bool initCpuJobs, std::optional<size_t> threadsCount)
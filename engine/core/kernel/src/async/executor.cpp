@@ -86,6 +86,15 @@ namespace nau::async
         m_callback(m_callbackData1, m_callbackData2);
     }
 
+    void Executor::Invocation::release(Callback& callback, void*& data1, void*& data2)
+    {
+        callback = m_callback;
+        data1 = m_callbackData1;
+        data2 = m_callbackData2;
+
+        reset();
+    }
+
     void Executor::Invocation::reset()
     {
         m_callback = nullptr;
@@ -199,6 +208,17 @@ namespace nau::async
         scheduleInvocation(Invocation{callback, data1, data2});
     }
 
+    bool Executor::waitAnyActivityFor([[maybe_unused]] std::chrono::milliseconds timeout) noexcept
+    {
+        waitAnyActivity();
+        return true;
+    }
+
+    ExecutorStatistics Executor::getStatistics() const noexcept
+    {
+        return {};
+    }
+
     void Executor::invoke([[maybe_unused]] Executor& executor, Invocation invocation) noexcept
     {
         NAU_ASSERT(getThisThreadInvokedExecutor() != nullptr, "Executor must be set prior invoke. Use Executor::InvokeGuard.");
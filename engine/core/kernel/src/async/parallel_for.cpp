@@ -0,0 +1,88 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+// parallel_for.cpp
+
+
+#include "nau/async/parallel_for.h"
+
+#include <algorithm>
+
+#include "nau/diag/assertion.h"
+
+namespace nau::async
+{
+    namespace
+    {
+        size_t getHelpersCount(Executor* executor, size_t chunksCount, size_t maxHelpersCount)
+        {
+            if (!executor || chunksCount < 2)
+            {
+                return 0;
+            }
+
+            // The worker of the executor would wait for the helpers queued behind it (all the workers can be blocked so):
+            // the chunks are processed inline.
+            if (Executor::getInvoked().get() == executor)
+            {
+                return 0;
+            }
+
+            const size_t threadsCount = executor->getStatistics().threadsCount;
+            return std::min({threadsCount, chunksCount - 1, maxHelpersCount});
+        }
+    }  // namespace
+
+    ParallelFor::ParallelFor(Executor* executor, size_t chunksCount, size_t maxHelpersCount) :
+        m_executor(executor),
+        m_chunksCount(chunksCount),
+        m_helpersCount(getHelpersCount(executor, chunksCount, maxHelpersCount))
+    {
+    }
+
+    size_t ParallelFor::getWorkersCount() const
+    {
+        return m_helpersCount + 1;
+    }
+
+    void ParallelFor::run(ChunkCallback callback, void* data, threading::Event& helpersCompleted)
+    {
+        NAU_ASSERT(callback);
+        NAU_ASSERT(!m_callback, "ParallelFor can be run only once");
+
+        m_callback = callback;
+        m_data = data;
+        m_helpersCompleted = &helpersCompleted;
+        m_pendingHelpers = m_helpersCount;
+
+        for (size_t i = 0; i < m_helpersCount; ++i)
+        {
+            m_executor->execute([](void* selfPtr, void* workerIndex) noexcept
+            {
+                auto& self = *reinterpret_cast<ParallelFor*>(selfPtr);
+                self.processChunks(reinterpret_cast<size_t>(workerIndex));
+
+                // the object can be destroyed as soon as the counter drops to zero, only the event can be touched after that
+                threading::Event& helpersCompleted = *self.m_helpersCompleted;
+                if (self.m_pendingHelpers.fetch_sub(1) == 1)
+                {
+                    helpersCompleted.set();
+                }
+            }, this, reinterpret_cast<void*>(i + 1));
+        }
+
+        processChunks(0);
+
+        if (m_helpersCount > 0)
+        {
+            helpersCompleted.wait();
+        }
+    }
+
+    void ParallelFor::processChunks(size_t workerIndex)
+    {
+        for (size_t chunk = m_nextChunk.fetch_add(1); chunk < m_chunksCount; chunk = m_nextChunk.fetch_add(1))
+        {
+            m_callback(m_data, chunk, workerIndex);
+        }
+    }
+}  // namespace nau::async
@@ -0,0 +1,69 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+// thread_pool_defaults.h
+
+
+#pragma once
+
+#include <algorithm>
+#include <thread>
+
+#ifndef _WIN32
+    #include <sched.h>
+    #include <unistd.h>
+#endif
+
+namespace nau::async
+{
+    /**
+        @brief Returns the count of logical processors available to the current process.
+     */
+    inline size_t getHardwareThreadsCount()
+    {
+#ifdef _WIN32
+        ::SYSTEM_INFO sysInfo;
+        ::GetSystemInfo(&sysInfo);
+
+        return std::max<size_t>(static_cast<size_t>(sysInfo.dwNumberOfProcessors), 1);
+#else
+        // Respect affinity masks (taskset, cgroup cpusets in containers) before falling back to the online cores count.
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        if (::sched_getaffinity(0, sizeof(cpuSet), &cpuSet) == 0)
+        {
+            if (const int count = CPU_COUNT(&cpuSet); count > 0)
+            {
+                return static_cast<size_t>(count);
+            }
+        }
+
+        if (const long count = ::sysconf(_SC_NPROCESSORS_ONLN); count > 0)
+        {
+            return static_cast<size_t>(count);
+        }
+
+        return std::max<size_t>(std::thread::hardware_concurrency(), 1);
+#endif
+    }
+
+    /**
+        @brief Default threads count for the shared queue thread pool.
+     */
+    inline size_t getDefaultThreadsCount()
+    {
+        constexpr size_t MinThreadsCount = 5;
+
+        return std::max(getHardwareThreadsCount() / 3, MinThreadsCount);
+    }
+
+    /**
+        @brief Default workers count for the work stealing thread pool: one core is left for the main thread.
+     */
+    inline size_t getDefaultWorkStealingThreadsCount()
+    {
+        constexpr size_t MinThreadsCount = 2;
+
+        return std::max(getHardwareThreadsCount() - 1, MinThreadsCount);
+    }
+
+}  // namespace nau::async
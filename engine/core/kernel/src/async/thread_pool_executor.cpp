@@ -4,34 +4,17 @@
 
 #include "nau/async/thread_pool_executor.h"
 
+#include "nau/async/activity_counter.h"
 #include "nau/rtti/rtti_impl.h"
 #include "nau/runtime/internal/runtime_component.h"
 #include "nau/runtime/internal/runtime_object_registry.h"
 #include "nau/threading/set_thread_name.h"
 #include "nau/utils/functor.h"
 #include "nau/utils/scope_guard.h"
+#include "thread_pool_defaults.h"
 
 namespace nau::async
 {
-    namespace
-    {
-#ifdef _WIN32
-        size_t getDefaultThreadsCount()
-        {
-            constexpr DWORD MinThreadsCount = 5;
-
-            ::SYSTEM_INFO sysInfo;
-            ::GetSystemInfo(&sysInfo);
-
-            return static_cast<size_t>(std::max(sysInfo.dwNumberOfProcessors / 3, MinThreadsCount));
-        }
-#else
-        size_t getDefaultThreadsCount()
-        {
-            return 5;
-        }
-#endif
-    }  // namespace
 
     /**
      */
@@ -74,7 +57,7 @@ namespace nau::async
                 return;
             }
 
-            m_taskCounter.fetch_add(1);
+            m_activity.increment();
 
             const std::lock_guard lock{m_mutex};
 
@@ -84,19 +67,34 @@ namespace nau::async
 
         void waitAnyActivity() noexcept override
         {
-            using namespace std::chrono_literals;
+            m_activity.wait();
+        }
+
+        bool waitAnyActivityFor(std::chrono::milliseconds timeout) noexcept override
+        {
+            return m_activity.wait(timeout);
+        }
+
+        ExecutorStatistics getStatistics() const noexcept override
+        {
+            using namespace std::chrono;
 
-            constexpr auto SleepTimeout = 2ms;
+            const auto totalTime = duration_cast<nanoseconds>(steady_clock::now() - m_startTime) * static_cast<nanoseconds::rep>(m_threads.size());
+            const nanoseconds idleTime{m_idleTime.load(std::memory_order_relaxed)};
 
-            while (m_taskCounter.load() > 0)
-            {
-                std::this_thread::sleep_for(SleepTimeout);
-            }
+            ExecutorStatistics statistics;
+            statistics.threadsCount = m_threads.size();
+            statistics.scheduledCount = m_activity.getTotalCount();
+            statistics.pendingCount = m_activity.getCount();
+            statistics.idleTime = idleTime;
+            statistics.busyTime = totalTime > idleTime ? totalTime - idleTime : nanoseconds{0};
+
+            return statistics;
         }
 
         bool hasWorks() override
         {
-            return m_taskCounter.load() > 0;
+            return m_activity.getCount() > 0;
         }
 
         Invocation getOrWaitNextInvocation()
@@ -115,7 +113,9 @@ namespace nau::async
                 }
                 else if (m_isActive)
                 {
+                    const auto waitStartTime = std::chrono::steady_clock::now();
                     m_signal.wait(lock);
+                    m_idleTime.fetch_add((std::chrono::steady_clock::now() - waitStartTime).count(), std::memory_order_relaxed);
                 }
             } while (!invocation && m_isActive);
 
@@ -134,8 +134,7 @@ namespace nau::async
 
                 scope_on_leave
                 {
-                    NAU_ASSERT(m_taskCounter > 0);
-                    m_taskCounter.fetch_sub(1);
+                    m_activity.decrement();
                 };
 
                 const Executor::InvokeGuard guard{*this};
@@ -170,7 +169,9 @@ namespace nau::async
         eastl::vector<std::thread> m_threads;
         std::mutex m_mutex;
         std::condition_variable m_signal;
-        std::atomic_size_t m_taskCounter = 0;
+        ActivityCounter m_activity;
+        const std::chrono::steady_clock::time_point m_startTime = std::chrono::steady_clock::now();
+        std::atomic<std::chrono::nanoseconds::rep> m_idleTime = 0;
     };
 
     Executor::Ptr createThreadPoolExecutor(std::optional<size_t> threadsCount)
@@ -0,0 +1,479 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+// work_stealing_executor.cpp
+
+
+#include <EASTL/deque.h>
+
+#include "nau/async/activity_counter.h"
+#include "nau/async/thread_pool_executor.h"
+#include "nau/rtti/rtti_impl.h"
+#include "nau/runtime/internal/runtime_component.h"
+#include "nau/runtime/internal/runtime_object_registry.h"
+#include "nau/threading/set_thread_name.h"
+#include "nau/utils/scope_guard.h"
+#include "thread_pool_defaults.h"
+
+namespace nau::async
+{
+    namespace
+    {
+        /**
+            @brief Fixed capacity Chase-Lev deque.
+            push()/pop() must be called only by the owning worker thread and operate on the bottom (LIFO) end,
+            steal() can be called from any thread and takes invocations from the top (FIFO) end.
+         */
+        class WorkStealingDeque
+        {
+        public:
+            static constexpr int64_t Capacity = 4096;
+
+            static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be power of two");
+
+            /**
+                @brief Pushes invocation to the bottom of the deque.
+                @return false if the deque is full: in that case the invocation is left untouched.
+             */
+            bool push(Executor::Invocation& invocation)
+            {
+                const int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+                const int64_t top = m_top.load(std::memory_order_acquire);
+                if (bottom - top >= Capacity)
+                {
+                    return false;
+                }
+
+                Executor::Callback callback = nullptr;
+                void* data1 = nullptr;
+                void* data2 = nullptr;
+                invocation.release(callback, data1, data2);
+
+                Slot& slot = m_slots[bottom & Mask];
+                slot.callback.store(callback, std::memory_order_relaxed);
+                slot.data1.store(data1, std::memory_order_relaxed);
+                slot.data2.store(data2, std::memory_order_relaxed);
+
+                std::atomic_thread_fence(std::memory_order_release);
+                m_bottom.store(bottom + 1, std::memory_order_relaxed);
+
+                return true;
+            }
+
+            /**
+                @brief Takes the most recently pushed invocation.
+             */
+            Executor::Invocation pop()
+            {
+                const int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+                m_bottom.store(bottom, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                int64_t top = m_top.load(std::memory_order_relaxed);
+                if (top > bottom)
+                {
+                    m_bottom.store(bottom + 1, std::memory_order_relaxed);
+                    return {};
+                }
+
+                Slot& slot = m_slots[bottom & Mask];
+                const Executor::Callback callback = slot.callback.load(std::memory_order_relaxed);
+                void* const data1 = slot.data1.load(std::memory_order_relaxed);
+                void* const data2 = slot.data2.load(std::memory_order_relaxed);
+
+                if (top == bottom)
+                {
+                    // The last element: race against the stealers.
+                    const bool taken = m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+                    m_bottom.store(bottom + 1, std::memory_order_relaxed);
+                    if (!taken)
+                    {
+                        return {};
+                    }
+                }
+
+                return Executor::Invocation{callback, data1, data2};
+            }
+
+            /**
+                @brief Takes the oldest invocation.
+                @param contended set to true if the invocation was taken by the concurrent thread: the caller may retry.
+             */
+            Executor::Invocation steal(bool& contended)
+            {
+                int64_t top = m_top.load(std::memory_order_acquire);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                const int64_t bottom = m_bottom.load(std::memory_order_acquire);
+
+                if (top >= bottom)
+                {
+                    return {};
+                }
+
+                Slot& slot = m_slots[top & Mask];
+                const Executor::Callback callback = slot.callback.load(std::memory_order_relaxed);
+                void* const data1 = slot.data1.load(std::memory_order_relaxed);
+                void* const data2 = slot.data2.load(std::memory_order_relaxed);
+
+                if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                {
+                    contended = true;
+                    return {};
+                }
+
+                return Executor::Invocation{callback, data1, data2};
+            }
+
+            bool isEmpty() const
+            {
+                return m_bottom.load(std::memory_order_acquire) <= m_top.load(std::memory_order_acquire);
+            }
+
+        private:
+            static constexpr int64_t Mask = Capacity - 1;
+
+            // Invocation parts are stored as separate atomics: a stealer may read a slot while the owner rewrites it,
+            // such torn read is always discarded by the failed compare exchange on m_top.
+            struct Slot
+            {
+                std::atomic<Executor::Callback> callback{nullptr};
+                std::atomic<void*> data1{nullptr};
+                std::atomic<void*> data2{nullptr};
+            };
+
+            alignas(64) std::atomic<int64_t> m_top{0};
+            alignas(64) std::atomic<int64_t> m_bottom{0};
+            Slot m_slots[Capacity];
+        };
+
+        struct ThisThreadWorker
+        {
+            const void* pool = nullptr;
+            size_t index = 0;
+        };
+
+        thread_local ThisThreadWorker s_thisThreadWorker;
+
+    }  // namespace
+
+    /**
+        Thread pool where each worker owns a lock-free deque.
+        Invocations scheduled from the worker thread (i.e. coroutine continuations) are pushed to the worker's own deque and executed in LIFO order,
+        idle workers steal the oldest invocations from the other workers.
+        Invocations scheduled from the outside threads are passed through the shared FIFO injection queue.
+        Idle workers are parked and woken up one per scheduled invocation.
+     */
+    class WorkStealingExecutor final : public Executor,
+                                       public IRuntimeComponent
+    {
+        NAU_CLASS_(nau::async::WorkStealingExecutor, Executor, IRuntimeComponent)
+
+    public:
+        WorkStealingExecutor(std::optional<size_t> threadsCount)
+        {
+            const size_t maxThreads = std::max<size_t>(threadsCount ? *threadsCount : getDefaultWorkStealingThreadsCount(), 1);
+
+            m_workers.reserve(maxThreads);
+            for (size_t i = 0; i < maxThreads; ++i)
+            {
+                m_workers.emplace_back(eastl::make_unique<Worker>());
+                m_workers.back()->randomState = static_cast<uint32_t>(i * 2654435761u + 1);
+            }
+
+            for (size_t i = 0; i < maxThreads; ++i)
+            {
+                m_workers[i]->thread = std::thread([](WorkStealingExecutor& executor, size_t threadIndex)
+                {
+                    threading::setThisThreadName(std::format("Nau Worker-{}", threadIndex + 1));
+                    executor.threadWork(threadIndex);
+                }, std::ref(*this), i);
+            }
+
+            RuntimeObjectRegistration{nau::Ptr<>{this}}.setAutoRemove();
+        }
+
+        ~WorkStealingExecutor()
+        {
+            join();
+        }
+
+    private:
+        struct Worker
+        {
+            WorkStealingDeque deque;
+            std::thread thread;
+            uint32_t randomState = 1;
+        };
+
+        void scheduleInvocation(Invocation invocation) noexcept override
+        {
+            NAU_ASSERT(invocation);
+            if (!invocation)
+            {
+                return;
+            }
+
+            m_activity.increment();
+
+            Worker* const worker = getThisThreadWorker();
+            if (!worker || !worker->deque.push(invocation))
+            {
+                const std::lock_guard lock{m_injectionMutex};
+                m_injectionQueue.emplace_back(std::move(invocation));
+                m_injectionSize.fetch_add(1, std::memory_order_release);
+            }
+
+            wakeOne();
+        }
+
+        void waitAnyActivity() noexcept override
+        {
+            m_activity.wait();
+        }
+
+        bool waitAnyActivityFor(std::chrono::milliseconds timeout) noexcept override
+        {
+            return m_activity.wait(timeout);
+        }
+
+        ExecutorStatistics getStatistics() const noexcept override
+        {
+            using namespace std::chrono;
+
+            const auto totalTime = duration_cast<nanoseconds>(steady_clock::now() - m_startTime) * static_cast<nanoseconds::rep>(m_workers.size());
+            const nanoseconds idleTime{m_idleTime.load(std::memory_order_relaxed)};
+
+            ExecutorStatistics statistics;
+            statistics.threadsCount = m_workers.size();
+            statistics.scheduledCount = m_activity.getTotalCount();
+            statistics.pendingCount = m_activity.getCount();
+            statistics.idleTime = idleTime;
+            statistics.busyTime = totalTime > idleTime ? totalTime - idleTime : nanoseconds{0};
+
+            return statistics;
+        }
+
+        bool hasWorks() override
+        {
+            return m_activity.getCount() > 0;
+        }
+
+        Worker* getThisThreadWorker() const
+        {
+            return s_thisThreadWorker.pool == this ? m_workers[s_thisThreadWorker.index].get() : nullptr;
+        }
+
+        Invocation popInjected()
+        {
+            if (m_injectionSize.load(std::memory_order_acquire) == 0)
+            {
+                return {};
+            }
+
+            const std::lock_guard lock{m_injectionMutex};
+            if (m_injectionQueue.empty())
+            {
+                return {};
+            }
+
+            Invocation invocation = std::move(m_injectionQueue.front());
+            m_injectionQueue.pop_front();
+            m_injectionSize.fetch_sub(1, std::memory_order_relaxed);
+
+            return invocation;
+        }
+
+        Invocation stealInvocation(Worker& thief, size_t thiefIndex)
+        {
+            const size_t workersCount = m_workers.size();
+            if (workersCount < 2)
+            {
+                return {};
+            }
+
+            // xorshift32: pick a random victim to start with, so the thieves do not crowd on the same deque.
+            uint32_t& state = thief.randomState;
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+
+            bool contended = false;
+            do
+            {
+                contended = false;
+                const size_t startIndex = state % workersCount;
+                for (size_t i = 0; i < workersCount; ++i)
+                {
+                    const size_t victimIndex = (startIndex + i) % workersCount;
+                    if (victimIndex == thiefIndex)
+                    {
+                        continue;
+                    }
+
+                    if (auto invocation = m_workers[victimIndex]->deque.steal(contended))
+                    {
+                        return invocation;
+                    }
+                }
+            } while (contended);
+
+            return {};
+        }
+
+        Invocation findInvocation(size_t workerIndex)
+        {
+            Worker& worker = *m_workers[workerIndex];
+
+            if (auto invocation = worker.deque.pop())
+            {
+                return invocation;
+            }
+
+            if (auto invocation = popInjected())
+            {
+                return invocation;
+            }
+
+            return stealInvocation(worker, workerIndex);
+        }
+
+        bool hasPendingInvocations() const
+        {
+            if (m_injectionSize.load(std::memory_order_acquire) > 0)
+            {
+                return true;
+            }
+
+            return std::any_of(m_workers.begin(), m_workers.end(), [](const eastl::unique_ptr<Worker>& worker)
+            {
+                return !worker->deque.isEmpty();
+            });
+        }
+
+        void wakeOne()
+        {
+            // Pairs with the fence in park(): either the parking worker observes the scheduled invocation,
+            // or this thread observes the parking worker.
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (m_sleepingCount.load(std::memory_order_relaxed) == 0)
+            {
+                return;
+            }
+
+            {
+                const std::lock_guard lock{m_parkMutex};
+                if (m_wakeTokens >= m_sleepingCount.load(std::memory_order_relaxed))
+                {
+                    return;
+                }
+                ++m_wakeTokens;
+            }
+
+            m_parkSignal.notify_one();
+        }
+
+        /**
+            @return false if the executor is stopped and there is no more work for the worker.
+         */
+        bool park()
+        {
+            m_sleepingCount.fetch_add(1);
+            scope_on_leave
+            {
+                m_sleepingCount.fetch_sub(1);
+            };
+
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (hasPendingInvocations())
+            {
+                return true;
+            }
+
+            const auto parkStartTime = std::chrono::steady_clock::now();
+            scope_on_leave
+            {
+                m_idleTime.fetch_add((std::chrono::steady_clock::now() - parkStartTime).count(), std::memory_order_relaxed);
+            };
+
+            std::unique_lock lock{m_parkMutex};
+            m_parkSignal.wait(lock, [this]
+            {
+                return m_wakeTokens > 0 || !m_isActive;
+            });
+
+            if (m_wakeTokens > 0)
+            {
+                --m_wakeTokens;
+            }
+
+            return m_isActive || hasPendingInvocations();
+        }
+
+        void threadWork(size_t workerIndex)
+        {
+            s_thisThreadWorker = {this, workerIndex};
+            scope_on_leave
+            {
+                s_thisThreadWorker = {};
+            };
+
+            while (true)
+            {
+                auto invocation = findInvocation(workerIndex);
+                if (!invocation)
+                {
+                    if (!park())
+                    {
+                        break;
+                    }
+
+                    continue;
+                }
+
+                scope_on_leave
+                {
+                    m_activity.decrement();
+                };
+
+                const Executor::InvokeGuard guard{*this};
+                Executor::invoke(*this, std::move(invocation));
+            }
+        }
+
+        void join()
+        {
+            {
+                const std::lock_guard lock{m_parkMutex};
+                m_isActive = false;
+            }
+
+            m_parkSignal.notify_all();
+
+            for (auto& worker : m_workers)
+            {
+                worker->thread.join();
+            }
+        }
+
+        std::atomic_bool m_isActive{true};
+        eastl::vector<eastl::unique_ptr<Worker>> m_workers;
+
+        eastl::deque<Invocation> m_injectionQueue;
+        std::mutex m_injectionMutex;
+        std::atomic_size_t m_injectionSize = 0;
+
+        std::mutex m_parkMutex;
+        std::condition_variable m_parkSignal;
+        std::atomic_size_t m_sleepingCount = 0;
+        size_t m_wakeTokens = 0;
+
+        ActivityCounter m_activity;
+        const std::chrono::steady_clock::time_point m_startTime = std::chrono::steady_clock::now();
+        std::atomic<std::chrono::nanoseconds::rep> m_idleTime = 0;
+    };
+
+    Executor::Ptr createWorkStealingThreadPoolExecutor(std::optional<size_t> threadsCount)
+    {
+        return rtti::createInstance<WorkStealingExecutor, Executor>(threadsCount);
+    }
+
+}  // namespace nau::async
@@ -300,6 +300,72 @@ namespace nau::math
         return v_sphere_intersect(center, r, plane03X, plane03Y, plane03Z, plane03W, camPlanes[4], camPlanes[5]);
     }
 
+    void NauFrustum::testSpheresB(const float* centerX, const float* centerY, const float* centerZ, const float* radius,
+                                  size_t count, uint32_t* visibilityBits) const
+    {
+        __m128 planeX[6], planeY[6], planeZ[6], planeW[6];
+        for (int p = 0; p < 6; ++p)
+        {
+            planeX[p] = v_splat_x(camPlanes[p].get128());
+            planeY[p] = v_splat_y(camPlanes[p].get128());
+            planeZ[p] = v_splat_z(camPlanes[p].get128());
+            planeW[p] = v_splat_w(camPlanes[p].get128());
+        }
+
+        for (size_t first = 0; first < count; first += 32)
+        {
+            const size_t wordCount = count - first < 32 ? count - first : 32;
+            uint32_t bits = 0;
+
+            for (size_t i = 0; i < wordCount; i += 4)
+            {
+                const size_t index = first + i;
+                __m128 x, y, z, r;
+                if (index + 4 <= count)
+                {
+                    x = _mm_loadu_ps(centerX + index);
+                    y = _mm_loadu_ps(centerY + index);
+                    z = _mm_loadu_ps(centerZ + index);
+                    r = _mm_loadu_ps(radius + index);
+                }
+                else
+                {
+                    alignas(16) float tail[4][4] = {};
+                    for (size_t j = 0; index + j < count; ++j)
+                    {
+                        tail[0][j] = centerX[index + j];
+                        tail[1][j] = centerY[index + j];
+                        tail[2][j] = centerZ[index + j];
+                        tail[3][j] = radius[index + j];
+                    }
+                    x = _mm_load_ps(tail[0]);
+                    y = _mm_load_ps(tail[1]);
+                    z = _mm_load_ps(tail[2]);
+                    r = _mm_load_ps(tail[3]);
+                }
+
+                // the sign bit of the result is set if the sphere is behind any of the planes
+                __m128 outside = v_zero();
+                for (int p = 0; p < 6; ++p)
+                {
+                    __m128 dist = v_madd(x, planeX[p], planeW[p]);
+                    dist = v_madd(y, planeY[p], dist);
+                    dist = v_madd(z, planeZ[p], dist);
+                    outside = v_or(outside, v_add(dist, r));
+                }
+
+                bits |= uint32_t(~_mm_movemask_ps(outside) & 0xF) << i;
+            }
+
+            if (wordCount < 32)
+            {
+                bits &= (1u << wordCount) - 1;
+            }
+
+            visibilityBits[first / 32] = bits;
+        }
+    }
+
 
     __m128 v_perm_xycw(__m128 xyzw, __m128 abcd)
     {
@@ -0,0 +1,279 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/math/spheres_grid.h"
+
+#include <EASTL/algorithm.h>
+
+#include "nau/math/dag_lsbVisitor.h"
+
+namespace nau::math
+{
+    namespace
+    {
+        // cell coordinates are packed into the 64 bit key, 21 bits per axis
+        constexpr int CellCoordBits = 21;
+        constexpr int64_t CellCoordBias = int64_t(1) << (CellCoordBits - 1);
+        constexpr uint64_t CellCoordMask = (uint64_t(1) << CellCoordBits) - 1;
+
+        inline uint64_t packCellCoord(float value, float invCellSize)
+        {
+            const float cell = floorf(value * invCellSize);
+            const float clamped = eastl::clamp(cell, -float(CellCoordBias), float(CellCoordBias - 1));
+            return uint64_t(int64_t(clamped) + CellCoordBias) & CellCoordMask;
+        }
+
+        inline float unpackCellCenter(uint64_t key, int shift, float cellSize)
+        {
+            const int64_t cell = int64_t((key >> shift) & CellCoordMask) - CellCoordBias;
+            return (float(cell) + 0.5f) * cellSize;
+        }
+
+        inline void markVisible(uint32_t id, uint32_t* visibilityBits, size_t wordCount, size_t& visibleCount)
+        {
+            if (id / 32 < wordCount)
+            {
+                visibilityBits[id / 32] |= 1u << (id % 32);
+                ++visibleCount;
+            }
+        }
+    }  // namespace
+
+    SpheresGrid::SpheresGrid(float cellSize) :
+        m_cellSize(cellSize),
+        m_invCellSize(1.f / cellSize),
+        m_cellHalfDiagonal(cellSize * 0.5f * 1.7320508f)
+    {
+        NAU_ASSERT(cellSize > 0.f);
+    }
+
+    void SpheresGrid::update(uint32_t id, const Vector3& center, float radius)
+    {
+        if (!(radius > 0.f))
+        {
+            remove(id);
+            return;
+        }
+
+        if (id >= m_locations.size())
+        {
+            m_locations.resize(id + 1);
+        }
+
+        const uint64_t key = getCellKey(center);
+        Location& location = m_locations[id];
+
+        if (location.cell != InvalidCell && m_cells[location.cell].key == key)
+        {
+            // moved within its cell: the cell bounds only depend on the largest radius
+            Cell& cell = m_cells[location.cell];
+            const float oldRadius = cell.radius[location.slot];
+            cell.centerX[location.slot] = center.getX();
+            cell.centerY[location.slot] = center.getY();
+            cell.centerZ[location.slot] = center.getZ();
+            cell.radius[location.slot] = radius;
+
+            if (radius > cell.maxRadius || (radius < oldRadius && oldRadius >= cell.maxRadius))
+            {
+                updateCellBounds(location.cell);
+            }
+
+            return;
+        }
+
+        if (location.cell != InvalidCell)
+        {
+            removeFromCell(location);
+        }
+        else
+        {
+            ++m_spheresCount;
+        }
+
+        const uint32_t cellIndex = getOrAddCell(key);
+        Cell& cell = m_cells[cellIndex];
+
+        location.cell = cellIndex;
+        location.slot = static_cast<uint32_t>(cell.ids.size());
+
+        cell.ids.push_back(id);
+        cell.centerX.push_back(center.getX());
+        cell.centerY.push_back(center.getY());
+        cell.centerZ.push_back(center.getZ());
+        cell.radius.push_back(radius);
+
+        if (radius > cell.maxRadius)
+        {
+            updateCellBounds(cellIndex);
+        }
+    }
+
+    void SpheresGrid::remove(uint32_t id)
+    {
+        if (id >= m_locations.size() || m_locations[id].cell == InvalidCell)
+        {
+            return;
+        }
+
+        removeFromCell(m_locations[id]);
+        --m_spheresCount;
+    }
+
+    void SpheresGrid::clear()
+    {
+        m_cells.clear();
+        m_cellIndices.clear();
+        m_locations.clear();
+        m_cellCenterX.clear();
+        m_cellCenterY.clear();
+        m_cellCenterZ.clear();
+        m_cellRadius.clear();
+        m_spheresCount = 0;
+    }
+
+    size_t SpheresGrid::cull(const NauFrustum& frustum, uint32_t* visibilityBits, size_t wordCount) const
+    {
+        eastl::fill_n(visibilityBits, wordCount, 0u);
+
+        size_t visibleCount = 0;
+        const size_t cellsCount = m_cells.size();
+
+        for (size_t firstCell = 0; firstCell < cellsCount; firstCell += 32)
+        {
+            uint32_t cellsVisibility = 0;
+            frustum.testSpheresB(m_cellCenterX.data() + firstCell, m_cellCenterY.data() + firstCell, m_cellCenterZ.data() + firstCell,
+                                 m_cellRadius.data() + firstCell, eastl::min<size_t>(32, cellsCount - firstCell), &cellsVisibility);
+
+            for (const uint32_t cellBit : LsbVisitor{cellsVisibility})
+            {
+                const size_t cellIndex = firstCell + cellBit;
+                const Cell& cell = m_cells[cellIndex];
+                const Vector3 cellCenter{m_cellCenterX[cellIndex], m_cellCenterY[cellIndex], m_cellCenterZ[cellIndex]};
+
+                // testSphere() returns 1 when the sphere is completely inside the frustum
+                if (frustum.testSphere(cellCenter, Vector4{m_cellRadius[cellIndex]}) == 1)
+                {
+                    for (const uint32_t id : cell.ids)
+                    {
+                        markVisible(id, visibilityBits, wordCount, visibleCount);
+                    }
+
+                    continue;
+                }
+
+                const size_t spheresCount = cell.ids.size();
+                for (size_t first = 0; first < spheresCount; first += 32)
+                {
+                    uint32_t visibility = 0;
+                    frustum.testSpheresB(cell.centerX.data() + first, cell.centerY.data() + first, cell.centerZ.data() + first,
+                                         cell.radius.data() + first, eastl::min<size_t>(32, spheresCount - first), &visibility);
+
+                    for (const uint32_t bit : LsbVisitor{visibility})
+                    {
+                        markVisible(cell.ids[first + bit], visibilityBits, wordCount, visibleCount);
+                    }
+                }
+            }
+        }
+
+        return visibleCount;
+    }
+
+    uint64_t SpheresGrid::getCellKey(const Vector3& center) const
+    {
+        return packCellCoord(center.getX(), m_invCellSize) |
+               (packCellCoord(center.getY(), m_invCellSize) << CellCoordBits) |
+               (packCellCoord(center.getZ(), m_invCellSize) << (CellCoordBits * 2));
+    }
+
+    uint32_t SpheresGrid::getOrAddCell(uint64_t key)
+    {
+        if (auto iter = m_cellIndices.find(key); iter != m_cellIndices.end())
+        {
+            return iter->second;
+        }
+
+        const uint32_t cellIndex = static_cast<uint32_t>(m_cells.size());
+        m_cellIndices[key] = cellIndex;
+
+        m_cells.emplace_back().key = key;
+        m_cellCenterX.push_back(unpackCellCenter(key, 0, m_cellSize));
+        m_cellCenterY.push_back(unpackCellCenter(key, CellCoordBits, m_cellSize));
+        m_cellCenterZ.push_back(unpackCellCenter(key, CellCoordBits * 2, m_cellSize));
+        m_cellRadius.push_back(m_cellHalfDiagonal);
+
+        return cellIndex;
+    }
+
+    void SpheresGrid::removeFromCell(Location& location)
+    {
+        const uint32_t cellIndex = location.cell;
+        Cell& cell = m_cells[cellIndex];
+
+        const uint32_t slot = location.slot;
+        const uint32_t lastSlot = static_cast<uint32_t>(cell.ids.size() - 1);
+        const float radius = cell.radius[slot];
+
+        if (slot != lastSlot)
+        {
+            cell.ids[slot] = cell.ids[lastSlot];
+            cell.centerX[slot] = cell.centerX[lastSlot];
+            cell.centerY[slot] = cell.centerY[lastSlot];
+            cell.centerZ[slot] = cell.centerZ[lastSlot];
+            cell.radius[slot] = cell.radius[lastSlot];
+            m_locations[cell.ids[slot]].slot = slot;
+        }
+
+        cell.ids.pop_back();
+        cell.centerX.pop_back();
+        cell.centerY.pop_back();
+        cell.centerZ.pop_back();
+        cell.radius.pop_back();
+
+        location.cell = InvalidCell;
+
+        if (cell.ids.empty())
+        {
+            removeCell(cellIndex);
+        }
+        else if (radius >= cell.maxRadius)
+        {
+            updateCellBounds(cellIndex);
+        }
+    }
+
+    void SpheresGrid::removeCell(uint32_t cellIndex)
+    {
+        m_cellIndices.erase(m_cells[cellIndex].key);
+
+        const uint32_t lastIndex = static_cast<uint32_t>(m_cells.size() - 1);
+        if (cellIndex != lastIndex)
+        {
+            m_cells[cellIndex] = std::move(m_cells[lastIndex]);
+            m_cellCenterX[cellIndex] = m_cellCenterX[lastIndex];
+            m_cellCenterY[cellIndex] = m_cellCenterY[lastIndex];
+            m_cellCenterZ[cellIndex] = m_cellCenterZ[lastIndex];
+            m_cellRadius[cellIndex] = m_cellRadius[lastIndex];
+
+            m_cellIndices[m_cells[cellIndex].key] = cellIndex;
+            for (const uint32_t id : m_cells[cellIndex].ids)
+            {
+                m_locations[id].cell = cellIndex;
+            }
+        }
+
+        m_cells.pop_back();
+        m_cellCenterX.pop_back();
+        m_cellCenterY.pop_back();
+        m_cellCenterZ.pop_back();
+        m_cellRadius.pop_back();
+    }
+
+    void SpheresGrid::updateCellBounds(uint32_t cellIndex)
+    {
+        Cell& cell = m_cells[cellIndex];
+        cell.maxRadius = cell.radius.empty() ? 0.f : *eastl::max_element(cell.radius.begin(), cell.radius.end());
+        m_cellRadius[cellIndex] = m_cellHalfDiagonal + cell.maxRadius;
+    }
+}  // namespace nau::math
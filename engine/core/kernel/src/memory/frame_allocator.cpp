@@ -14,44 +14,65 @@ namespace nau
         return allocator;
     }
 
-    FrameAllocator::FrameAllocator() :
-        m_memSection([](MemSectionPtr& value) {value = HeapAllocator::instance().getSection("FrameAllocator:" + eastl::to_string((size_t)&value)); }),
-        m_numAllocs([](int& value) {value = 0; })
-    {}
+    FrameAllocator::FrameAllocator(size_t framesInFlight) :
+        m_framesInFlight(std::clamp<size_t>(framesInFlight, 1, MaxFramesInFlight)),
+        m_frames([this](ThreadFrames& value)
+            {
+                const eastl::string kind = "FrameAllocator:" + eastl::to_string((size_t)&value) + ":";
+                for (size_t frame = 0; frame < m_framesInFlight; ++frame)
+                    value.memSections[frame] = HeapAllocator::instance().getSection(kind + eastl::to_string(frame));
+            })
+    {
+        NAU_ASSERT(m_framesInFlight == framesInFlight, "Invalid frames in flight count");
+    }
 
     FrameAllocator::~FrameAllocator()
     {
         int total = 0;
-        m_numAllocs.visitAll([&total](int& num)
-            {
-                total += num;
-                num = 0;
-            });
+        for (size_t frame = 0; frame < m_framesInFlight; ++frame)
+            total += takeAllocsCount(frame);
+
         NAU_ASSERT(total == 0, "FrameAllocator not all allocations has been deallocated");
     }
 
-    bool FrameAllocator::prepareFrame()
+    int FrameAllocator::takeAllocsCount(size_t frame)
     {
         int total = 0;
-        m_numAllocs.visitAll([&total](int& num)
+        m_frames.visitAll([&total, frame](ThreadFrames& frames)
             {
-                total += num;
-                num = 0;
+                total += frames.numAllocs[frame];
+                frames.numAllocs[frame] = 0;
             });
+        return total;
+    }
 
+    bool FrameAllocator::prepareFrame()
+    {
+        // The oldest frame in flight is reused for the new allocations.
+        m_currentFrame = (m_currentFrame + 1) % m_framesInFlight;
+
+        const int total = takeAllocsCount(m_currentFrame);
         NAU_ASSERT(total == 0, "FrameAllocator not all allocations has been deallocated");
-        m_memSection.visitAll([](MemSectionPtr& a) { a->reset(); });
+
+        m_frames.visitAll([frame = m_currentFrame](ThreadFrames& frames) { frames.memSections[frame]->reset(); });
         return total == 0;
     }
 
     [[nodiscard]]
     void* FrameAllocator::allocate(size_t size)
     {
-        auto realSize = size + sizeof(size_t);
-        ++m_numAllocs.value();
-        auto ptr = m_memSection.value()->allocate(realSize);
-        *static_cast<size_t*>(ptr) = size;
-        return static_cast<char*>(ptr) + sizeof(size_t);
+        auto& frames = m_frames.value();
+        ++frames.numAllocs[m_currentFrame];
+
+        auto header = static_cast<Header*>(frames.memSections[m_currentFrame]->allocate(sizeof(Header) + size, alignof(Header)));
+        header->size = size;
+        header->frame = m_currentFrame;
+        return header + 1;
+    }
+
+    void* FrameAllocator::allocateHeaderless(size_t size, size_t alignment)
+    {
+        return m_frames.value().memSections[m_currentFrame]->allocate(size, alignment);
     }
 
     void* FrameAllocator::reallocate(void* ptr, size_t size)
@@ -59,8 +80,7 @@ namespace nau
         if (!ptr)
             return allocate(size);
 
-        auto oldPtr = static_cast<char*>(ptr) - sizeof(size_t);
-        auto oldSize = *reinterpret_cast<size_t*>(oldPtr);
+        auto oldSize = static_cast<Header*>(ptr)[-1].size;
         if (size <= oldSize)
             return ptr;
 
@@ -73,7 +93,7 @@ namespace nau
     void FrameAllocator::deallocate(void* ptr)
     {
         if (ptr)
-            --m_numAllocs.value();
+            --m_frames.value().numAllocs[static_cast<Header*>(ptr)[-1].frame];
     }
 
     size_t FrameAllocator::getSize(const void* ptr) const 
@@ -81,7 +101,12 @@ namespace nau
         if (!ptr)
             return 0;
 
-        return *reinterpret_cast<const size_t*>(static_cast<const char*>(ptr) - sizeof(size_t));
+        return static_cast<const Header*>(ptr)[-1].size;
+    }
+
+    size_t FrameAllocator::getFramesInFlight() const
+    {
+        return m_framesInFlight;
     }
 
     void IFrameAllocator::setFrameAllocator(IFrameAllocator* allocator)
@@ -18,6 +18,27 @@ namespace nau
     using BytePtr = unsigned char*;
     using ConstBytePtr = const unsigned char*;
 
+    namespace
+    {
+        template <int BlockSize>
+        GeneralAllocator::SizeClassStatistics getFixedBlocksStatistics()
+        {
+            const auto statistics = FixedBlocksAllocator<BlockSize>::instance().getStatistics();
+            GeneralAllocator::SizeClassStatistics result;
+            result.blockSize = BlockSize;
+            result.crossThreadFrees = statistics.crossThreadFrees;
+            result.remoteFreeDrains = statistics.remoteFreeDrains;
+            result.liveBlocks = statistics.liveBlocks;
+            result.slabsCount = statistics.slabsCount;
+            result.reservedBytes = statistics.reservedBytes;
+            result.liveBytes = statistics.liveBytes;
+            result.peakBlocks = statistics.peakBlocks;
+            result.peakBytes = statistics.peakBytes;
+
+            return result;
+        }
+    }  // namespace
+
     void* GeneralAllocator::allocate(size_t size)
     {
         auto realSize = size + sizeof(BlockHeader);
@@ -94,4 +115,16 @@ namespace nau
         return header->size;
     }
 
+    eastl::array<GeneralAllocator::SizeClassStatistics, GeneralAllocator::SizeClassesCount> GeneralAllocator::getSizeClassStatistics() const
+    {
+        return {
+            getFixedBlocksStatistics<32>(),
+            getFixedBlocksStatistics<64>(),
+            getFixedBlocksStatistics<128>(),
+            getFixedBlocksStatistics<256>(),
+            getFixedBlocksStatistics<512>(),
+            getFixedBlocksStatistics<1024>()
+        };
+    }
+
 }
\ No newline at end of file
@@ -2,6 +2,8 @@
 // Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
 
 
+#include <EASTL/sort.h>
+
 #include "nau/memory/mem_allocator.h"
 #include "nau/memory/nau_allocator_wrapper.h"
 #include "nau/memory/general_allocator.h"
@@ -80,7 +82,11 @@ namespace nau
         auto it = localPool.find(kind);
         if (it == localPool.end() || it->second.empty())
         {
-            auto& memSection = getSectionsMap()[kind];
+            auto& sectionsMap = getSectionsMap();
+
+            // The thread's map can be visited by the statistics collector.
+            lock_(m_sync);
+            auto& memSection = sectionsMap[kind];
             memSection.m_inWork = true;
             return { kind, &memSection };
         }
@@ -125,6 +131,44 @@ namespace nau
         return *val;
     }
 
+    eastl::vector<HeapAllocator::SectionStatistics> HeapAllocator::getSectionsStatistics()
+    {
+        eastl::vector<SectionStatistics> result;
+        {
+            lock_(m_sync);
+            for (const auto& sectionsMap : m_sections)
+            {
+                for (const auto& [kind, section] : *sectionsMap)
+                {
+                    auto statistics = eastl::find_if(result.begin(), result.end(), [&kind](const SectionStatistics& item)
+                    {
+                        return item.kind == kind;
+                    });
+
+                    if (statistics == result.end())
+                    {
+                        statistics = &result.emplace_back();
+                        statistics->kind = kind;
+                    }
+
+                    const auto sectionStatistics = section.getStatistics();
+                    statistics->sectionsCount++;
+                    statistics->pagesCount += sectionStatistics.pagesCount;
+                    statistics->reservedBytes += sectionStatistics.reservedBytes;
+                    statistics->usedBytes += sectionStatistics.usedBytes;
+                    statistics->peakUsedBytes += sectionStatistics.peakUsedBytes;
+                }
+            }
+        }
+
+        eastl::sort(result.begin(), result.end(), [](const SectionStatistics& left, const SectionStatistics& right)
+        {
+            return left.kind < right.kind;
+        });
+
+        return result;
+    }
+
     void HeapAllocator::releasePools()
     {
         bool canDestroy = true;
@@ -3,6 +3,7 @@
 
 
 #include "nau/memory/mem_section.h"
+#include "nau/memory/mem_allocator.h"
 
 namespace nau
 {
@@ -21,6 +22,16 @@ namespace nau
             it = next;
         }
         m_rootPage = nullptr;
+        m_pagesCount.store(0, std::memory_order_relaxed);
+        m_reservedBytes.store(0, std::memory_order_relaxed);
+        m_usedBytes.store(0, std::memory_order_relaxed);
+        m_peakUsedBytes.store(0, std::memory_order_relaxed);
+    }
+
+    void MemSection::addPage(MemPage* page)
+    {
+        m_pagesCount.store(m_pagesCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        m_reservedBytes.store(m_reservedBytes.load(std::memory_order_relaxed) + page->getSize(), std::memory_order_relaxed);
     }
 
     void MemSection::setPageSize(size_t size)
@@ -36,14 +47,22 @@ namespace nau
 
     void* MemSection::allocate(size_t size, size_t alignment)
     {
+        NAU_ASSERT(isPowerOf2(alignment), "requested alignment is not a power of 2");
+
+        const auto alignFree = [this, alignment]
+        {
+            return reinterpret_cast<BytePtr>(alignedSize(reinterpret_cast<uintptr_t>(m_free), alignment));
+        };
+
         auto pageSize = std::max(size, m_pageSize);
         if (!m_rootPage)
         {
             m_currentPage = m_rootPage = MemPage::allocateMemPage(pageSize, alignment);
+            addPage(m_currentPage);
             m_free = m_currentPage->getAddress();
             NAU_ASSERT(m_free, "MemSection memory allocation failed");
         }
-        else while (!m_currentPage->contains(BytePtr(m_free) + size))
+        else while (!m_currentPage->contains(alignFree() + size))
         {
             if(m_currentPage->getNext())
             {
@@ -54,14 +73,16 @@ namespace nau
             {
                 auto newPage = MemPage::allocateMemPage(pageSize, alignment);
                 m_currentPage->setNext(newPage);
+                addPage(newPage);
                 m_currentPage = newPage;
                 m_free = m_currentPage->getAddress();
                 NAU_ASSERT(m_free, "MemSection memory allocation failed");
             }
         }
 
-        auto p = m_free;
-        m_free = static_cast<BytePtr>(m_free) + size;
+        auto p = alignFree();
+        m_free = p + size;
+        m_usedBytes.store(m_usedBytes.load(std::memory_order_relaxed) + size, std::memory_order_relaxed);
         return p;
     }
     
@@ -82,8 +103,24 @@ namespace nau
 
     void MemSection::reset()
     {
+        if (!m_rootPage)
+            return;
+
         m_currentPage = m_rootPage;
         m_free = m_currentPage->getAddress();    
+        m_peakUsedBytes.store(std::max(m_peakUsedBytes.load(std::memory_order_relaxed), m_usedBytes.load(std::memory_order_relaxed)), std::memory_order_relaxed);
+        m_usedBytes.store(0, std::memory_order_relaxed);
+    }
+
+    MemSection::Statistics MemSection::getStatistics() const
+    {
+        const size_t usedBytes = m_usedBytes.load(std::memory_order_relaxed);
+        return {
+            m_pagesCount.load(std::memory_order_relaxed),
+            m_reservedBytes.load(std::memory_order_relaxed),
+            usedBytes,
+            std::max(m_peakUsedBytes.load(std::memory_order_relaxed), usedBytes)
+        };
     }
 
 }
\ No newline at end of file
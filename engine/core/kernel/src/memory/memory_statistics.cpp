@@ -0,0 +1,30 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/memory/memory_statistics.h"
+
+#include "nau/serialization/json.h"
+#include "nau/serialization/json_utils.h"
+
+namespace nau
+{
+    MemoryStatistics getMemoryStatistics()
+    {
+        MemoryStatistics statistics;
+
+        // GeneralAllocator has no state of its own: all instances share the same fixed blocks allocators.
+        const auto sizeClasses = GeneralAllocator{}.getSizeClassStatistics();
+        statistics.sizeClasses.assign(sizeClasses.begin(), sizeClasses.end());
+        statistics.sections = HeapAllocator::instance().getSectionsStatistics();
+
+        return statistics;
+    }
+
+    Result<> writeMemoryStatistics(io::IStreamWriter& writer, bool pretty)
+    {
+        const MemoryStatistics statistics = getMemoryStatistics();
+        return serialization::jsonWrite(writer, makeValueRef(statistics, getDefaultAllocator()), serialization::JsonSettings{.pretty = pretty});
+    }
+
+}  // namespace nau
@@ -7,6 +7,8 @@
 
 #include "./async_message_stream_impl.h"
 
+#include <EASTL/fixed_vector.h>
+
 namespace nau
 {
     AsyncMessageSourceImpl::AsyncMessageSourceImpl() :
@@ -37,11 +39,28 @@ namespace nau
                                                             this);
     }
 
+    AsyncMessageSourceImpl::SubscribersMap::const_iterator AsyncMessageSourceImpl::findSubscribers(const MessageStreamKey& stream) const
+    {
+        return m_subscribers.find_as(stream, [](const MessageStreamKey& key)
+                                     {
+                                         return key.getHash();
+                                     },
+                                     [](const eastl::string& streamName, const MessageStreamKey& key)
+                                     {
+                                         return eastl::string_view{streamName} == key.getName();
+                                     });
+    }
+
     bool AsyncMessageSourceImpl::hasSubscribers(eastl::string_view streamName) const
+    {
+        return hasSubscribers(MessageStreamKey{streamName});
+    }
+
+    bool AsyncMessageSourceImpl::hasSubscribers(const MessageStreamKey& stream) const
     {
         const std::shared_lock lock{m_mutex};
 
-        auto entry = m_subscribers.find(eastl::string{streamName});
+        auto entry = findSubscribers(stream);
         return entry != m_subscribers.end() && entry->second.hasAnySubscription();
     }
 
@@ -65,34 +84,77 @@ namespace nau
 
     void AsyncMessageSourceImpl::post(eastl::string_view streamName, RuntimeValue::Ptr message)
     {
-        eastl::vector<nau::Ptr<AsyncMessageStreamImpl>> receivers;
+        post(MessageStreamKey{streamName}, std::move(message));
+    }
+
+    const AsyncMessageSourceImpl::Receivers* AsyncMessageSourceImpl::findReceivers(const MessageStreamKey& stream) const
+    {
+        if(m_isCancelled)
+        {
+            NAU_ASSERT(m_subscribers.empty());
+            // NAU_FAILURE_ALWAYS("Post message through closed stream:({})", name);
+            return nullptr;
+        }
+
+        if(auto subscribers = findSubscribers(stream); subscribers != m_subscribers.end())
+        {
+            return &subscribers->second.asyncStreams;
+        }
+
+        return nullptr;
+    }
+
+    template <typename Push>
+    void AsyncMessageSourceImpl::deliver(const MessageStreamKey& stream, Push push)
+    {
+        // The messages are queued under the shared lock, so the receivers are neither copied nor referenced.
+        // But the awaiting receivers are resumed only after the lock is released:
+        // the resumed subscriber can (un)subscribe inplace.
+        // Overflows (allocates) only when more than the inplace count of receivers are awaiting at the same time.
+        eastl::fixed_vector<AsyncMessageStreamImpl::Delivery, 8, true> deliveries;
 
         {
             const std::shared_lock lock{m_mutex};
 
-            if(m_isCancelled)
+            const Receivers* const receivers = findReceivers(stream);
+            if(!receivers)
             {
-                NAU_ASSERT(m_subscribers.empty());
-                // NAU_FAILURE_ALWAYS("Post message through closed stream:({})", name);
                 return;
             }
 
-            if(auto subscribers = m_subscribers.find(eastl::string{streamName}); subscribers != m_subscribers.end())
+            for(const nau::Ptr<AsyncMessageStreamImpl>& receiver : *receivers)
             {
-                receivers.reserve(subscribers->second.asyncStreams.size());
-                for(nau::Ptr<AsyncMessageStreamImpl>& stream : subscribers->second.asyncStreams)
+                if(AsyncMessageStreamImpl::Delivery delivery = push(*receiver))
                 {
-                    receivers.push_back(stream);
+                    deliveries.emplace_back(std::move(delivery));
                 }
             }
         }
 
-        for(auto&& stream : receivers)
+        for(AsyncMessageStreamImpl::Delivery& delivery : deliveries)
         {
-            stream->push(message);
+            delivery.resolve();
         }
     }
 
+    void AsyncMessageSourceImpl::post(const MessageStreamKey& stream, RuntimeValue::Ptr message)
+    {
+        deliver(stream, [&message](AsyncMessageStreamImpl& receiver)
+        {
+            return receiver.push(message);
+        });
+    }
+
+    void AsyncMessageSourceImpl::postBatch(const MessageStreamKey& stream, const BinaryMessageType& type, const void* data, size_t count)
+    {
+        NAU_ASSERT(data || count == 0);
+
+        deliver(stream, [&](AsyncMessageStreamImpl& receiver)
+        {
+            return receiver.pushBinary(type, data, count);
+        });
+    }
+
     void AsyncMessageSourceImpl::unregisterStream(AsyncMessageStreamImpl& stream)
     {
         lock_(m_mutex);
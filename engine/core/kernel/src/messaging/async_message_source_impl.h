@@ -35,18 +35,26 @@ namespace nau
 
         bool hasSubscribers(eastl::string_view streamName) const override;
 
+        bool hasSubscribers(const MessageStreamKey& stream) const override;
+
         AsyncMessageStream getStream(eastl::string_view streamName) override;
 
         // virtual subscribeInplace(Functor<void (const MessageEnvelope&)) = 0;
 
         void post(eastl::string_view streamName, RuntimeValue::Ptr) override;
 
+        void post(const MessageStreamKey& stream, RuntimeValue::Ptr) override;
+
+        void postBatch(const MessageStreamKey& stream, const BinaryMessageType& type, const void* data, size_t count) override;
+
         void unregisterStream(AsyncMessageStreamImpl& stream);
 
     private:
+        using Receivers = eastl::vector<nau::Ptr<AsyncMessageStreamImpl>>;
+
         struct StreamSubscribers
         {
-            eastl::vector<nau::Ptr<AsyncMessageStreamImpl>> asyncStreams;
+            Receivers asyncStreams;
 
             bool hasAnySubscription() const
             {
@@ -54,9 +62,28 @@ namespace nau
             }
         };
 
+        // Must be compatible with MessageStreamKey::getHash().
+        struct StreamNameHash
+        {
+            size_t operator()(const eastl::string& streamName) const
+            {
+                return eastl::hash<eastl::string_view>{}(streamName);
+            }
+        };
+
+        using SubscribersMap = eastl::unordered_map<eastl::string, StreamSubscribers, StreamNameHash>;
+
+        SubscribersMap::const_iterator findSubscribers(const MessageStreamKey& stream) const;
+
+        // Must be called under the lock.
+        const Receivers* findReceivers(const MessageStreamKey& stream) const;
+
+        template <typename Push>
+        void deliver(const MessageStreamKey& stream, Push push);
+
         void cancelSubscriptions();
 
-        eastl::unordered_map<eastl::string, StreamSubscribers> m_subscribers;
+        SubscribersMap m_subscribers;
         mutable std::shared_mutex m_mutex;
         CancellationSubscription m_cancellationSubscription;
         RuntimeObjectRegistration m_disposeRegistration;
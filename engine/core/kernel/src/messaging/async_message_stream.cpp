@@ -67,6 +67,31 @@ namespace nau
         return m_stream->getNextMessage();
     }
 
+    async::Task<> AsyncMessageStream::waitMessages()
+    {
+        if(!m_stream)
+        {
+            return async::Task<>::makeRejected(NauMakeError("Invalid message stream object"));
+        }
+
+        return m_stream->waitMessages();
+    }
+
+    void AsyncMessageStream::takeMessages(eastl::vector<RuntimeValue::Ptr>& messages, BinaryMessages& binaryMessages)
+    {
+        NAU_ASSERT(m_stream);
+
+        if(m_stream)
+        {
+            m_stream->takeMessages(messages, binaryMessages);
+        }
+        else
+        {
+            messages.clear();
+            binaryMessages.clear();
+        }
+    }
+
     void AsyncMessageStream::reset()
     {
         if(auto stream = std::exchange(m_stream, nullptr))
@@ -37,36 +37,191 @@ namespace nau
             return async::Task<RuntimeValue::Ptr>::makeRejected(NauMakeError("Object is disposed"));
         }
 
-        if(m_messages.empty())
+        const bool hasQueuedMessages = m_messagesReadOffset < m_messages.size();
+        if(!hasQueuedMessages && m_binaryMessages.count > 0)
+        {
+            return async::Task<RuntimeValue::Ptr>::makeResolved(popBinaryMessage());
+        }
+
+        if(!hasQueuedMessages)
         {
             NAU_ASSERT(!m_awaiter);
+            NAU_ASSERT(!m_messagesAwaiter, "getNextMessage() can not be mixed with waitMessages()");
             m_awaiter = async::TaskSource<RuntimeValue::Ptr>{};
             return m_awaiter.getTask();
         }
 
-        RuntimeValue::Ptr message = std::move(m_messages.front());
-        m_messages.erase(m_messages.begin());
+        RuntimeValue::Ptr message = std::move(m_messages[m_messagesReadOffset++]);
+        if(m_messagesReadOffset == m_messages.size())
+        {
+            // clear() keeps the capacity
+            m_messages.clear();
+            m_messagesReadOffset = 0;
+        }
+        else if(m_messagesReadOffset > m_messages.size() / 2)
+        {
+            // The consumer may never catch up with the producer: the taken messages are released once they are the most of the queue
+            // (each message is moved at most once per compaction, so the cost is amortized).
+            m_messages.erase(m_messages.begin(), m_messages.begin() + m_messagesReadOffset);
+            m_messagesReadOffset = 0;
+        }
 
         return async::Task<RuntimeValue::Ptr>::makeResolved(std::move(message));
     }
 
-    void AsyncMessageStreamImpl::push(RuntimeValue::Ptr message)
+    async::Task<> AsyncMessageStreamImpl::waitMessages()
     {
         lock_(m_mutex);
+
         if(m_isCancelled)
         {
-            return;
+            return async::Task<>::makeRejected(NauMakeError("Object is disposed"));
+        }
+
+        if(hasMessages())
+        {
+            return async::Task<>::makeResolved();
+        }
+
+        NAU_ASSERT(!m_messagesAwaiter);
+        NAU_ASSERT(!m_awaiter, "waitMessages() can not be mixed with getNextMessage()");
+        m_messagesAwaiter = async::TaskSource<>{};
+        return m_messagesAwaiter.getTask();
+    }
+
+    void AsyncMessageStreamImpl::takeMessages(eastl::vector<RuntimeValue::Ptr>& messages, BinaryMessages& binaryMessages)
+    {
+        messages.clear();
+        binaryMessages.clear();
+
+        lock_(m_mutex);
+
+        if(m_messagesReadOffset > 0)
+        {
+            // Partially consumed by getNextMessage(): only the rest is returned.
+            m_messages.erase(m_messages.begin(), m_messages.begin() + m_messagesReadOffset);
+            m_messagesReadOffset = 0;
+        }
+
+        // The receiver's (cleared) buffer is given to the stream: two buffers are swapped back and forth
+        // and the queue does not allocate once they are large enough.
+        eastl::swap(m_messages, messages);
+
+        if(m_binaryReadOffset > 0)
+        {
+            // Partially consumed by getNextMessage(): only the rest is returned.
+            m_binaryMessages.data.erase(m_binaryMessages.data.begin(), m_binaryMessages.data.begin() + m_binaryReadOffset);
+            m_binaryReadOffset = 0;
+        }
+
+        eastl::swap(m_binaryMessages, binaryMessages);
+        if(binaryMessages.type)
+        {
+            // Keep the type: all binary messages of the stream must have the same type.
+            m_binaryMessages.type = binaryMessages.type;
+        }
+    }
+
+    void AsyncMessageStreamImpl::Delivery::resolve()
+    {
+        if(messageAwaiter)
+        {
+            messageAwaiter.resolve(std::move(message));
+            messageAwaiter = nullptr;
+        }
+
+        if(messagesAwaiter)
+        {
+            messagesAwaiter.resolve();
+            messagesAwaiter = nullptr;
+        }
+    }
+
+    AsyncMessageStreamImpl::Delivery AsyncMessageStreamImpl::push(RuntimeValue::Ptr message)
+    {
+        Delivery delivery;
+
+        lock_(m_mutex);
+        if(m_isCancelled)
+        {
+            return delivery;
         }
 
         if(m_awaiter)
         {
-            m_awaiter.resolve(std::move(message));
-            m_awaiter = nullptr;
+            delivery.messageAwaiter = std::exchange(m_awaiter, nullptr);
+            delivery.message = std::move(message);
         }
         else
         {
             m_messages.emplace_back(std::move(message));
+            delivery.messagesAwaiter = std::exchange(m_messagesAwaiter, nullptr);
+        }
+
+        return delivery;
+    }
+
+    AsyncMessageStreamImpl::Delivery AsyncMessageStreamImpl::pushBinary(const BinaryMessageType& type, const void* data, size_t count)
+    {
+        Delivery delivery;
+        if(count == 0)
+        {
+            return delivery;
+        }
+
+        lock_(m_mutex);
+        if(m_isCancelled)
+        {
+            return delivery;
+        }
+
+        NAU_ASSERT(!m_binaryMessages.type || m_binaryMessages.type->typeInfo == type.typeInfo, "Binary messages of the different types are posted to the stream ({})", m_streamName.c_str());
+        NAU_ASSERT(!m_binaryMessages.type || m_binaryMessages.type->size == type.size);
+        m_binaryMessages.type = &type;
+
+        const auto bytes = reinterpret_cast<const std::byte*>(data);
+        m_binaryMessages.data.insert(m_binaryMessages.data.end(), bytes, bytes + type.size * count);
+        m_binaryMessages.count += count;
+
+        if(m_awaiter)
+        {
+            delivery.messageAwaiter = std::exchange(m_awaiter, nullptr);
+            delivery.message = popBinaryMessage();
+        }
+        else
+        {
+            delivery.messagesAwaiter = std::exchange(m_messagesAwaiter, nullptr);
         }
+
+        return delivery;
+    }
+
+    bool AsyncMessageStreamImpl::hasMessages() const
+    {
+        return m_messagesReadOffset < m_messages.size() || m_binaryMessages.count > 0;
+    }
+
+    RuntimeValue::Ptr AsyncMessageStreamImpl::popBinaryMessage()
+    {
+        NAU_FATAL(m_binaryMessages.type);
+        NAU_FATAL(m_binaryMessages.count > 0);
+
+        RuntimeValue::Ptr message = m_binaryMessages.type->makeValue(m_binaryMessages.data.data() + m_binaryReadOffset);
+        m_binaryReadOffset += m_binaryMessages.type->size;
+
+        if(--m_binaryMessages.count == 0)
+        {
+            m_binaryMessages.data.clear();
+            m_binaryReadOffset = 0;
+        }
+        else if(m_binaryReadOffset > m_binaryMessages.data.size() / 2)
+        {
+            // Same as for the runtime value messages (see getNextMessage()).
+            m_binaryMessages.data.erase(m_binaryMessages.data.begin(), m_binaryMessages.data.begin() + m_binaryReadOffset);
+            m_binaryReadOffset = 0;
+        }
+
+        return message;
     }
 
     const eastl::string& AsyncMessageStreamImpl::getStreamName() const
@@ -86,23 +241,39 @@ namespace nau
 
     void AsyncMessageStreamImpl::cancel(Error::Ptr error, bool unregisterStream)
     {
-        lock_(m_mutex);
+        // The source is unregistered outside of the stream lock: the source pushes the messages to the stream under its own lock.
+        AsyncMessageSourceImpl* const source = EXPR_Block->AsyncMessageSourceImpl*
+        {
+            lock_(m_mutex);
+            cancelMessages(std::move(error));
+            return std::exchange(m_source, nullptr);
+        };
+
+        if(source && unregisterStream)
+        {
+            source->unregisterStream(*this);
+        }
+    }
+
+    void AsyncMessageStreamImpl::cancelMessages(Error::Ptr error)
+    {
         if(const bool alreadyCancelled = std::exchange(m_isCancelled, true); !alreadyCancelled)
         {
             m_messages.clear();
+            m_messagesReadOffset = 0;
+            m_binaryMessages.clear();
+            m_binaryReadOffset = 0;
             if(m_awaiter)
             {
-                m_awaiter.reject(std::move(error));
+                m_awaiter.reject(error);
                 m_awaiter = nullptr;
             }
+            if(m_messagesAwaiter)
+            {
+                m_messagesAwaiter.reject(std::move(error));
+                m_messagesAwaiter = nullptr;
+            }
         }
-
-        if(auto source = std::exchange(m_source, nullptr); source && unregisterStream)
-        {
-            source->unregisterStream(*this);
-        }
-
-        m_source = nullptr;
     }
 
 }  // namespace nau
@@ -28,7 +28,31 @@ namespace nau
 
         async::Task<RuntimeValue::Ptr> getNextMessage();
 
-        void push(RuntimeValue::Ptr);
+        async::Task<> waitMessages();
+
+        void takeMessages(eastl::vector<RuntimeValue::Ptr>& messages, BinaryMessages& binaryMessages);
+
+        /**
+            The awaiter taken out of the stream by push(): resolving it can resume the awaiting subscriber inplace,
+            so the caller resolves it only after all of its own locks are released.
+         */
+        struct Delivery
+        {
+            async::TaskSource<RuntimeValue::Ptr> messageAwaiter = nullptr;
+            async::TaskSource<> messagesAwaiter = nullptr;
+            RuntimeValue::Ptr message;
+
+            explicit operator bool() const
+            {
+                return messageAwaiter || messagesAwaiter;
+            }
+
+            void resolve();
+        };
+
+        [[nodiscard]] Delivery push(RuntimeValue::Ptr);
+
+        [[nodiscard]] Delivery pushBinary(const BinaryMessageType& type, const void* data, size_t count);
 
         const eastl::string& getStreamName() const;
 
@@ -46,12 +70,28 @@ namespace nau
 
         void cancel(Error::Ptr error, bool unregisterStream);
 
+        void cancelMessages(Error::Ptr error);
+
+        bool hasMessages() const;
+
+        RuntimeValue::Ptr popBinaryMessage();
+
         AsyncMessageSourceImpl* m_source;
         eastl::string m_streamName;
         std::mutex m_mutex;
 
         async::TaskSource<RuntimeValue::Ptr> m_awaiter = nullptr;
-        eastl::list<RuntimeValue::Ptr> m_messages;
+        async::TaskSource<> m_messagesAwaiter = nullptr;
+        // Taken messages are tracked by the read offset, so the queue memory is reused instead of allocating a node per message.
+        // The taken prefix is released when the queue is drained or the offset passes the half of the queue.
+        eastl::vector<RuntimeValue::Ptr> m_messages;
+        size_t m_messagesReadOffset = 0;
+
+        // Binary messages are appended as is, taken messages are tracked by the read offset.
+        // takeMessages() swaps the buffer with the receiver's one: the memory is reused and the messages are not copied again.
+        BinaryMessages m_binaryMessages;
+        size_t m_binaryReadOffset = 0;
+
         bool m_isCancelled = false;
     };
 
@@ -35,7 +35,9 @@ namespace nau
 
             RuntimeObjectRegistry::setDefaultInstance();
             ITimerManager::setDefaultInstance();
-            m_defaultAsyncExecutor = createThreadPoolExecutor();
+            // Work stealing pool keeps the coroutine continuations on the worker that produced them
+            // and lets the parallel engine passes (scene update, culling, animation) use all cores.
+            m_defaultAsyncExecutor = createWorkStealingThreadPoolExecutor();
             Executor::setDefault(m_defaultAsyncExecutor);
         }
 
@@ -0,0 +1,152 @@
+// test_frustum_batch.cpp
+//
+// Copyright (c) N-GINN LLC., 2023-2025. All rights reserved.
+//
+
+#include "nau/math/dag_frustum.h"
+#include "nau/math/math.h"
+
+#include <bit>
+
+namespace nau::test
+{
+    namespace
+    {
+        struct SpheresSoA
+        {
+            std::vector<float> centerX;
+            std::vector<float> centerY;
+            std::vector<float> centerZ;
+            std::vector<float> radius;
+        };
+
+        SpheresSoA makeRandomSpheres(size_t count, float extent)
+        {
+            std::mt19937 generator{12345};
+            std::uniform_real_distribution<float> position{-extent, extent};
+            std::uniform_real_distribution<float> radius{0.5f, 5.f};
+
+            SpheresSoA spheres;
+            spheres.centerX.reserve(count);
+            spheres.centerY.reserve(count);
+            spheres.centerZ.reserve(count);
+            spheres.radius.reserve(count);
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                spheres.centerX.push_back(position(generator));
+                spheres.centerY.push_back(position(generator));
+                spheres.centerZ.push_back(position(generator));
+                spheres.radius.push_back(radius(generator));
+            }
+
+            return spheres;
+        }
+
+        math::NauFrustum makeCameraFrustum()
+        {
+            using namespace nau::math;
+
+            const Matrix4 view = Matrix4::lookAtRH(Point3(0.f, 0.f, 0.f), Point3(1.f, 0.f, -1.f), Vector3(0.f, 1.f, 0.f));
+            const Matrix4 proj = Matrix4::perspectiveRH(1.0472f /* 60 degrees */, 9.f / 16.f, 0.1f, 150.f);
+
+            return NauFrustum{proj * view};
+        }
+
+        bool isVisible(const std::vector<uint32_t>& visibilityBits, size_t index)
+        {
+            return (visibilityBits[index / 32] & (1u << (index % 32))) != 0;
+        }
+
+        // the tests may round differently for the spheres that are touching a plane
+        bool isTouchingPlane(const math::NauFrustum& frustum, const math::Vector3& center, float radius)
+        {
+            for (const math::Vector4& plane : frustum.camPlanes)
+            {
+                const float distance = static_cast<float>(math::dot(plane.getXYZ(), center)) + static_cast<float>(plane.getW()) + radius;
+                if (std::abs(distance) < 1e-3f)
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+    }  // namespace
+
+    /**
+        Test: the batched test must give the same result as the single sphere test, including the last incomplete word.
+     */
+    TEST(TestFrustum, BatchedSpheresMatchSingleTest)
+    {
+        using namespace nau::math;
+
+        const NauFrustum frustum = makeCameraFrustum();
+
+        for (const size_t count : {1, 3, 4, 31, 32, 33, 1001})
+        {
+            const SpheresSoA spheres = makeRandomSpheres(count, 100.f);
+            std::vector<uint32_t> visibilityBits((count + 31) / 32, ~0u);
+
+            frustum.testSpheresB(spheres.centerX.data(), spheres.centerY.data(), spheres.centerZ.data(), spheres.radius.data(), count, visibilityBits.data());
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                const Vector3 center{spheres.centerX[i], spheres.centerY[i], spheres.centerZ[i]};
+                if (isTouchingPlane(frustum, center, spheres.radius[i]))
+                {
+                    continue;
+                }
+
+                const bool expected = frustum.testSphereB(center, Vector4{spheres.radius[i]}) != 0;
+                ASSERT_EQ(isVisible(visibilityBits, i), expected) << "count: " << count << ", sphere: " << i;
+            }
+
+            const size_t tailBits = count % 32;
+            if (tailBits != 0)
+            {
+                ASSERT_EQ(visibilityBits.back() >> tailBits, 0u);
+            }
+        }
+    }
+
+    /**
+        Test: the batched culling of 100k instances must give the same visibility as the single sphere test of every instance.
+     */
+    TEST(TestFrustum, BatchedSpheresMatchSingleTestLargeSet)
+    {
+        using namespace nau::math;
+
+        constexpr size_t InstancesCount = 100'000;
+
+        const NauFrustum frustum = makeCameraFrustum();
+        const SpheresSoA spheres = makeRandomSpheres(InstancesCount, 200.f);
+
+        std::vector<uint32_t> visibilityBits((InstancesCount + 31) / 32);
+        frustum.testSpheresB(spheres.centerX.data(), spheres.centerY.data(), spheres.centerZ.data(), spheres.radius.data(),
+                             InstancesCount, visibilityBits.data());
+
+        size_t singleVisibleCount = 0;
+        for (size_t i = 0; i < InstancesCount; ++i)
+        {
+            const BSphere3 sphere{Vector3{spheres.centerX[i], spheres.centerY[i], spheres.centerZ[i]}, spheres.radius[i]};
+            const bool expected = frustum.testSphereB(sphere.c, Vector4{sphere.r}) != 0;
+            singleVisibleCount += expected ? 1 : 0;
+
+            if (!isTouchingPlane(frustum, sphere.c, sphere.r))
+            {
+                ASSERT_EQ(isVisible(visibilityBits, i), expected) << "sphere: " << i;
+            }
+        }
+
+        size_t batchVisibleCount = 0;
+        for (const uint32_t bits : visibilityBits)
+        {
+            batchVisibleCount += std::popcount(bits);
+        }
+
+        ASSERT_NEAR(static_cast<double>(batchVisibleCount), static_cast<double>(singleVisibleCount), 2.0);
+        ASSERT_GT(batchVisibleCount, 0u);
+        ASSERT_LT(batchVisibleCount, InstancesCount);
+    }
+}  // namespace nau::test
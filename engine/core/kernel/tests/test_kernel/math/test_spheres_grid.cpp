@@ -0,0 +1,200 @@
+// test_spheres_grid.cpp
+//
+// Copyright (c) N-GINN LLC., 2023-2025. All rights reserved.
+//
+
+#include "nau/math/dag_frustum.h"
+#include "nau/math/math.h"
+#include "nau/math/spheres_grid.h"
+
+#include <bit>
+#include <numeric>
+
+namespace nau::test
+{
+    namespace
+    {
+        struct SyntheticLights
+        {
+            std::vector<math::Vector3> center;
+            std::vector<float> radius;
+        };
+
+        SyntheticLights makeRandomLights(size_t count, float extent, uint32_t seed)
+        {
+            std::mt19937 generator{seed};
+            std::uniform_real_distribution<float> position{-extent, extent};
+            std::uniform_real_distribution<float> radius{1.f, 15.f};
+
+            SyntheticLights lights;
+            lights.center.reserve(count);
+            lights.radius.reserve(count);
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                lights.center.emplace_back(position(generator), position(generator) * 0.1f, position(generator));
+                lights.radius.push_back(radius(generator));
+            }
+
+            return lights;
+        }
+
+        math::NauFrustum makeCameraFrustum()
+        {
+            using namespace nau::math;
+
+            const Matrix4 view = Matrix4::lookAtRH(Point3(0.f, 2.f, 0.f), Point3(1.f, 2.f, -1.f), Vector3(0.f, 1.f, 0.f));
+            const Matrix4 proj = Matrix4::perspectiveRH(1.0472f /* 60 degrees */, 9.f / 16.f, 0.1f, 300.f);
+
+            return NauFrustum{proj * view};
+        }
+
+        bool isVisible(const std::vector<uint32_t>& visibilityBits, size_t index)
+        {
+            return (visibilityBits[index / 32] & (1u << (index % 32))) != 0;
+        }
+
+        // the batched test may round differently for the spheres that are touching a plane
+        bool isTouchingPlane(const math::NauFrustum& frustum, const math::Vector3& center, float radius)
+        {
+            for (const math::Vector4& plane : frustum.camPlanes)
+            {
+                const float distance = static_cast<float>(math::dot(plane.getXYZ(), center)) + static_cast<float>(plane.getW()) + radius;
+                if (std::abs(distance) < 1e-3f)
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        void moveLights(math::SpheresGrid& grid, SyntheticLights& lights, size_t firstLight, size_t count, std::mt19937& generator)
+        {
+            std::uniform_real_distribution<float> offset{-2.f, 2.f};
+
+            for (size_t i = firstLight; i < firstLight + count && i < lights.center.size(); ++i)
+            {
+                lights.center[i] += math::Vector3{offset(generator), 0.f, offset(generator)};
+                grid.update(static_cast<uint32_t>(i), lights.center[i], lights.radius[i]);
+            }
+        }
+    }  // namespace
+
+    /**
+        Test: the grid culling must give the same result as the single sphere test after the spheres are moved and removed.
+     */
+    TEST(TestSpheresGrid, CullMatchesSingleTest)
+    {
+        using namespace nau::math;
+
+        constexpr size_t LightsCount = 2048;
+
+        const NauFrustum frustum = makeCameraFrustum();
+        SyntheticLights lights = makeRandomLights(LightsCount, 300.f, 12345);
+        std::mt19937 generator{54321};
+
+        SpheresGrid grid{16.f};
+        for (size_t i = 0; i < LightsCount; ++i)
+        {
+            grid.update(static_cast<uint32_t>(i), lights.center[i], lights.radius[i]);
+        }
+
+        std::vector<uint32_t> visibilityBits(LightsCount / 32, ~0u);
+
+        for (size_t step = 0; step < 10; ++step)
+        {
+            moveLights(grid, lights, step * 100, 500, generator);
+
+            // removed lights are kept with the zero radius to be skipped by the check below
+            for (size_t i = step; i < LightsCount; i += 97)
+            {
+                lights.radius[i] = 0.f;
+                grid.remove(static_cast<uint32_t>(i));
+            }
+
+            const size_t visibleCount = grid.cull(frustum, visibilityBits.data(), visibilityBits.size());
+            ASSERT_EQ(visibleCount, std::accumulate(visibilityBits.begin(), visibilityBits.end(), size_t(0), [](size_t sum, uint32_t bits)
+            {
+                return sum + std::popcount(bits);
+            }));
+
+            for (size_t i = 0; i < LightsCount; ++i)
+            {
+                if (lights.radius[i] <= 0.f)
+                {
+                    ASSERT_FALSE(isVisible(visibilityBits, i)) << "removed light: " << i;
+                    continue;
+                }
+
+                if (isTouchingPlane(frustum, lights.center[i], lights.radius[i]))
+                {
+                    continue;
+                }
+
+                const bool expected = frustum.testSphereB(lights.center[i], Vector4{lights.radius[i]}) != 0;
+                ASSERT_EQ(isVisible(visibilityBits, i), expected) << "step: " << step << ", light: " << i;
+            }
+        }
+
+        grid.clear();
+        ASSERT_EQ(grid.getSpheresCount(), 0u);
+        ASSERT_EQ(grid.getCellsCount(), 0u);
+    }
+
+    /**
+        Test: the culling of the synthetic lights, a tenth of which move every frame:
+        the grid culling with the incremental update and the batched test must agree with the single sphere test on every frame.
+     */
+    TEST(TestSpheresGrid, LightsCullingMatchesOnMovingLights)
+    {
+        using namespace nau::math;
+
+        constexpr size_t LightsCount = 8192;
+        constexpr size_t MovedLightsCount = LightsCount / 10;
+        constexpr size_t FramesCount = 50;
+
+        const NauFrustum frustum = makeCameraFrustum();
+        SyntheticLights lights = makeRandomLights(LightsCount, 1000.f, 12345);
+        std::mt19937 generator{54321};
+
+        SpheresGrid grid{32.f};
+        for (size_t i = 0; i < LightsCount; ++i)
+        {
+            grid.update(static_cast<uint32_t>(i), lights.center[i], lights.radius[i]);
+        }
+
+        std::vector<uint32_t> gridVisibilityBits(LightsCount / 32);
+        std::vector<uint32_t> batchVisibilityBits(LightsCount / 32);
+        std::vector<float> centerX(LightsCount), centerY(LightsCount), centerZ(LightsCount);
+
+        for (size_t frame = 0; frame < FramesCount; ++frame)
+        {
+            moveLights(grid, lights, (frame * MovedLightsCount) % LightsCount, MovedLightsCount, generator);
+
+            const size_t gridVisibleCount = grid.cull(frustum, gridVisibilityBits.data(), gridVisibilityBits.size());
+            ASSERT_GT(gridVisibleCount, 0u);
+            ASSERT_LT(gridVisibleCount, LightsCount);
+
+            for (size_t i = 0; i < LightsCount; ++i)
+            {
+                centerX[i] = lights.center[i].getX();
+                centerY[i] = lights.center[i].getY();
+                centerZ[i] = lights.center[i].getZ();
+            }
+            frustum.testSpheresB(centerX.data(), centerY.data(), centerZ.data(), lights.radius.data(), LightsCount, batchVisibilityBits.data());
+
+            for (size_t i = 0; i < LightsCount; ++i)
+            {
+                if (isTouchingPlane(frustum, lights.center[i], lights.radius[i]))
+                {
+                    continue;
+                }
+
+                const bool expected = frustum.testSphereB(lights.center[i], Vector4{lights.radius[i]}) != 0;
+                ASSERT_EQ(isVisible(gridVisibilityBits, i), expected) << "frame: " << frame << ", light: " << i;
+                ASSERT_EQ(isVisible(batchVisibilityBits, i), expected) << "frame: " << frame << ", light: " << i;
+            }
+        }
+    }
+}  // namespace nau::test
@@ -452,6 +452,67 @@ namespace nau::test
         }
     }
 
+    /**
+        Test: posting by the stream name and by the pre-registered stream key delivers every message to every receiver.
+        Once the receivers queues are large enough the posting does not allocate:
+        takeMessages() swaps the queue with the receiver's buffer, so the same two buffers are reused round after round.
+    */
+    TEST_F(Test_AsyncMessageStream, PostReusesReceiversQueues)
+    {
+        constexpr size_t ReceiversCount = 8;
+        constexpr size_t PostsCount = 1000;
+        constexpr size_t RoundsCount = 6;
+
+        const MessageStreamKey streamKey{TestStream1Name};
+
+        struct Receiver
+        {
+            AsyncMessageStream stream;
+            eastl::vector<RuntimeValue::Ptr> messages;
+            BinaryMessages binaryMessages;
+            eastl::vector<const RuntimeValue::Ptr*> takenBuffers;
+        };
+
+        eastl::vector<Receiver> receivers(ReceiversCount);
+        for(Receiver& receiver : receivers)
+        {
+            receiver.stream = broadcaster().getStream(TestStream1Name);
+        }
+
+        for(size_t round = 0; round < RoundsCount; ++round)
+        {
+            for(size_t i = 0; i < PostsCount; ++i)
+            {
+                if(round % 2 == 0)
+                {
+                    broadcaster().post(streamKey);
+                }
+                else
+                {
+                    broadcaster().post(TestStream1Name);
+                }
+            }
+
+            for(Receiver& receiver : receivers)
+            {
+                receiver.stream.takeMessages(receiver.messages, receiver.binaryMessages);
+                ASSERT_EQ(receiver.messages.size(), PostsCount);
+                ASSERT_EQ(receiver.binaryMessages.count, 0);
+                receiver.takenBuffers.push_back(receiver.messages.data());
+            }
+        }
+
+        for(const Receiver& receiver : receivers)
+        {
+            for(size_t round = 2; round < RoundsCount; ++round)
+            {
+                ASSERT_EQ(receiver.takenBuffers[round], receiver.takenBuffers[round - 2]) << "round: " << round;
+            }
+        }
+
+        ASSERT_TRUE(broadcaster().hasSubscribers(streamKey));
+    }
+
     // TEST_F(Test_MessageStream, SubscribeAsTask) {
     //
     //	AsyncMessageSource::Ptr broadcaster = AsyncMessageSource::Create();
@@ -141,4 +141,81 @@ namespace nau::test
         ASSERT_EQ(receivedValue, ExpectedValue);
     }
 
+    TEST_F(Test_Messaging, PostBatchTypedMessages)
+    {
+        constexpr unsigned MessagesCount = 10'000;
+
+        threading::Event signal;
+        unsigned receivedCount = 0;
+        bool isOrdered = true;
+
+        auto subscription = TestTypesMessage.subscribe(broadcaster(), [&](const MessageData& msg)
+        {
+            isOrdered = isOrdered && msg.id == receivedCount;
+            if(++receivedCount == MessagesCount)
+            {
+                signal.set();
+            }
+        }, async::Executor::getDefault());
+
+        // Receiver that consumes the binary messages as RuntimeValue.
+        AsyncMessageStream stream = broadcaster().getStream(TestTypesMessage.getStreamName());
+
+        eastl::vector<MessageData> messages(MessagesCount);
+        for(unsigned i = 0; i < MessagesCount; ++i)
+        {
+            messages[i].id = i;
+        }
+
+        TestTypesMessage.postBatch(broadcaster(), {messages.data(), messages.size()});
+
+        signal.wait();
+
+        ASSERT_EQ(receivedCount, MessagesCount);
+        ASSERT_TRUE(isOrdered);
+
+        for(unsigned i = 0; i < 3; ++i)
+        {
+            auto message = stream.getNextMessage();
+            ASSERT_TRUE(message.isReady());
+
+            auto data = nau::runtimeValueCast<MessageData>(*std::move(message));
+            ASSERT_TRUE(data);
+            ASSERT_EQ(data->id, i);
+        }
+    }
+
+    /**
+        Test: the binary type made by another module is a different instance with the same type info,
+        the stream must accept both of them as the same type.
+        The trivially copyable message posted with post() must go through the RuntimeValue queue.
+    */
+    TEST_F(Test_Messaging, BinaryMessageTypeIsKeyedByTypeInfo)
+    {
+        const BinaryMessageType& type = getBinaryMessageType<MessageData>();
+        const BinaryMessageType otherModuleType = type;
+
+        AsyncMessageStream stream = broadcaster().getStream(TestTypesMessage.getStreamName());
+
+        MessageData message;
+        message.id = 1;
+        broadcaster().postBatch(TestTypesMessage.getStreamKey(), type, &message, 1);
+        message.id = 2;
+        broadcaster().postBatch(TestTypesMessage.getStreamKey(), otherModuleType, &message, 1);
+        message.id = 3;
+        TestTypesMessage.post(broadcaster(), message);
+
+        eastl::vector<RuntimeValue::Ptr> messages;
+        BinaryMessages binaryMessages;
+        stream.takeMessages(messages, binaryMessages);
+
+        ASSERT_EQ(binaryMessages.count, 2);
+        ASSERT_TRUE(binaryMessages.type->typeInfo == rtti::getTypeInfo<MessageData>());
+
+        ASSERT_EQ(messages.size(), 1);
+        auto data = nau::runtimeValueCast<MessageData>(messages.front());
+        ASSERT_TRUE(data);
+        ASSERT_EQ(data->id, 3);
+    }
+
 }  // namespace nau::test
@@ -9,6 +9,8 @@
 #include "nau/memory/stack_allocator.h"
 #include "nau/memory/general_allocator.h"
 #include "nau/memory/eastl_aliases.h"
+#include "nau/memory/memory_statistics.h"
+#include "nau/io/stream_utils.h"
 #include "nau/memory/nau_allocator_wrapper.h"
 #include "nau/memory/platform/aligned_allocator_windows.h"
 
@@ -287,6 +289,86 @@ namespace nau::test
         }
     }
 
+    TEST(TestAllocator, FixedBlockAllocatorCrossThreadFree)
+    {
+        // Dedicated size class: the blocks are not shared with the other tests.
+        using Allocator = FixedBlocksAllocator<48>;
+        constexpr size_t BlocksCount = 1000;
+
+        const auto statisticsBefore = Allocator::instance().getStatistics();
+
+        std::vector<void*> blocks;
+        std::promise<void> blocksAllocated;
+        std::promise<void> blocksFreed;
+        bool blockReused = false;
+
+        std::thread producer([&]
+            {
+                for (size_t i = 0; i < BlocksCount; ++i)
+                    blocks.push_back(Allocator::instance().allocate(48));
+                blocksAllocated.set_value();
+
+                // Blocks freed by the consumer must return to the producer.
+                blocksFreed.get_future().wait();
+                void* block = Allocator::instance().allocate(48);
+                blockReused = std::find(blocks.begin(), blocks.end(), block) != blocks.end();
+                Allocator::instance().deallocate(block);
+            });
+
+        blocksAllocated.get_future().wait();
+        for (void* block : blocks)
+            Allocator::instance().deallocate(block);
+        blocksFreed.set_value();
+        producer.join();
+
+        const auto statistics = Allocator::instance().getStatistics();
+        EXPECT_TRUE(blockReused);
+        EXPECT_EQ(statistics.crossThreadFrees - statisticsBefore.crossThreadFrees, BlocksCount);
+        EXPECT_GT(statistics.remoteFreeDrains, statisticsBefore.remoteFreeDrains);
+    }
+
+    TEST(TestAllocator, MemoryStatistics)
+    {
+        using Allocator = FixedBlocksAllocator<80>;
+        constexpr size_t BlocksCount = 100;
+
+        const auto statisticsBefore = Allocator::instance().getStatistics();
+
+        std::vector<void*> blocks;
+        for (size_t i = 0; i < BlocksCount; ++i)
+            blocks.push_back(Allocator::instance().allocate(80));
+
+        const auto statistics = Allocator::instance().getStatistics();
+        EXPECT_EQ(statistics.liveBlocks - statisticsBefore.liveBlocks, BlocksCount);
+        EXPECT_EQ(statistics.liveBytes - statisticsBefore.liveBytes, BlocksCount * 80);
+        EXPECT_GT(statistics.slabsCount, 0);
+        EXPECT_GE(statistics.reservedBytes, statistics.liveBytes);
+
+        for (void* block : blocks)
+            Allocator::instance().deallocate(block);
+
+        const auto statisticsAfter = Allocator::instance().getStatistics();
+        EXPECT_EQ(statisticsAfter.liveBlocks, statisticsBefore.liveBlocks);
+        // The peak is published in batches, so it may lag behind the real one by at most a batch.
+        EXPECT_GE(statisticsAfter.peakBlocks + Allocator::PeakSyncBlocks, statisticsBefore.liveBlocks + BlocksCount);
+        EXPECT_GT(statisticsAfter.peakBlocks, statisticsAfter.liveBlocks);
+        EXPECT_EQ(statisticsAfter.peakBytes, statisticsAfter.peakBlocks * 80);
+
+        const MemoryStatistics memoryStatistics = getMemoryStatistics();
+        ASSERT_EQ(memoryStatistics.sizeClasses.size(), GeneralAllocator::SizeClassesCount);
+        EXPECT_TRUE(std::any_of(memoryStatistics.sections.begin(), memoryStatistics.sections.end(), [](const HeapAllocator::SectionStatistics& section)
+            {
+                return section.kind == "FixedBlocksAllocator<80>" && section.reservedBytes >= section.usedBytes && section.usedBytes > 0 &&
+                       section.peakUsedBytes >= section.usedBytes;
+            }));
+
+        eastl::u8string json;
+        io::InplaceStringWriter<char8_t> writer{json};
+        ASSERT_TRUE(writeMemoryStatistics(writer, false));
+        EXPECT_NE(json.find(u8"sizeClasses"), eastl::u8string::npos);
+        EXPECT_NE(json.find(u8"FixedBlocksAllocator<80>"), eastl::u8string::npos);
+    }
+
     namespace
     {
         template<class alignedAllocatorBase>
@@ -411,6 +493,36 @@ namespace nau::test
         }
     }
 
+    TEST(TestAllocator, FrameAllocatorFramesInFlight)
+    {
+        FrameAllocator allocator(2);
+        EXPECT_EQ(allocator.getFramesInFlight(), 2);
+
+        auto* firstFrameData = static_cast<int*>(allocator.allocateHeaderless(sizeof(int) * 16, 64));
+        EXPECT_TRUE(isAligned(firstFrameData, 64));
+        for (int i = 0; i < 16; ++i)
+            firstFrameData[i] = i;
+
+        void* tracked = allocator.allocate(24);
+        EXPECT_TRUE(isAligned(tracked, alignof(std::max_align_t)));
+        EXPECT_EQ(allocator.getSize(tracked), 24);
+
+        // The first frame is still in flight: its memory is neither reused nor required to be deallocated.
+        EXPECT_TRUE(allocator.prepareFrame());
+        auto* secondFrameData = static_cast<int*>(allocator.allocateHeaderless(sizeof(int) * 16, 64));
+        for (int i = 0; i < 16; ++i)
+            secondFrameData[i] = -1;
+
+        for (int i = 0; i < 16; ++i)
+            EXPECT_EQ(firstFrameData[i], i);
+
+        allocator.deallocate(tracked);
+
+        // The first frame is retired and its memory is reused.
+        EXPECT_TRUE(allocator.prepareFrame());
+        EXPECT_EQ(allocator.allocateHeaderless(sizeof(int) * 16, 64), firstFrameData);
+    }
+
     TEST(TestAllocator, MultiThread)
     {
         StackAllocatorUnnamed;
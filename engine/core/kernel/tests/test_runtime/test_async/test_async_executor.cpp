@@ -59,6 +59,75 @@ namespace nau::test
         ASSERT_THAT(counter, Eq(JobsCount));
     }
 
+    /**
+        Invocations scheduled from the executor's own threads (continuations) must be processed the same way as the external ones.
+     */
+    TEST_P(TestAsyncExecutor, ExecuteNested)
+    {
+        constexpr size_t OuterJobsCount = 1'000;
+        constexpr size_t InnerJobsCount = 100;
+
+        struct State
+        {
+            async::Executor* executor = nullptr;
+            std::atomic_size_t counter = 0;
+        } state;
+
+        auto executor = createExecutor();
+        state.executor = executor.get();
+
+        for(size_t i = 0; i < OuterJobsCount; ++i)
+        {
+            executor->execute([](void* statePtr, void*) noexcept
+                            {
+                                auto& state = *reinterpret_cast<State*>(statePtr);
+                                for(size_t j = 0; j < InnerJobsCount; ++j)
+                                {
+                                    state.executor->execute([](void* counterPtr, void*) noexcept
+                                                            {
+                                                                reinterpret_cast<std::atomic_size_t*>(counterPtr)->fetch_add(1);
+                                                            },
+                                                            &state.counter);
+                                }
+                            },
+                            &state);
+        }
+
+        waitWorks(executor);
+
+        ASSERT_THAT(state.counter, Eq(OuterJobsCount * InnerJobsCount));
+    }
+
+    /**
+        Timed wait must fail while the invocation is running and succeed right after it completes.
+     */
+    TEST_P(TestAsyncExecutor, WaitAnyActivityWithTimeout)
+    {
+        std::atomic_bool canComplete = false;
+
+        auto executor = createExecutor();
+        executor->execute([](void* flagPtr, void*) noexcept
+                          {
+                              auto& canComplete = *reinterpret_cast<std::atomic_bool*>(flagPtr);
+                              while(!canComplete)
+                              {
+                                  std::this_thread::yield();
+                              }
+                          },
+                          &canComplete);
+
+        ASSERT_FALSE(executor->waitAnyActivityFor(10ms));
+        ASSERT_THAT(executor->getStatistics().pendingCount, Eq(1));
+
+        canComplete = true;
+        ASSERT_TRUE(executor->waitAnyActivityFor(5s));
+
+        const auto statistics = executor->getStatistics();
+        ASSERT_THAT(statistics.pendingCount, Eq(0));
+        ASSERT_THAT(statistics.scheduledCount, Eq(1));
+        ASSERT_THAT(statistics.threadsCount, Gt(0));
+    }
+
     const ExecutorFactory createDefaultPoolExecutor = []
     {
         return async::createThreadPoolExecutor();
@@ -70,8 +139,13 @@ namespace nau::test
         return async::createThreadPoolExecutor();
     };
 
+    const ExecutorFactory createWorkStealingPoolExecutor = []
+    {
+        return async::createWorkStealingThreadPoolExecutor();
+    };
+
     INSTANTIATE_TEST_SUITE_P(Default,
                              TestAsyncExecutor,
-                             testing::Values(createDefaultPoolExecutor, createDagPoolExecutor));
+                             testing::Values(createDefaultPoolExecutor, createDagPoolExecutor, createWorkStealingPoolExecutor));
 
 }  // namespace nau::test
@@ -0,0 +1,133 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+// test_parallel_for.cpp
+
+
+#include "nau/async/parallel_for.h"
+#include "nau/async/thread_pool_executor.h"
+
+
+namespace nau::test
+{
+    using namespace testing;
+
+    /**
+        Test: every chunk is processed exactly once, the worker index is within the workers count.
+     */
+    TEST(TestParallelFor, ProcessesAllChunks)
+    {
+        constexpr size_t ChunksCount = 1000;
+
+        auto executor = async::createWorkStealingThreadPoolExecutor(4);
+        threading::Event helpersCompleted;
+
+        for (size_t iteration = 0; iteration < 10; ++iteration)
+        {
+            std::vector<std::atomic<size_t>> processedCount(ChunksCount);
+            std::atomic<size_t> invalidWorkersCount = 0;
+
+            async::ParallelFor parallelFor{executor.get(), ChunksCount};
+            ASSERT_THAT(parallelFor.getWorkersCount(), Gt(1));
+
+            const size_t workersCount = parallelFor.getWorkersCount();
+            parallelFor.run([&](size_t chunk, size_t workerIndex)
+            {
+                processedCount[chunk].fetch_add(1);
+                if (workerIndex >= workersCount)
+                {
+                    invalidWorkersCount.fetch_add(1);
+                }
+            }, helpersCompleted);
+
+            ASSERT_THAT(invalidWorkersCount.load(), Eq(0));
+            for (const std::atomic<size_t>& count : processedCount)
+            {
+                ASSERT_THAT(count.load(), Eq(1));
+            }
+        }
+
+        executor->waitAnyActivity();
+    }
+
+    /**
+        Test: without the executor (or with the helpers disabled) the chunks are processed by the calling thread in order.
+     */
+    TEST(TestParallelFor, RunsInlineWithoutHelpers)
+    {
+        constexpr size_t ChunksCount = 100;
+
+        auto executor = async::createWorkStealingThreadPoolExecutor(4);
+        threading::Event helpersCompleted;
+
+        for (async::Executor* const parallelExecutor : {static_cast<async::Executor*>(nullptr), executor.get()})
+        {
+            async::ParallelFor parallelFor{parallelExecutor, ChunksCount, 0};
+            ASSERT_THAT(parallelFor.getWorkersCount(), Eq(1));
+
+            const auto callerThreadId = std::this_thread::get_id();
+            std::vector<size_t> chunks;
+            bool isCallerThread = true;
+
+            parallelFor.run([&](size_t chunk, size_t workerIndex)
+            {
+                chunks.push_back(chunk);
+                isCallerThread = isCallerThread && workerIndex == 0 && std::this_thread::get_id() == callerThreadId;
+            }, helpersCompleted);
+
+            ASSERT_TRUE(isCallerThread);
+            ASSERT_THAT(chunks.size(), Eq(ChunksCount));
+            ASSERT_TRUE(std::is_sorted(chunks.begin(), chunks.end()));
+        }
+    }
+
+    /**
+        Test: called from the executor's own thread the chunks are processed inline
+        (a single thread executor would be deadlocked waiting for the helpers queued behind the caller).
+     */
+    TEST(TestParallelFor, RunsInlineOnExecutorThread)
+    {
+        using namespace std::chrono_literals;
+
+        constexpr size_t ChunksCount = 100;
+
+        auto executor = async::createWorkStealingThreadPoolExecutor(1);
+        threading::Event helpersCompleted;
+        threading::Event completed;
+        size_t workersCount = 0;
+        size_t processedCount = 0;
+
+        auto runParallelFor = [&]
+        {
+            async::ParallelFor parallelFor{executor.get(), ChunksCount};
+            workersCount = parallelFor.getWorkersCount();
+            parallelFor.run([&](size_t, size_t)
+            {
+                ++processedCount;
+            }, helpersCompleted);
+
+            completed.set();
+        };
+
+        executor->execute([](void* func, void*) noexcept
+        {
+            (*reinterpret_cast<decltype(runParallelFor)*>(func))();
+        }, &runParallelFor);
+
+        ASSERT_TRUE(completed.wait(5s));
+        ASSERT_THAT(workersCount, Eq(1));
+        ASSERT_THAT(processedCount, Eq(ChunksCount));
+
+        executor->waitAnyActivity();
+    }
+
+    /**
+        Test: a single chunk is never split between the threads.
+     */
+    TEST(TestParallelFor, SingleChunk)
+    {
+        auto executor = async::createWorkStealingThreadPoolExecutor(4);
+        async::ParallelFor parallelFor{executor.get(), 1};
+
+        ASSERT_THAT(parallelFor.getWorkersCount(), Eq(1));
+    }
+}  // namespace nau::test
@@ -4,6 +4,9 @@
 
 #pragma once
 
+#include <EASTL/unique_ptr.h>
+
+#include "nau/app/main_loop/game_system.h"
 #include "nau/scene/components/component.h"
 #include "nau/scene/components/component_life_cycle.h"
 #include "nau/scene/scene_processor.h"
@@ -11,16 +14,22 @@
 
 namespace nau::animation
 {
+    class SkeletalAnimationPipeline;
+
     class NAU_ANIMATION_EXPORT AnimationSceneProcessor final : public IRefCounted,
                                                                public scene::ISceneProcessor,
                                                                public scene::IComponentsAsyncActivator,
-                                                               public IServiceInitialization
+                                                               public IServiceInitialization,
+                                                               public IGamePreUpdate,
+                                                               public IGamePostUpdate
     {
         NAU_CLASS_(AnimationSceneProcessor,
                    IRefCounted,
                    scene::ISceneProcessor,
                    scene::IComponentsAsyncActivator,
-                   IServiceInitialization)
+                   IServiceInitialization,
+                   IGamePreUpdate,
+                   IGamePostUpdate)
 
     public:
         AnimationSceneProcessor();
@@ -32,7 +41,22 @@ namespace nau::animation
 
         async::Task<> activateComponentsAsync(Uid worldUid, eastl::span<const scene::Component*> components, async::Task<> barrier) override;
 
+        async::Task<> deactivateComponentsAsync(Uid worldUid, eastl::span<const scene::DeactivatedComponentData> components) override;
+
         void syncSceneState() override;
+
+        /**
+         * @brief Selects the animation LOD of the skeletons from the main camera.
+         */
+        void gamePreUpdate(std::chrono::milliseconds dt) override;
+
+        /**
+         * @brief Evaluates the skeleton poses requested within the scene update.
+         */
+        void gamePostUpdate(std::chrono::milliseconds dt) override;
+
+    private:
+        eastl::unique_ptr<SkeletalAnimationPipeline> m_skeletalPipeline;
     };
 
 }  // namespace nau::animation
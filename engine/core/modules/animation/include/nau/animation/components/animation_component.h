@@ -40,6 +40,28 @@ namespace nau::animation
         nau::WeakPtr<AnimationInstance> owningInstance;
     };
 
+    /**
+     * @brief Level of detail of the skeletal animation.
+     *
+     * It is selected every frame by the animation scene processor from the distance to the camera and the skeleton visibility.
+     */
+    struct AnimationLod
+    {
+        /**
+         * @brief The animation is advanced once per this amount of frames, the skeleton pose is interpolated in between.
+         *
+         * 0 means the animation is not advanced at all (i.e. the skeleton is not visible): the elapsed time is applied on the next update.
+         */
+        uint32_t updateInterval = 1;
+
+        /**
+         * @brief Amount of the skeleton joints (in the depth-first order) that are animated, the rest of the joints follow their parents in the rest pose.
+         *
+         * 0 means all the joints are animated.
+         */
+        uint32_t maxJointsCount = 0;
+    };
+
     /**
      * @brief Provides opportunity to animate properties of a target.
      */
@@ -151,6 +173,10 @@ namespace nau::animation
          */
         const eastl::string& getName() const;
 
+        void setLod(const AnimationLod& lod);
+
+        const AnimationLod& getLod() const;
+
     private:
         AnimationController* getOrCreateController();
 
@@ -190,5 +216,9 @@ namespace nau::animation
         std::vector<AnimationTargetData> m_targets;
         eastl::string m_name;
         TransformAnimationActionsFlag m_pendingTransforms = {};
+
+        AnimationLod m_lod;
+        uint32_t m_lodFrame = 0;
+        float m_lodSkippedTime = .0f;
     };
 }  // namespace nau::animation
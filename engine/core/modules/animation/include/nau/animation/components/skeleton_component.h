@@ -32,6 +32,11 @@ namespace nau
 
         ozz::animation::SamplingJob::Context animSamplingContext;
         ozz::vector<ozz::math::SoaTransform> locals;
+
+        // Sampling request recorded by SkeletalAnimation::apply, it is performed by the skeletal animation pipeline
+        const ozz::animation::Animation* sampledAnimation = nullptr;
+        float samplingRatio = .0f;
+        bool isSamplingPending = false;
     };
 
     struct SkeletalAnimRuntimeData final
@@ -40,6 +45,27 @@ namespace nau
 
         // Buffer of local transforms after blending is performed
         ozz::vector<ozz::math::SoaTransform> locals;
+
+        // Pose evaluation stages requested within the current update (see SkeletalAnimationPipeline)
+        bool isSamplingPending = false;
+        bool isBlendingPending = false;
+        bool isInterpolationPending = false;
+        bool isLocalToModelPending = false;
+
+        // Animation LOD (see animation::AnimationLod)
+        uint32_t lodUpdateInterval = 1;
+        uint32_t lodMaxJointsCount = 0;
+
+        // With the reduced update rate the pose is interpolated between the two last blended poses
+        ozz::vector<ozz::math::SoaTransform> interpolationFrom;
+        ozz::vector<ozz::math::SoaTransform> interpolationTo;
+        uint32_t framesSinceKeyPose = 0;
+        bool hasKeyPoses = false;
+
+        bool isPoseUpdatePending() const
+        {
+            return isSamplingPending || isBlendingPending || isInterpolationPending || isLocalToModelPending;
+        }
     };
 
     class NAU_ANIMATION_EXPORT SkeletonComponent : public scene::SceneComponent,
@@ -74,10 +100,29 @@ namespace nau
         const eastl::vector<SkeletonJoint>& getJoints() const;
         const eastl::vector<nau::math::Matrix4>& getInverseBindTransforms() const;
 
+        /**
+         * @brief Retrieves the default pose joint transforms relative to their parents (used by the joints that are not animated due to LOD).
+         */
+        const ozz::vector<ozz::math::Float4x4>& getDefaultPoseLocalJointMatrices() const;
+
         unsigned getBonesCount() const;
 
+        /**
+         * @brief Retrieves the model space matrices of the skeleton joints.
+         *
+         * The poses of all animated skeletons are evaluated in a batch after the scene update,
+         * so within the scene update it is the pose of the previous frame (see evaluatePendingPose).
+         */
         const ozz::vector<ozz::math::Float4x4>& getModelSpaceJointMatrices() const;
 
+        /**
+         * @brief Evaluates the pose requested within the current update in place, without waiting for the batch.
+         *
+         * Used by the components that depend on the current pose (i.e. the sockets).
+         * Must be called only from the scene update, while nothing else reads the skeleton.
+         */
+        void evaluatePendingPose();
+
         ozz::vector<ozz::math::Float4x4>& getModelSpaceJointMatricesMutable();
 
         SkeletalAnimRuntimeData& getAnimRuntimeDataMutable();
@@ -94,6 +139,8 @@ namespace nau
         // Buffer of model space matrices.
         ozz::vector<ozz::math::Float4x4> models;
 
+        ozz::vector<ozz::math::Float4x4> defaultPoseLocals;
+
         eastl::string m_name;
     };
 }  // namespace nau
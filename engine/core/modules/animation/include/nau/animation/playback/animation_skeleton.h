@@ -23,6 +23,12 @@ namespace nau::animation
         ozz::animation::Animation ozzAnimation;
     };
 
+    /**
+     * @brief Requests blending of the skeleton tracks and computing of the joints model space matrices.
+     *
+     * The jobs are not performed in place: the poses of all the skeletons are evaluated in parallel
+     * by the skeletal animation pipeline after the scene update.
+     */
      class NAU_ANIMATION_EXPORT SkeletalAnimationMixer : public AnimationMixer
      {
         NAU_CLASS_(nau::animation::SkeletalAnimationMixer, nau::animation::AnimationMixer, IRefCounted);
@@ -6,13 +6,19 @@
 
 #include "nau/animation/components/animation_component.h"
 #include "nau/animation/components/skeleton_component.h"
+#include "nau/app/global_properties.h"
 #include "nau/assets/asset_descriptor_factory.h"
 #include "nau/scene/scene_object.h"
 #include "nau/service/service_provider.h"
+#include "playback/skeletal_animation_pipeline.h"
 
 namespace nau::animation
 {
-    AnimationSceneProcessor::AnimationSceneProcessor() = default;
+    AnimationSceneProcessor::AnimationSceneProcessor() :
+        m_skeletalPipeline(eastl::make_unique<SkeletalAnimationPipeline>())
+    {
+    }
+
     AnimationSceneProcessor::~AnimationSceneProcessor() = default;
 
     async::Task<> AnimationSceneProcessor::initService()
@@ -22,6 +28,14 @@ namespace nau::animation
 
     async::Task<> AnimationSceneProcessor::preInitService()
     {
+        if (GlobalProperties* const properties = getServiceProvider().find<GlobalProperties>())
+        {
+            if (auto lodConfig = properties->getValue<AnimationLodConfig>("/animation/lod"))
+            {
+                m_skeletalPipeline->setLodConfig(*lodConfig);
+            }
+        }
+
         return async::makeResolvedTask();
     }
 
@@ -62,12 +76,38 @@ namespace nau::animation
                     SkeletonComponent* skeletonComponentNonConst = const_cast<SkeletonComponent*>(skeletonComponent);
                     animationComponent->addAnimationTarget(skeletonComponentNonConst);
                 }
+
+                m_skeletalPipeline->addSkeleton(const_cast<SkeletonComponent&>(*skeletonComponent), animationComponent);
+            }
+        }
+    }
+
+    async::Task<> AnimationSceneProcessor::deactivateComponentsAsync([[maybe_unused]] Uid worldUid, eastl::span<const scene::DeactivatedComponentData> components)
+    {
+        for (const scene::DeactivatedComponentData& data : components)
+        {
+            if (const auto* const skeletonComponent = data.component->as<const SkeletonComponent*>())
+            {
+                m_skeletalPipeline->removeSkeleton(*skeletonComponent);
             }
         }
+
+        return async::makeResolvedTask();
     }
 
     void AnimationSceneProcessor::syncSceneState()
     {
     }
 
+    void AnimationSceneProcessor::gamePreUpdate([[maybe_unused]] std::chrono::milliseconds dt)
+    {
+        m_skeletalPipeline->updateLods();
+    }
+
+    void AnimationSceneProcessor::gamePostUpdate([[maybe_unused]] std::chrono::milliseconds dt)
+    {
+        // Joint matrices are published before the scene state is synchronized with the render.
+        m_skeletalPipeline->update();
+    }
+
 }  // namespace nau::animation
@@ -14,6 +14,15 @@ namespace nau::animation
 {
     NAU_IMPLEMENT_DYNAMIC_OBJECT(AnimationComponent)
 
+    namespace
+    {
+        // Spreads the reduced rate updates of the different components over the frames.
+        std::atomic<uint32_t> g_lodFramePhase = 0;
+
+        // The time skipped by the animation LOD that is applied at once: a skeleton that was culled for long does not jump far ahead.
+        constexpr float MaxLodSkippedTime = 0.5f;
+    }  // namespace
+
     class AnimatableObjectTargetWrapper final : public IAnimationTarget
     {
         NAU_CLASS(nau::animation::AnimatableObjectTargetWrapper, rtti::RCPolicy::StrictSingleThread, IAnimationTarget)
@@ -41,7 +50,8 @@ namespace nau::animation
         scene::ObjectWeakRef<scene::NauObject> m_target;
     };
 
-    AnimationComponent::AnimationComponent()
+    AnimationComponent::AnimationComponent() :
+        m_lodFrame(g_lodFramePhase.fetch_add(1))
     {
         m_name = "Animation Component";
     }
@@ -87,9 +97,17 @@ namespace nau::animation
     {
         if (auto* controller = m_controller.get())
         {
+            const uint32_t updateInterval = m_lod.updateInterval;
+            if (updateInterval == 0 || (m_lodFrame++ % updateInterval) != 0)
+            {
+                // The time of the updates skipped by the animation LOD is applied at once by the next update.
+                m_lodSkippedTime = std::min(m_lodSkippedTime + dt, MaxLodSkippedTime);
+                return;
+            }
+
             m_frameTransform = m_rootTransform;
 
-            controller->update(dt, this);
+            controller->update(dt + std::exchange(m_lodSkippedTime, .0f), this);
 
             applyTransform();
         }
@@ -232,6 +250,16 @@ namespace nau::animation
         return m_name;
     }
 
+    void AnimationComponent::setLod(const AnimationLod& lod)
+    {
+        m_lod = lod;
+    }
+
+    const AnimationLod& AnimationComponent::getLod() const
+    {
+        return m_lod;
+    }
+
     void AnimationComponent::applyTransform()
     {
         if (m_pendingTransforms.has(TransformAnimationActions::Translation, TransformAnimationActions::Rotation, TransformAnimationActions::Scale))
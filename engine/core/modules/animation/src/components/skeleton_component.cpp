@@ -7,6 +7,7 @@
 #include <ozz/animation/runtime/local_to_model_job.h>
 #include <ozz/base/span.h>
 
+#include "../playback/skeletal_animation_pipeline.h"
 #include "nau/math/math.h"
 #include "nau/scene/scene_object.h"
 
@@ -50,6 +51,17 @@ namespace nau
         animRuntimeData.locals.resize(getSkeleton().num_soa_joints());
 
         setSkeletonToDefaultPose();
+
+        // Joints are stored in the depth-first order: a parent always precedes its children.
+        const eastl::vector<math::Matrix4>& bindPose = m_skeletonAssetView->getDefaultPoseTransforms();
+        const ozz::span<const int16_t> parents = getSkeleton().joint_parents();
+
+        defaultPoseLocals.resize(parents.size());
+        for (size_t i = 0; i < parents.size(); ++i)
+        {
+            const math::Matrix4 local = parents[i] >= 0 ? math::inverse(bindPose[parents[i]]) * bindPose[i] : bindPose[i];
+            std::memcpy(&defaultPoseLocals[i], &local, sizeof(local));
+        }
     }
 
     void SkeletonComponent::setSkeletonToDefaultPose()
@@ -58,6 +70,13 @@ namespace nau
 
         static_assert(sizeof(decltype(*models.data())) == sizeof(decltype(*bindPose.data())));
         std::memcpy(models.data(), bindPose.data(), getSkeleton().num_joints() * sizeof(decltype(*models.data())));
+
+        // The pose requested before must not override the default one.
+        animRuntimeData.isBlendingPending = false;
+        animRuntimeData.isInterpolationPending = false;
+        animRuntimeData.isLocalToModelPending = false;
+
+        notifyStateChanged();
     }
 
     const ozz::animation::Skeleton& SkeletonComponent::getSkeleton() const
@@ -75,11 +94,25 @@ namespace nau
         return m_skeletonAssetView->getInverseBindTransforms();
     }
 
+    const ozz::vector<ozz::math::Float4x4>& SkeletonComponent::getDefaultPoseLocalJointMatrices() const
+    {
+        return defaultPoseLocals;
+    }
+
     const ozz::vector<ozz::math::Float4x4>& SkeletonComponent::getModelSpaceJointMatrices() const
     {
         return models;
     }
 
+    void SkeletonComponent::evaluatePendingPose()
+    {
+        if (animRuntimeData.isPoseUpdatePending())
+        {
+            static thread_local animation::SkeletalPoseScratch scratch;
+            animation::SkeletalAnimationPipeline::evaluatePose(*this, scratch);
+        }
+    }
+
     ozz::vector<ozz::math::Float4x4>& SkeletonComponent::getModelSpaceJointMatricesMutable()
     {
         return models;
@@ -27,6 +27,8 @@ namespace nau
         {
             if (joints[jointIndex].jointName == m_boneName)
             {
+                // The batch evaluates the poses after the scene update: the socket follows the pose of the current frame.
+                skeletonComponent->evaluatePendingPose();
                 const auto& modelSpaceJointMatrices = skeletonComponent->getModelSpaceJointMatrices();
 
                 math::Matrix4 socketTransform;
@@ -6,19 +6,15 @@
 
 #include "animation_helper.h"
 
-#include <ozz/base/span.h>
 #include <ozz/base/maths/soa_transform.h>
-#include <ozz/base/maths/vec_float.h>
 #include <ozz/animation/runtime/sampling_job.h>
-#include <ozz/animation/runtime/blending_job.h>
-#include <ozz/animation/runtime/local_to_model_job.h>
 #include <ozz/base/containers/vector.h>
 #include <ozz/animation/runtime/skeleton.h>
 #include <ozz/animation/runtime/animation.h>
 
 namespace nau::animation
 {
-    void SkeletalAnimation::apply(int frame, AnimationState& animationState) const
+    void SkeletalAnimation::apply([[maybe_unused]] int frame, AnimationState& animationState) const
     {
         if(!animationState.target)
         {
@@ -47,66 +43,26 @@ namespace nau::animation
                 track.animSamplingContext.Resize(numJoints);
             }
 
-            ozz::animation::SamplingJob sampling_job;
-            sampling_job.animation = &ozzAnimation;
-            sampling_job.context = &track.animSamplingContext;
-            sampling_job.ratio = frame / getDurationInFrames(); // [0, 1]
-            sampling_job.output = ozz::make_span(track.locals);
-            if (!sampling_job.Run()) {
-                NAU_ASSERT(false);
-            }
+            // Sampling is deferred to the skeletal animation pipeline, that evaluates all the skeletons in parallel.
+            track.sampledAnimation = &ozzAnimation;
+            // Sampled at the continuous playback time: the frame index is snapped to the controller frame grid (used for the frame events only).
+            const float duration = ozzAnimation.duration();
+            track.samplingRatio = duration > .0f ? math::clamp(animationState.time / duration, .0f, 1.f) : .0f;
+            track.isSamplingPending = true;
+            d.isSamplingPending = true;
         }
     }
 
     float SkeletalAnimation::getDurationInFrames() const
     {
-        return ozzAnimation.duration() * 60.0f; // 60.0f is default fake animation frameRate
+        return ozzAnimation.duration() * 60.0f; // frame grid of the AnimationController (frame events), the sampling does not depend on it
     }
 
     void SkeletalAnimationMixer::blendAnimations(const IAnimatable::Ptr& target)
     {
         if (SkeletonComponent* skeletonComponent = getAnimatableTarget<SkeletonComponent>(target))
         {
-            SkeletalAnimRuntimeData& d = skeletonComponent->getAnimRuntimeDataMutable();
-
-            ozz::vector<ozz::animation::BlendingJob::Layer> layers;
-            ozz::vector<ozz::animation::BlendingJob::Layer> additiveLayers;
-
-            ozz::animation::BlendingJob::Layer* curLayer = nullptr;
-            for (const auto& track : d.tracks)
-            {
-                switch(track.second.blendMethod) // blendMethod is set in SkeletalAnimation::apply
-                {
-                case AnimationBlendMethod::Mix:
-                    curLayer = &layers.emplace_back();
-                    break;
-                case AnimationBlendMethod::Additive:
-                    curLayer = &additiveLayers.emplace_back();
-                    break;
-                default:
-                    break;
-                }
-
-                if (!curLayer)
-                {
-                    NAU_ASSERT(false);
-                    continue;
-                }
-                curLayer->weight = track.second.weight; // weight is set in SkeletalAnimation::apply
-                curLayer->transform = make_span(track.second.locals);
-                //curLayer->joint_weights // <- can be used for per-bone masking for animation, not yet supported
-            }
-
-            ozz::animation::BlendingJob blend_job;
-            blend_job.threshold = 0.05f; // todo: tunable param per skeleton? 
-            blend_job.layers = ozz::make_span(layers);
-            blend_job.additive_layers = ozz::make_span(additiveLayers);
-            blend_job.rest_pose = skeletonComponent->getSkeleton().joint_rest_poses();
-            blend_job.output = ozz::make_span(d.locals);
-
-            if (!blend_job.Run()) {
-                NAU_ASSERT(false);
-            }
+            skeletonComponent->getAnimRuntimeDataMutable().isBlendingPending = true;
         }
     }
 
@@ -114,15 +70,7 @@ namespace nau::animation
     {
         if (SkeletonComponent* skeletonComponent = getAnimatableTarget<SkeletonComponent>(target))
         {
-            SkeletalAnimRuntimeData& d = skeletonComponent->getAnimRuntimeDataMutable();
-
-            ozz::animation::LocalToModelJob ltm_job;
-            ltm_job.skeleton = &skeletonComponent->getSkeleton();
-            ltm_job.input = ozz::make_span(d.locals);
-            ltm_job.output = ozz::make_span(skeletonComponent->getModelSpaceJointMatricesMutable());
-            if (!ltm_job.Run()) {
-                NAU_ASSERT(false);
-            }
+            skeletonComponent->getAnimRuntimeDataMutable().isLocalToModelPending = true;
         }
     }
 
@@ -0,0 +1,377 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "skeletal_animation_pipeline.h"
+
+#include "nau/async/parallel_for.h"
+#include "nau/service/service_provider.h"
+
+#include <EASTL/algorithm.h>
+#include <ozz/animation/runtime/animation.h>
+#include <ozz/animation/runtime/local_to_model_job.h>
+#include <ozz/animation/runtime/sampling_job.h>
+#include <ozz/animation/runtime/skeleton.h>
+#include <ozz/base/maths/simd_math.h>
+#include <ozz/base/span.h>
+
+namespace nau::animation
+{
+    namespace
+    {
+        const scene::ICameraProperties* selectMainCamera(const scene::ICameraManager::CameraCollection& cameras)
+        {
+            constexpr eastl::string_view MainCameraName = "Camera.Main";
+
+            for (const nau::Ptr<scene::ICameraProperties>& camera : cameras)
+            {
+                if (camera->getCameraName() == MainCameraName)
+                {
+                    return camera.get();
+                }
+            }
+
+            return cameras.empty() ? nullptr : cameras.front().get();
+        }
+
+        /**
+            Selects the animation LOD from the distance to the camera and the visibility within the camera view cone.
+         */
+        class LodSelector
+        {
+        public:
+            LodSelector(const AnimationLodConfig& config, const scene::ICameraProperties* camera) :
+                m_config(config),
+                m_hasCamera(camera != nullptr)
+            {
+                if (camera)
+                {
+                    const math::Transform& cameraTransform = camera->getWorldTransform();
+                    m_cameraPosition = cameraTransform.getTranslation();
+                    m_cameraForward = math::normalize(math::rotate(cameraTransform.getRotation(), math::vec3(0.f, 0.f, -1.f)));
+
+                    // The cone encloses the whole view frustum: its half angle is taken along the frustum diagonal.
+                    const float tanHalfFov = std::tan(math::degToRad(camera->getFov()) * 0.5f);
+                    m_halfViewAngle = std::atan(tanHalfFov * std::sqrt(1.f + config.maxAspectRatio * config.maxAspectRatio));
+                }
+            }
+
+            AnimationLod selectLod(const math::vec3& position) const
+            {
+                AnimationLod lod;
+                if (!m_hasCamera)
+                {
+                    return lod;
+                }
+
+                const math::vec3 toObject = position - m_cameraPosition;
+                const float distance = static_cast<float>(math::length(toObject));
+
+                if (distance > m_config.cullDistance || !isVisible(toObject, distance))
+                {
+                    lod.updateInterval = 0;
+                }
+                else if (distance > m_config.lowRateDistance)
+                {
+                    lod.updateInterval = std::max(m_config.lowRateInterval, 1u);
+                    lod.maxJointsCount = m_config.lowRateMaxJoints;
+                }
+                else if (distance > m_config.reducedRateDistance)
+                {
+                    lod.updateInterval = std::max(m_config.reducedRateInterval, 1u);
+                }
+
+                return lod;
+            }
+
+        private:
+            bool isVisible(const math::vec3& toObject, float distance) const
+            {
+                if (!m_config.skipInvisible || distance <= m_config.boundingRadius)
+                {
+                    return true;
+                }
+
+                const float cosAngle = math::clamp(static_cast<float>(math::dot(toObject, m_cameraForward)) / distance, -1.f, 1.f);
+                const float boundsAngle = std::asin(m_config.boundingRadius / distance);
+
+                return std::acos(cosAngle) <= m_halfViewAngle + boundsAngle;
+            }
+
+            const AnimationLodConfig& m_config;
+            const bool m_hasCamera;
+            math::vec3 m_cameraPosition;
+            math::vec3 m_cameraForward;
+            float m_halfViewAngle = 0.f;
+        };
+    }  // namespace
+
+    void SkeletalAnimationPipeline::evaluatePose(SkeletonComponent& skeletonComponent, SkeletalPoseScratch& scratch)
+    {
+        SkeletalAnimRuntimeData& d = skeletonComponent.getAnimRuntimeDataMutable();
+        const ozz::animation::Skeleton& skeleton = skeletonComponent.getSkeleton();
+
+        // Joints are stored in the depth-first order, so the first joints are closed under the parent relation.
+        const int numJoints = skeleton.num_joints();
+        const int animatedJoints = d.lodMaxJointsCount > 0 ? std::min(static_cast<int>(d.lodMaxJointsCount), numJoints) : numJoints;
+        const size_t animatedSoaJoints = static_cast<size_t>((animatedJoints + 3) / 4);
+
+        // Blending processes only the rest pose amount of the soa joints.
+        const ozz::span<const ozz::math::SoaTransform> restPose = skeleton.joint_rest_poses().first(animatedSoaJoints);
+
+        if (d.isSamplingPending)
+        {
+            d.isSamplingPending = false;
+
+            for (auto& [trackName, track] : d.tracks)
+            {
+                if (!track.isSamplingPending)
+                {
+                    continue;
+                }
+
+                track.isSamplingPending = false;
+
+                // Layers without weight are skipped by the blending job, there is no need to sample them.
+                if (track.weight <= .0f || !track.sampledAnimation)
+                {
+                    continue;
+                }
+
+                ozz::animation::SamplingJob sampling_job;
+                sampling_job.animation = track.sampledAnimation;
+                sampling_job.context = &track.animSamplingContext;
+                sampling_job.ratio = track.samplingRatio;
+                sampling_job.output = ozz::make_span(track.locals);
+                if (!sampling_job.Run()) {
+                    NAU_ASSERT(false);
+                }
+            }
+        }
+
+        if (d.isBlendingPending)
+        {
+            d.isBlendingPending = false;
+
+            scratch.layers.clear();
+            scratch.additiveLayers.clear();
+
+            for (const auto& [trackName, track] : d.tracks)
+            {
+                ozz::animation::BlendingJob::Layer* curLayer = nullptr;
+                switch (track.blendMethod)  // blendMethod is set in SkeletalAnimation::apply
+                {
+                case AnimationBlendMethod::Mix:
+                    curLayer = &scratch.layers.emplace_back();
+                    break;
+                case AnimationBlendMethod::Additive:
+                    curLayer = &scratch.additiveLayers.emplace_back();
+                    break;
+                default:
+                    break;
+                }
+
+                if (!curLayer)
+                {
+                    NAU_ASSERT(false);
+                    continue;
+                }
+                curLayer->weight = track.weight;  // weight is set in SkeletalAnimation::apply
+                curLayer->transform = ozz::make_span(track.locals);
+                //curLayer->joint_weights // <- can be used for per-bone masking for animation, not yet supported
+            }
+
+            ozz::vector<ozz::math::SoaTransform>* output = &d.locals;
+
+            if (d.lodUpdateInterval > 1)
+            {
+                // Reduced update rate: the blended pose becomes the new key pose, the output is interpolated from the previous one.
+                d.interpolationFrom.resize(d.locals.size());
+                d.interpolationTo.resize(d.locals.size());
+                d.interpolationFrom.swap(d.interpolationTo);
+                d.framesSinceKeyPose = 0;
+
+                output = &d.interpolationTo;
+            }
+            else
+            {
+                d.hasKeyPoses = false;
+            }
+
+            ozz::animation::BlendingJob blend_job;
+            blend_job.threshold = 0.05f;  // todo: tunable param per skeleton?
+            blend_job.layers = ozz::make_span(scratch.layers);
+            blend_job.additive_layers = ozz::make_span(scratch.additiveLayers);
+            blend_job.rest_pose = restPose;
+            blend_job.output = ozz::make_span(*output);
+
+            if (!blend_job.Run()) {
+                NAU_ASSERT(false);
+            }
+
+            if (output == &d.interpolationTo && !d.hasKeyPoses)
+            {
+                d.interpolationFrom = d.interpolationTo;
+                d.hasKeyPoses = true;
+            }
+        }
+
+        if (d.isInterpolationPending)
+        {
+            d.isInterpolationPending = false;
+
+            if (d.hasKeyPoses && d.lodUpdateInterval > 1)
+            {
+                // The output is delayed by a single update interval, so the pose is interpolated (not extrapolated) between the key poses.
+                const float alpha = std::min(static_cast<float>(d.framesSinceKeyPose) / static_cast<float>(d.lodUpdateInterval), 1.f);
+                ++d.framesSinceKeyPose;
+
+                scratch.layers.resize(2);
+                scratch.layers[0].weight = 1.f - alpha;
+                scratch.layers[0].transform = ozz::make_span(d.interpolationFrom);
+                scratch.layers[1].weight = alpha;
+                scratch.layers[1].transform = ozz::make_span(d.interpolationTo);
+
+                ozz::animation::BlendingJob interpolation_job;
+                interpolation_job.layers = ozz::make_span(scratch.layers);
+                interpolation_job.rest_pose = restPose;
+                interpolation_job.output = ozz::make_span(d.locals);
+
+                if (!interpolation_job.Run()) {
+                    NAU_ASSERT(false);
+                }
+
+                d.isLocalToModelPending = true;
+            }
+        }
+
+        if (d.isLocalToModelPending)
+        {
+            d.isLocalToModelPending = false;
+
+            ozz::vector<ozz::math::Float4x4>& models = skeletonComponent.getModelSpaceJointMatricesMutable();
+
+            ozz::animation::LocalToModelJob ltm_job;
+            ltm_job.skeleton = &skeleton;
+            ltm_job.input = ozz::make_span(d.locals);
+            ltm_job.output = ozz::make_span(models);
+            ltm_job.to = animatedJoints - 1;
+            if (!ltm_job.Run()) {
+                NAU_ASSERT(false);
+            }
+
+            // The joints that are not animated due to LOD follow their parents in the default pose.
+            const ozz::span<const int16_t> parents = skeleton.joint_parents();
+            const ozz::vector<ozz::math::Float4x4>& defaultPoseLocals = skeletonComponent.getDefaultPoseLocalJointMatrices();
+            for (int i = animatedJoints; i < numJoints; ++i)
+            {
+                models[i] = parents[i] >= 0 ? models[parents[i]] * defaultPoseLocals[i] : defaultPoseLocals[i];
+            }
+
+            skeletonComponent.notifyStateChanged();
+        }
+    }
+
+    void SkeletalAnimationPipeline::setLodConfig(const AnimationLodConfig& config)
+    {
+        m_lodConfig = config;
+    }
+
+    void SkeletalAnimationPipeline::addSkeleton(SkeletonComponent& skeletonComponent, AnimationComponent* animationComponent)
+    {
+        lock_(m_mutex);
+
+        SkeletonEntry& entry = m_skeletons.emplace_back();
+        entry.skeleton = skeletonComponent;
+        if (animationComponent)
+        {
+            entry.animation = *animationComponent;
+        }
+    }
+
+    void SkeletalAnimationPipeline::removeSkeleton(const SkeletonComponent& skeletonComponent)
+    {
+        lock_(m_mutex);
+        auto iter = eastl::remove_if(m_skeletons.begin(), m_skeletons.end(), [&skeletonComponent](const SkeletonEntry& entry)
+        {
+            return !entry.skeleton || entry.skeleton.get() == &skeletonComponent;
+        });
+
+        m_skeletons.erase(iter, m_skeletons.end());
+    }
+
+    void SkeletalAnimationPipeline::updateLods()
+    {
+        if (!m_lodConfig.enabled)
+        {
+            return;
+        }
+
+        const scene::ICameraProperties* camera = nullptr;
+        if (auto* const cameraManager = getServiceProvider().find<scene::ICameraManager>())
+        {
+            cameraManager->syncCameras(m_cameras);
+            camera = selectMainCamera(m_cameras);
+        }
+
+        const LodSelector lodSelector{m_lodConfig, camera};
+
+        lock_(m_mutex);
+        for (SkeletonEntry& entry : m_skeletons)
+        {
+            if (!entry.skeleton || !entry.animation)
+            {
+                continue;
+            }
+
+            const AnimationLod lod = lodSelector.selectLod(entry.skeleton->getWorldTransform().getTranslation());
+            entry.animation->setLod(lod);
+
+            SkeletalAnimRuntimeData& d = entry.skeleton->getAnimRuntimeDataMutable();
+            d.lodUpdateInterval = lod.updateInterval;
+            d.lodMaxJointsCount = lod.maxJointsCount;
+            d.isInterpolationPending = lod.updateInterval > 1;
+        }
+    }
+
+    void SkeletalAnimationPipeline::update()
+    {
+        m_pendingSkeletons.clear();
+
+        {
+            lock_(m_mutex);
+            for (SkeletonEntry& entry : m_skeletons)
+            {
+                if (entry.skeleton && entry.skeleton->getAnimRuntimeDataMutable().isPoseUpdatePending())
+                {
+                    m_pendingSkeletons.push_back(entry.skeleton.get());
+                }
+            }
+        }
+
+        if (m_pendingSkeletons.empty())
+        {
+            return;
+        }
+
+        constexpr size_t ChunkSize = 8;
+
+        async::Executor::Ptr executor = async::Executor::getDefault();
+        async::ParallelFor evaluation{executor.get(), (m_pendingSkeletons.size() + ChunkSize - 1) / ChunkSize};
+
+        // Each participating thread uses its own scratch buffers.
+        if (m_workersScratch.size() < evaluation.getWorkersCount())
+        {
+            m_workersScratch.resize(evaluation.getWorkersCount());
+        }
+
+        evaluation.run([this](size_t chunk, size_t workerIndex)
+        {
+            const size_t end = std::min((chunk + 1) * ChunkSize, m_pendingSkeletons.size());
+            for (size_t i = chunk * ChunkSize; i < end; ++i)
+            {
+                evaluatePose(*m_pendingSkeletons[i], m_workersScratch[workerIndex]);
+            }
+        }, m_helpersCompleted);
+    }
+}  // namespace nau::animation
@@ -0,0 +1,115 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include "nau/animation/components/animation_component.h"
+#include "nau/animation/components/skeleton_component.h"
+#include "nau/scene/camera/camera_manager.h"
+#include "nau/threading/event.h"
+
+#include <EASTL/vector.h>
+#include <ozz/animation/runtime/blending_job.h>
+#include <ozz/base/containers/vector.h>
+
+#include <mutex>
+
+namespace nau::animation
+{
+    /**
+     * @brief Camera distance policy of the animation LOD (read from "/animation/lod").
+     */
+    struct AnimationLodConfig
+    {
+        // The LOD is opt-in: the culled skeletons do not update their animation controllers (e.g. the events and the root motion).
+        bool enabled = false;
+
+        // Skeletons farther than the distance are animated once per reducedRateInterval frames.
+        float reducedRateDistance = 20.f;
+        uint32_t reducedRateInterval = 2;
+
+        // Skeletons farther than the distance are animated once per lowRateInterval frames and only lowRateMaxJoints joints are animated (0 - all).
+        float lowRateDistance = 40.f;
+        uint32_t lowRateInterval = 4;
+        uint32_t lowRateMaxJoints = 32;
+
+        // Skeletons farther than the distance are not animated.
+        float cullDistance = 100.f;
+
+        // Skeletons outside of the camera view cone are not animated.
+        bool skipInvisible = true;
+        float boundingRadius = 2.f;
+        float maxAspectRatio = 2.f;
+
+        NAU_CLASS_FIELDS(
+            CLASS_FIELD(enabled),
+            CLASS_FIELD(reducedRateDistance),
+            CLASS_FIELD(reducedRateInterval),
+            CLASS_FIELD(lowRateDistance),
+            CLASS_FIELD(lowRateInterval),
+            CLASS_FIELD(lowRateMaxJoints),
+            CLASS_FIELD(cullDistance),
+            CLASS_FIELD(skipInvisible),
+            CLASS_FIELD(boundingRadius),
+            CLASS_FIELD(maxAspectRatio))
+    };
+
+    /**
+     * @brief Per-thread buffers reused by the pose evaluation (kept between the frames to avoid allocations).
+     */
+    struct SkeletalPoseScratch
+    {
+        ozz::vector<ozz::animation::BlendingJob::Layer> layers;
+        ozz::vector<ozz::animation::BlendingJob::Layer> additiveLayers;
+    };
+
+    /**
+     * @brief Evaluates poses of all the active skeletons as a single batch.
+     *
+     * Animation controllers only record the sampling/blending/local-to-model requests while the scene is updated.
+     * The requests are performed after the scene update (and before the scene state is synchronized with the render),
+     * the skeletons are distributed over the default executor threads.
+     */
+    class SkeletalAnimationPipeline
+    {
+    public:
+        /**
+         * @brief Performs the requested stages of the single skeleton pose evaluation.
+         */
+        static void evaluatePose(SkeletonComponent& skeletonComponent, SkeletalPoseScratch& scratch);
+
+        void setLodConfig(const AnimationLodConfig& config);
+
+        void addSkeleton(SkeletonComponent& skeletonComponent, AnimationComponent* animationComponent);
+
+        void removeSkeleton(const SkeletonComponent& skeletonComponent);
+
+        /**
+         * @brief Selects the animation LOD of the registered skeletons. Must be called before the scene update.
+         */
+        void updateLods();
+
+        /**
+         * @brief Evaluates the pending poses of all the registered skeletons. The call blocks until all the poses are published.
+         */
+        void update();
+
+    private:
+        struct SkeletonEntry
+        {
+            scene::ObjectWeakRef<SkeletonComponent> skeleton;
+            scene::ObjectWeakRef<AnimationComponent> animation;
+        };
+
+        std::mutex m_mutex;
+        eastl::vector<SkeletonEntry> m_skeletons;
+
+        AnimationLodConfig m_lodConfig;
+        scene::ICameraManager::CameraCollection m_cameras;
+
+        eastl::vector<SkeletonComponent*> m_pendingSkeletons;
+        eastl::vector<SkeletalPoseScratch> m_workersScratch;
+        threading::Event m_helpersCompleted;
+    };
+}  // namespace nau::animation
@@ -9,6 +9,8 @@
 #include "nau/animation/playback/animation_transforms.h"
 #include "nau/animation/controller/animation_controller.h"
 #include "nau/animation/controller/animation_controller_blend.h"
+#include "nau/app/global_properties.h"
+#include "nau/scene/camera/camera_manager.h"
 #include "nau/scene/components/skinned_mesh_component.h"
 #include "nau/messaging/messaging.h"
 #include "nau/scene/scene_object.h"
@@ -32,12 +34,13 @@ namespace nau::test
                 co_await skipFrames(1);
             }
         }
-    private:
+    protected:
         void initializeApp() override
         {
             configureVirtualFileSystem(getServiceProvider().get<io::IVirtualFileSystem>());
         }
 
+    private:
         async::Task<> loadSkeletalMeshAsset()
         {
             using namespace nau::scene;
@@ -182,6 +185,153 @@ namespace nau::test
         ASSERT_TRUE(testResult);
     }
 
+    /**
+        Poses of the multiple animated skeletons are evaluated in a batch (more skeletons than a single pipeline chunk)
+        and are published before the frame completes.
+    */
+    TEST_F(TestAnimationSkeletal, MultipleSkeletonsBatchPlayback)
+    {
+        using namespace nau::animation;
+        using namespace nau::async;
+        using namespace nau::math;
+        using namespace nau::scene;
+        using namespace testing;
+
+        constexpr size_t ScenesCount = 24;
+
+        const AssertionResult testResult = runTestApp([&]() -> Task<AssertionResult>
+            {
+                AssetRef<> sceneAssetRef{"file:/content/scenes/yarumy/yarumy.gltf"};
+
+                SceneAsset::Ptr sceneAsset = co_await sceneAssetRef.getAssetViewTyped<SceneAsset>();
+
+                eastl::vector<SkeletonComponent*> skeletons;
+                eastl::vector<IScene::WeakRef> sceneRefs;
+
+                for (size_t i = 0; i < ScenesCount; ++i)
+                {
+                    IScene::Ptr scene = getServiceProvider().get<scene::ISceneFactory>().createSceneFromAsset(*sceneAsset);
+
+                    for (SceneObject* const obj : scene->getRoot().getChildObjects(true))
+                    {
+                        if (obj->getName().find("YarumaBody", 0) == 0)
+                        {
+                            if (SkeletonComponent* const skeletonComponent = obj->findFirstComponent<SkeletonComponent>())
+                            {
+                                skeletons.push_back(skeletonComponent);
+                            }
+                        }
+                    }
+
+                    sceneRefs.push_back(co_await getSceneManager().activateScene(std::move(scene)));
+                }
+
+                ASSERT_ASYNC(skeletons.size() == ScenesCount);
+
+                eastl::vector<math::vec3> startPositions;
+                for (SkeletonComponent* const skeletonComponent : skeletons)
+                {
+                    startPositions.push_back(GetBoneModelPosition(*skeletonComponent, 5));
+                }
+
+                co_await skipFrames(30);
+
+                for (size_t i = 0; i < skeletons.size(); ++i)
+                {
+                    ASSERT_ASYNC(GetBoneModelPosition(*skeletons[i], 5) != startPositions[i]);
+                    ASSERT_ASYNC(!skeletons[i]->getAnimRuntimeDataMutable().isPoseUpdatePending());
+                }
+
+                co_return AssertionSuccess();
+            });
+
+        ASSERT_TRUE(testResult);
+    }
+
+    /**
+        The animation LOD is opt-in: it is enabled through the global properties before the animation services are initialized.
+    */
+    class TestAnimationSkeletalLod : public TestAnimationSkeletal
+    {
+    protected:
+        void initializeApp() override
+        {
+            TestAnimationSkeletal::initializeApp();
+            getServiceProvider().get<GlobalProperties>().setValue("/animation/lod/enabled", true).ignore();
+        }
+    };
+
+    /**
+        Animation LOD is selected from the main camera: the update rate is reduced with the distance,
+        the invisible and too far skeletons are not animated.
+    */
+    TEST_F(TestAnimationSkeletalLod, AnimationLodFromCamera)
+    {
+        using namespace nau::animation;
+        using namespace nau::async;
+        using namespace nau::math;
+        using namespace nau::scene;
+        using namespace testing;
+
+        const AssertionResult testResult = runTestApp([&]() -> Task<AssertionResult>
+            {
+                AssetRef<> sceneAssetRef{"file:/content/scenes/yarumy/yarumy.gltf"};
+
+                SceneAsset::Ptr sceneAsset = co_await sceneAssetRef.getAssetViewTyped<SceneAsset>();
+
+                IScene::Ptr scene = getServiceProvider().get<scene::ISceneFactory>().createSceneFromAsset(*sceneAsset);
+
+                SkeletonComponent* skeletonComponent = nullptr;
+                AnimationComponent* animationComponent = nullptr;
+                for (SceneObject* const obj : scene->getRoot().getChildObjects(true))
+                {
+                    if (obj->getName().find("YarumaBody", 0) == 0)
+                    {
+                        skeletonComponent = obj->findFirstComponent<SkeletonComponent>();
+                        animationComponent = obj->findFirstComponent<AnimationComponent>();
+                    }
+                }
+
+                ASSERT_ASYNC(skeletonComponent && animationComponent);
+
+                ObjectWeakRef sceneRef = co_await getSceneManager().activateScene(std::move(scene));
+
+                auto camera = getServiceProvider().get<ICameraManager>().createDetachedCamera();
+                camera->setCameraName("Camera.Main");
+                const math::vec3 skeletonPos = skeletonComponent->getWorldTransform().getTranslation();
+
+                // The camera looks along -Z
+                camera->setTranslation(skeletonPos + math::vec3(0.f, 0.f, 5.f));
+                co_await skipFrames(2);
+                ASSERT_ASYNC(animationComponent->getLod().updateInterval == 1);
+
+                camera->setTranslation(skeletonPos + math::vec3(0.f, 0.f, 60.f));
+                co_await skipFrames(2);
+                ASSERT_ASYNC(animationComponent->getLod().updateInterval > 1);
+
+                const math::vec3 farPos = GetBoneModelPosition(*skeletonComponent, 5);
+                co_await skipFrames(30);
+                ASSERT_ASYNC(GetBoneModelPosition(*skeletonComponent, 5) != farPos);
+
+                camera->setTranslation(skeletonPos + math::vec3(0.f, 0.f, 500.f));
+                co_await skipFrames(2);
+                ASSERT_ASYNC(animationComponent->getLod().updateInterval == 0);
+
+                camera->setTranslation(skeletonPos + math::vec3(0.f, 0.f, 5.f));
+                camera->setRotation(math::quat::rotationY(3.14159265f));
+                co_await skipFrames(2);
+                ASSERT_ASYNC(animationComponent->getLod().updateInterval == 0);
+
+                const math::vec3 invisiblePos = GetBoneModelPosition(*skeletonComponent, 5);
+                co_await skipFrames(10);
+                ASSERT_ASYNC(GetBoneModelPosition(*skeletonComponent, 5) == invisiblePos);
+
+                co_return AssertionSuccess();
+            });
+
+        ASSERT_TRUE(testResult);
+    }
+
         TEST_F(TestAnimationSkeletal, SkeletonSocketComponent)
         {
             using namespace nau::animation;
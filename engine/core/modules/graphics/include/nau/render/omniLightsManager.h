@@ -6,6 +6,7 @@
 #include "nau/math/dag_bounds3.h"
 #include "nau/render/omniLight.h"
 #include "nau/math/dag_frustum.h"
+#include "nau/math/spheres_grid.h"
 
 namespace nau::render
 {
@@ -117,6 +118,7 @@ namespace nau::render
             rawLights[id].pos_radius.x = pos.getX();
             rawLights[id].pos_radius.y = pos.getY();
             rawLights[id].pos_radius.z = pos.getZ();
+            updateGridSphere(id);
         }
         void setLightCol(unsigned int id, const Color3& col)
         {
@@ -140,6 +142,7 @@ namespace nau::render
                 return;
             }
             rawLights[id].pos_radius.w = radius;
+            updateGridSphere(id);
         }
         void setLightBox(unsigned int id, const nau::math::Matrix4& box)
         {
@@ -182,6 +185,7 @@ namespace nau::render
                 return;
             }
             rawLights[id] = l;
+            updateGridSphere(id);
         }
         void removeEmpty();
         int maxIndex() const
@@ -215,12 +219,20 @@ namespace nau::render
         }
 
     private:
+        void updateGridSphere(unsigned int id)
+        {
+            const float4& posRadius = rawLights[id].pos_radius;
+            lightsGrid.update(id, nau::math::Vector3(posRadius.x, posRadius.y, posRadius.z), posRadius.w);
+        }
+
         eastl::array<Light, MAX_LIGHTS> rawLights = {};
         eastl::array<uint8_t, MAX_LIGHTS> lightPriority = {};
         // masks allows to ignore specific lights in specific cases
         // for example, we can ignore highly dynamic lights for GI
         eastl::array<mask_type_t, MAX_LIGHTS> masks = {};  //-V730_NOINIT
         dag::RelocatableFixedVector<uint16_t, MAX_LIGHTS> freeLightIds = {};
+        // bounding spheres of the lights, updated by the setters and used by prepare() for the hierarchical frustum culling
+        nau::math::SpheresGrid lightsGrid;
 
         /* TODO: Support photometry
          IesTextureCollection* photometryTextures = nullptr;
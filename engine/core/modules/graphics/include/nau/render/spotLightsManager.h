@@ -5,6 +5,7 @@
 
 #include "nau/math/dag_bounds3.h"
 #include "nau/math/dag_frustum.h"
+#include "nau/math/spheres_grid.h"
 #include "nau/render/spotLight.h"
 
 namespace nau::render
@@ -153,6 +154,7 @@ namespace nau::render
             cosHalfAngles[id] = l.getCosHalfAngle();
             boundingSpheres[id] = l.getBoundingSphere(cosHalfAngles[id]).toVec4();
             updateBoundingBox(id);
+            lightsGrid.update(id, boundingSpheres[id].getXYZ(), l.pos_radius.w > 0 ? float(boundingSpheres[id].getW()) : 0.f);
         }
         void updateBoundingBox(unsigned id);
         nau::math::BBox3 getBoundingBox(unsigned id) const
@@ -291,6 +293,8 @@ namespace nau::render
 
         dag::RelocatableFixedVector<uint16_t, MAX_LIGHTS> freeLightIds;  //-V730_NOINIT
         eastl::bitset<MAX_LIGHTS> nonOptLightIds;
+        // bounding spheres of the lights, updated with boundingSpheres and used by prepare() for the hierarchical frustum culling
+        nau::math::SpheresGrid lightsGrid;
         /* TODO: Support photometry
          IesTextureCollection* photometryTextures = nullptr;
         */
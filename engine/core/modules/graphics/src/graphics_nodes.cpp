@@ -147,7 +147,6 @@ namespace nau
         SceneObject& parentObj = skinnedMeshComponent.getParentObject();
         if (const Component* skeletonComponent = parentObj.findFirstComponent<SkeletonComponent>())
         {
-            renderableSkinnedMesh.skeletonComponentUid = skeletonComponent->getUid();
             SkinnedMeshNode::updateFromScene(renderableSkinnedMesh, skinnedMeshComponent.as<const SceneComponent&>(), skeletonComponent->as<const SkeletonComponent&>());
         }
 
@@ -81,7 +81,9 @@ namespace nau
 
     struct SkinnedMeshNode : GraphicsSceneNode
     {
-        Uid skeletonComponentUid;
+        // Direct handles to the scene components (are reset when the components are deactivated)
+        scene::ObjectWeakRef<scene::SceneComponent> meshComponent;
+        scene::ObjectWeakRef<SkeletonComponent> skeletonComponent;
         eastl::shared_ptr<nau::SkinnedMeshInstance> instance;
 
         eastl::optional<MaterialAssetRef> materialOverride;
@@ -4,6 +4,7 @@
 
 #include "graphics_scene.h"
 
+#include <EASTL/sort.h>
 #include <nau/service/service_provider.h>
 
 #include "graphics_impl.h"
@@ -38,10 +39,9 @@ namespace nau
             auto csmView = eastl::make_shared<nau::RenderView>(nau::utils::format("{}_{}", "csmView", i).c_str());
             csmView->addTag(nau::RenderScene::Tags::shadowCascadeTag);
             csmView->setUserData((void*)i);
-            nau::RenderView* csmViewPtr = csmView.get();
-            auto csmFilter = eastl::function<bool(const InstanceInfo&)>([csmViewPtr](const InstanceInfo& info)
+            auto csmFilter = eastl::function<bool(const InstanceInfo&)>([](const InstanceInfo& info)
             {
-                return info.isCastShadow && csmViewPtr->getFrustum().testSphere(info.worldSphere) != 0;
+                return info.isCastShadow;
             });
             csmView->setInstanceFilter(csmFilter);
 
@@ -64,6 +64,25 @@ namespace nau
         m_renderScene->addManager(nau::rtti::createInstance<nau::SkinnedMeshManager>());
     }
 
+    GraphicsScene::~GraphicsScene()
+    {
+        using namespace nau::scene;
+
+        if (m_boundComponents.empty() || !getServiceProvider().has<ISceneManagerInternal>())
+        {
+            return;
+        }
+
+        // The components that are still alive must not refer to the destroyed queue.
+        for (auto& [uid, componentRef] : m_boundComponents)
+        {
+            if (componentRef)
+            {
+                componentRef->setChangesQueue(nullptr);
+            }
+        }
+    }
+
     async::Task<> GraphicsScene::initialize()
     {
         async::TaskCollection tasks;
@@ -172,6 +191,15 @@ namespace nau
         auto& graphics = getServiceProvider().get<GraphicsImpl>();
         co_await graphics.getPreRenderExecutor();
 
+        const auto addNodeLocation = [this](Uid componentUid, NodeType type, size_t index)
+        {
+            if (componentUid != NullUid)
+            {
+                m_nodeLocations.emplace(componentUid, NodeLocation{type, static_cast<uint32_t>(index)});
+                m_pendingComponents.push_back(componentUid);
+            }
+        };
+
         if (!staticMeshes.empty())
         {
             m_staticMeshes.reserve(m_staticMeshes.size() + staticMeshes.size());
@@ -183,6 +211,7 @@ namespace nau
 
                     auto& mesh = m_staticMeshes.back();
                     mesh.handle->setUid(mesh.componentUid);
+                    addNodeLocation(mesh.componentUid, NodeType::StaticMesh, m_staticMeshes.size() - 1);
                 }
             }
         }
@@ -198,6 +227,7 @@ namespace nau
 
                     auto& mesh = m_skinnedMeshes.back();
                     mesh.instance->setUid(mesh.componentUid);
+                    addNodeLocation(mesh.componentUid, NodeType::SkinnedMesh, m_skinnedMeshes.size() - 1);
                 }
             }
         }
@@ -210,6 +240,7 @@ namespace nau
                 if (billTask.isReady())
                 {
                     m_billboards.emplace_back(*std::move(billTask));
+                    addNodeLocation(m_billboards.back().componentUid, NodeType::Billboard, m_billboards.size() - 1);
                 }
             }
         }
@@ -220,6 +251,7 @@ namespace nau
             for (auto& light : directionalLights)
             {
                 m_directionalLights.emplace_back(light);
+                addNodeLocation(light.componentUid, NodeType::DirectionalLight, m_directionalLights.size() - 1);
             }
             if (m_directionalLights.size() > 1)
             {
@@ -233,6 +265,7 @@ namespace nau
             for (auto& env : envNodes)
             {
                 m_envNodes.emplace_back(env);
+                addNodeLocation(env.componentUid, NodeType::Environment, m_envNodes.size() - 1);
             }
             if (m_envNodes.size() > 1)
             {
@@ -245,6 +278,7 @@ namespace nau
             for (LightNode& light : lights)
             {
                 m_lightNodes.emplace_back(std::move(light));
+                addNodeLocation(m_lightNodes.back().componentUid, NodeType::Light, m_lightNodes.size() - 1);
             }
         }
     }
@@ -288,50 +322,97 @@ namespace nau
             }
         };
 
+        // Skeletons are bound together with their meshes: they are unbound when the last mesh goes away.
+        eastl::vector<SkeletonComponent*> removedMeshesSkeletons;
+        for (SkinnedMeshNode& mesh : m_skinnedMeshes)
+        {
+            if (mesh.skeletonComponent && componentRemoved(mesh.componentUid))
+            {
+                removedMeshesSkeletons.push_back(mesh.skeletonComponent.get());
+            }
+        }
+
         removeObjects(m_skinnedMeshes);
         removeObjects(m_staticMeshes);
         removeObjects(m_billboards);
         removeObjects(m_directionalLights);
         removeObjects(m_envNodes);
         removeLights(m_lightNodes);
+
+        // The deactivated components stay alive until the deactivation is completed.
+        for (const DeactivatedComponentData& data : components)
+        {
+            unbindComponent(*const_cast<Component*>(data.component));
+        }
+
+        for (SkeletonComponent* const skeletonComponent : removedMeshesSkeletons)
+        {
+            const bool isSkeletonUsed = eastl::any_of(m_skinnedMeshes.begin(), m_skinnedMeshes.end(), [skeletonComponent](const SkinnedMeshNode& mesh)
+            {
+                return mesh.skeletonComponent && mesh.skeletonComponent.get() == skeletonComponent;
+            });
+
+            if (!isSkeletonUsed)
+            {
+                unbindComponent(*skeletonComponent);
+            }
+        }
+
+        rebuildNodeLocations();
     }
 
     async::Task<> GraphicsScene::update()
     {
-        for (auto& m : m_staticMeshes)
+        // Only the nodes whose assets have been changed by the last synchronization are updated.
+        eastl::vector<Uid> pendingAssetUpdates = std::move(m_pendingAssetUpdates);
+        m_pendingAssetUpdates.clear();
+
+        for (const Uid componentUid : pendingAssetUpdates)
         {
-            if (m.materialOverride)
+            const auto locationIter = m_nodeLocations.find(componentUid);
+            if (locationIter == m_nodeLocations.end())
             {
-                MaterialAssetRef& materialRef = *m.materialOverride;
+                continue;
+            }
+
+            const NodeLocation location = locationIter->second;
+            if (location.type == NodeType::StaticMesh)
+            {
+                auto& m = m_staticMeshes[location.index];
+                if (m.materialOverride)
+                {
+                    MaterialAssetRef& materialRef = *m.materialOverride;
 
-                auto dx12MaterialAsset = co_await materialRef.getReloadableAssetViewTyped<MaterialAssetView>();
+                    auto dx12MaterialAsset = co_await materialRef.getReloadableAssetViewTyped<MaterialAssetView>();
 
-                m.handle->overrideMaterial(0, 0, dx12MaterialAsset);
-                m.materialOverride.reset();
+                    m.handle->overrideMaterial(0, 0, dx12MaterialAsset);
+                    m.materialOverride.reset();
+                }
             }
-        }
-        for (auto& m : m_skinnedMeshes)
-        {
-            if (m.materialOverride)
+            else if (location.type == NodeType::SkinnedMesh)
             {
-                MaterialAssetRef& materialRef = *m.materialOverride;
+                auto& m = m_skinnedMeshes[location.index];
+                if (m.materialOverride)
+                {
+                    MaterialAssetRef& materialRef = *m.materialOverride;
 
-                auto dx12MaterialAsset = co_await materialRef.getReloadableAssetViewTyped<MaterialAssetView>();
+                    auto dx12MaterialAsset = co_await materialRef.getReloadableAssetViewTyped<MaterialAssetView>();
 
-                m.instance->overrideMaterial(dx12MaterialAsset);
-                m.materialOverride.reset();
+                    m.instance->overrideMaterial(dx12MaterialAsset);
+                    m.materialOverride.reset();
+                }
             }
-        }
-
-        for (auto& bill : m_billboards)
-        {
-            if (bill.overrideTexture)
+            else if (location.type == NodeType::Billboard)
             {
-                TextureAssetRef& texRef = *bill.overrideTexture;
-                auto texAsset = co_await texRef.getReloadableAssetViewTyped<TextureAssetView>();
+                auto& bill = m_billboards[location.index];
+                if (bill.overrideTexture)
+                {
+                    TextureAssetRef& texRef = *bill.overrideTexture;
+                    auto texAsset = co_await texRef.getReloadableAssetViewTyped<TextureAssetView>();
 
-                bill.billboardHandle->setTexture(texAsset);
-                bill.overrideTexture.reset();
+                    bill.billboardHandle->setTexture(texAsset);
+                    bill.overrideTexture.reset();
+                }
             }
         }
 
@@ -493,91 +574,173 @@ namespace nau
         }
         auto& sceneManager = getServiceProvider().get<ISceneManagerInternal>();
 
-        for (auto& m : m_staticMeshes)
+        bindPendingComponents(sceneManager);
+
+        m_changes.takeChangedComponents(m_changedComponents);
+        for (Component* const component : m_changedComponents)
         {
-            if (Component* const component = sceneManager.findComponent(m.componentUid))
+            // The component could be deactivated after it has been changed.
+            if (component->getActivationState() != ActivationState::Active)
             {
-                //StaticMeshNode::updateFromScene(m, component->as<const SceneComponent&>());
+                continue;
+            }
 
-                StaticMeshComponent& staticMeshComponent = component->as<StaticMeshComponent&>();
-                if ((staticMeshComponent.getDirtyFlags() & static_cast<uint32_t>(StaticMeshComponent::DirtyFlags::Material)) && staticMeshComponent.getMaterial())
-                {
-                    m.materialOverride = staticMeshComponent.getMaterial();
-                }
-                m.handle->syncState(staticMeshComponent);
+            // A skeleton can be shared by the several skinned meshes.
+            const auto [first, last] = m_nodeLocations.equal_range(component->getUid());
+            for (auto iter = first; iter != last; ++iter)
+            {
+                syncComponent(*component, iter->second);
+            }
+        }
 
-                staticMeshComponent.resetDirtyFlags();
+        // The mesh and its skeleton can both be changed within the frame: the bones are updated once.
+        eastl::sort(m_changedSkinnedMeshes.begin(), m_changedSkinnedMeshes.end());
+        m_changedSkinnedMeshes.erase(eastl::unique(m_changedSkinnedMeshes.begin(), m_changedSkinnedMeshes.end()), m_changedSkinnedMeshes.end());
+
+        for (const uint32_t index : m_changedSkinnedMeshes)
+        {
+            SkinnedMeshNode& mesh = m_skinnedMeshes[index];
+            if (mesh.meshComponent && mesh.skeletonComponent)
+            {
+                SkinnedMeshNode::updateFromScene(mesh, *mesh.meshComponent, *mesh.skeletonComponent);
             }
         }
-        for (auto& m : m_skinnedMeshes)
+
+        m_changedSkinnedMeshes.clear();
+
+        syncSceneCameras();
+    }
+
+    void GraphicsScene::bindPendingComponents(scene::ISceneManagerInternal& sceneManager)
+    {
+        using namespace nau::scene;
+
+        eastl::erase_if(m_pendingComponents, [&](Uid componentUid)
         {
-            Component* const skMeshComponent = sceneManager.findComponent(m.componentUid);
+            const auto locationIter = m_nodeLocations.find(componentUid);
+            if (locationIter == m_nodeLocations.end())
+            {
+                // Deactivated before it has been bound.
+                return true;
+            }
 
-            if (!skMeshComponent)
+            const NodeLocation location = locationIter->second;
+
+            Component* const component = sceneManager.findComponent(componentUid);
+            if (!component)
             {
-                continue;
+                return false;
             }
 
-            Component* skeletonComponent = nullptr;
-            if (m.skeletonComponentUid != NullUid)
+            bindComponent(*component);
+            syncComponent(*component, location);
+
+            if (location.type != NodeType::SkinnedMesh)
             {
-                skeletonComponent = sceneManager.findComponent(m.skeletonComponentUid);
+                return true;
             }
-            if (!skeletonComponent)
+
+            SkinnedMeshNode& mesh = m_skinnedMeshes[location.index];
+            mesh.meshComponent = component->as<SceneComponent&>();
+
+            // The skeleton can be added later than the mesh, the binding is retried until it is found.
+            if (!mesh.skeletonComponent)
             {
-                SceneObject& parentObj = skMeshComponent->getParentObject();
-                if (skeletonComponent = parentObj.findFirstComponent<SkeletonComponent>())
+                SkeletonComponent* const skeletonComponent = component->getParentObject().findFirstComponent<SkeletonComponent>();
+                if (!skeletonComponent)
                 {
-                    m.skeletonComponentUid = skeletonComponent->getUid();
+                    return false;
                 }
+
+                mesh.skeletonComponent = *skeletonComponent;
+                bindComponent(*skeletonComponent);
+                m_nodeLocations.emplace(skeletonComponent->getUid(), NodeLocation{NodeType::Skeleton, location.index});
             }
 
-            SkinnedMeshComponent& skinnedMeshComponent = skMeshComponent->as<SkinnedMeshComponent&>();
+            return true;
+        });
+    }
+
+    void GraphicsScene::bindComponent(scene::Component& component)
+    {
+        component.setChangesQueue(&m_changes);
+        m_boundComponents.emplace(component.getUid(), component);
+    }
+
+    void GraphicsScene::unbindComponent(scene::Component& component)
+    {
+        if (m_boundComponents.erase(component.getUid()) != 0)
+        {
+            component.setChangesQueue(nullptr);
+        }
+    }
+
+    void GraphicsScene::syncComponent(scene::Component& component, NodeLocation location)
+    {
+        using namespace nau::scene;
 
-            if (skinnedMeshComponent.isMaterialDirty() && skinnedMeshComponent.getMaterial())
+        switch (location.type)
+        {
+            case NodeType::StaticMesh:
             {
-                m.materialOverride = skinnedMeshComponent.getMaterial();
-                skinnedMeshComponent.resetIsMaterialDirty();
+                StaticMeshNode& m = m_staticMeshes[location.index];
+                StaticMeshComponent& staticMeshComponent = component.as<StaticMeshComponent&>();
+                if ((staticMeshComponent.getDirtyFlags() & static_cast<uint32_t>(StaticMeshComponent::DirtyFlags::Material)) && staticMeshComponent.getMaterial())
+                {
+                    m.materialOverride = staticMeshComponent.getMaterial();
+                    m_pendingAssetUpdates.push_back(m.componentUid);
+                }
+                m.handle->syncState(staticMeshComponent);
+
+                staticMeshComponent.resetDirtyFlags();
+                break;
             }
+            case NodeType::SkinnedMesh:
+            {
+                SkinnedMeshNode& m = m_skinnedMeshes[location.index];
+                SkinnedMeshComponent& skinnedMeshComponent = component.as<SkinnedMeshComponent&>();
+                if (skinnedMeshComponent.isMaterialDirty() && skinnedMeshComponent.getMaterial())
+                {
+                    m.materialOverride = skinnedMeshComponent.getMaterial();
+                    m_pendingAssetUpdates.push_back(m.componentUid);
+                    skinnedMeshComponent.resetIsMaterialDirty();
+                }
 
-            if (skeletonComponent)
+                m_changedSkinnedMeshes.push_back(location.index);
+                break;
+            }
+            case NodeType::Skeleton:
             {
-                SkinnedMeshNode::updateFromScene(m, skMeshComponent->as<const SceneComponent&>(), skeletonComponent->as<const SkeletonComponent&>());
+                m_changedSkinnedMeshes.push_back(location.index);
+                break;
             }
-        }
-
-        for (auto& bill : m_billboards)
-        {
-            if (Component* const component = sceneManager.findComponent(bill.componentUid))
+            case NodeType::Billboard:
             {
-                GraphicsSceneNode::updateFromScene(bill, component->as<const SceneComponent&>());
-                BillboardComponent& billComponent = component->as<BillboardComponent&>();
+                BillboardNode& bill = m_billboards[location.index];
+                GraphicsSceneNode::updateFromScene(bill, component.as<const SceneComponent&>());
+                BillboardComponent& billComponent = component.as<BillboardComponent&>();
                 bill.billboardHandle->setScreenPercentageSize(billComponent.getScreenPercentageSize());
                 bill.billboardHandle->setWorldPos(billComponent.getWorldTransform().getTranslation());
                 if (billComponent.isTextureDirty())
                 {
                     bill.overrideTexture = billComponent.getTextureRef();
+                    m_pendingAssetUpdates.push_back(bill.componentUid);
                     billComponent.resetIsTextureDirty();
                 }
+                break;
             }
-        }
-
-        for (auto& directionalLight : m_directionalLights)
-        {
-            if (Component* const component = sceneManager.findComponent(directionalLight.componentUid))
+            case NodeType::DirectionalLight:
             {
-                DirectionalLightComponent& directionalLightComponent = component->as<DirectionalLightComponent&>();
-                directionalLight = makeDirectionalLightNode(directionalLightComponent);
+                m_directionalLights[location.index] = makeDirectionalLightNode(component.as<DirectionalLightComponent&>());
+                break;
             }
-        }
-        for (auto& light : m_lightNodes)
-        {
-            if (Component* const component = sceneManager.findComponent(light.componentUid))
+            case NodeType::Light:
             {
-                if (component->is<OmnilightComponent>())
+                LightNode& light = m_lightNodes[location.index];
+                if (component.is<OmnilightComponent>())
                 {
-                    GraphicsSceneNode::updateFromScene(light, component->as<const SceneComponent&>());
-                    OmnilightComponent& omnilightComponent = component->as<OmnilightComponent&>();
+                    GraphicsSceneNode::updateFromScene(light, component.as<const SceneComponent&>());
+                    OmnilightComponent& omnilightComponent = component.as<OmnilightComponent&>();
                     m_lights.setLight(light.lightId, render::ClusteredLights::OmniLight{
                                                          math::float3((omnilightComponent.getWorldTransform().getTranslation()) + omnilightComponent.getShift()),
                                                          omnilightComponent.getColor(),
@@ -585,10 +748,10 @@ namespace nau
                                                          omnilightComponent.getAttenuation(),
                                                          omnilightComponent.getIntensity()});
                 }
-                if (component->is<SpotlightComponent>())
+                if (component.is<SpotlightComponent>())
                 {
-                    GraphicsSceneNode::updateFromScene(light, component->as<const SceneComponent&>());
-                    SpotlightComponent& spotlightComponent = component->as<SpotlightComponent&>();
+                    GraphicsSceneNode::updateFromScene(light, component.as<const SceneComponent&>());
+                    SpotlightComponent& spotlightComponent = component.as<SpotlightComponent&>();
                     m_lights.setLight(light.lightId, render::ClusteredLights::SpotLight{
                                                          math::float3((spotlightComponent.getWorldTransform().getTranslation()) + spotlightComponent.getShift()),
                                                          spotlightComponent.getColor(),
@@ -599,25 +762,52 @@ namespace nau
                                                          spotlightComponent.getAngle(),
                                                          false});
                 }
-                // TODO: SpotlightComponent
+                break;
             }
-        }
-
-        if (!m_envNodes.empty())
-        {
-            if (Component* const component = sceneManager.findComponent(m_envNodes[0].componentUid))
+            case NodeType::Environment:
             {
-                EnvironmentComponent& envComponent = component->as<EnvironmentComponent&>();
-                m_envNodes[0].envIntensity = envComponent.getIntensity();
+                EnvironmentNode& envNode = m_envNodes[location.index];
+                EnvironmentComponent& envComponent = component.as<EnvironmentComponent&>();
+                envNode.envIntensity = envComponent.getIntensity();
                 if (envComponent.isTextureDirty())
                 {
                     envComponent.resetIsTextureDirty();
-                    m_envNodes[0].newTextureRef = envComponent.getTextureAsset();
+                    envNode.newTextureRef = envComponent.getTextureAsset();
                 }
+                break;
             }
         }
+    }
 
-        syncSceneCameras();
+    void GraphicsScene::rebuildNodeLocations()
+    {
+        m_nodeLocations.clear();
+
+        const auto addNodeLocations = [this]<typename Container>(const Container& nodes, NodeType type)
+        {
+            for (size_t i = 0, count = nodes.size(); i < count; ++i)
+            {
+                if (nodes[i].componentUid != NullUid)
+                {
+                    m_nodeLocations.emplace(nodes[i].componentUid, NodeLocation{type, static_cast<uint32_t>(i)});
+                }
+            }
+        };
+
+        addNodeLocations(m_staticMeshes, NodeType::StaticMesh);
+        addNodeLocations(m_skinnedMeshes, NodeType::SkinnedMesh);
+        addNodeLocations(m_billboards, NodeType::Billboard);
+        addNodeLocations(m_directionalLights, NodeType::DirectionalLight);
+        addNodeLocations(m_lightNodes, NodeType::Light);
+        addNodeLocations(m_envNodes, NodeType::Environment);
+
+        for (size_t i = 0, count = m_skinnedMeshes.size(); i < count; ++i)
+        {
+            if (const SkinnedMeshNode& mesh = m_skinnedMeshes[i]; mesh.skeletonComponent)
+            {
+                m_nodeLocations.emplace(mesh.skeletonComponent->getUid(), NodeLocation{NodeType::Skeleton, static_cast<uint32_t>(i)});
+            }
+        }
     }
 
     void GraphicsScene::syncSceneCameras()
@@ -686,11 +876,12 @@ namespace nau
 
     void GraphicsScene::setObjectHighlight(nau::Uid uid, bool flag)
     {
-        for (auto& m : m_staticMeshes)
+        const auto [first, last] = m_nodeLocations.equal_range(uid);
+        for (auto iter = first; iter != last; ++iter)
         {
-            if (uid == m.componentUid)
+            if (iter->second.type == NodeType::StaticMesh)
             {
-                m.handle->setHighlighted(flag);
+                m_staticMeshes[iter->second.index].handle->setHighlighted(flag);
                 break;
             }
         }
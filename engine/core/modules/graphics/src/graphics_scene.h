@@ -4,11 +4,14 @@
 
 #pragma once
 
+#include <EASTL/unordered_map.h>
+
 #include <shared_mutex>
 
 #include "nau/animation/components/skeleton_component.h"
 #include "nau/math/math.h"
 #include "nau/scene/camera/camera_manager.h"
+#include "nau/scene/components/component_changes_queue.h"
 #include "nau/scene/components/scene_component.h"
 #include "nau/scene/scene_processor.h"
 #include "nau/shaders/shader_defines.h"
@@ -27,6 +30,7 @@
 namespace nau::scene
 {
     class CameraComponent;
+    class ISceneManagerInternal;
 }
 
 
@@ -38,6 +42,8 @@ namespace nau
 
         GraphicsScene();
 
+        ~GraphicsScene();
+
         async::Task<> initialize();
 
         async::Task<> activateComponents(eastl::span<const scene::Component*> components, async::Task<> barrier);
@@ -71,6 +77,42 @@ namespace nau
         nau::RenderScene* getRenderScene();
 
     private:
+        enum class NodeType : uint8_t
+        {
+            StaticMesh,
+            SkinnedMesh,
+            Skeleton,
+            Billboard,
+            DirectionalLight,
+            Light,
+            Environment
+        };
+
+        struct NodeLocation
+        {
+            NodeType type;
+            uint32_t index;
+        };
+
+        /**
+         * @brief Binds the activated components to the changes queue and performs their initial synchronization.
+         */
+        void bindPendingComponents(scene::ISceneManagerInternal& sceneManager);
+
+        /**
+         * @brief Subscribes the component to the changes queue. All the bound components are unbound when the scene is destroyed.
+         */
+        void bindComponent(scene::Component& component);
+
+        void unbindComponent(scene::Component& component);
+
+        /**
+         * @brief Updates the graphics nodes of the component that has been changed.
+         */
+        void syncComponent(scene::Component& component, NodeLocation location);
+
+        void rebuildNodeLocations();
+
         void syncSceneCameras();
 
         eastl::vector<StaticMeshNode> m_staticMeshes;
@@ -89,5 +131,19 @@ namespace nau
 
         std::optional<size_t> m_activeCamera;
         scene::ICameraManager::CameraCollection m_allInGameCameras;
+
+        // Only the components enqueued into m_changes are synchronized with the graphics nodes.
+        // The activated components are bound to the queue at the next synchronization (the scene is not updated at that moment).
+        scene::ComponentChangesQueue m_changes;
+        eastl::vector<Uid> m_pendingComponents;
+        eastl::unordered_multimap<Uid, NodeLocation> m_nodeLocations;
+        eastl::unordered_map<Uid, scene::ObjectWeakRef<scene::Component>> m_boundComponents;
+
+        // Components whose material or texture have been changed: the assets are loaded by the next update.
+        eastl::vector<Uid> m_pendingAssetUpdates;
+
+        // Reused between the synchronizations to avoid allocations.
+        Vector<scene::Component*> m_changedComponents;
+        eastl::vector<uint32_t> m_changedSkinnedMeshes;
     };
 }  // namespace nau
@@ -5,6 +5,7 @@
 #include "render/lights/clusteredLights.h"
 
 #include "nau/3d/dag_lockSbuffer.h"
+#include "nau/memory/eastl_aliases.h"
 #include "nau/shaders/shader_globals.h"
 #include "nau/utils/dag_stlqsort.h"
 
@@ -321,6 +322,28 @@ namespace nau::render
         return v_perm_xyzd(zfar_plane, zfar_plane + Vector4(ofsDist));
     }
 
+    // the distances are computed once per light instead of twice per comparison
+    template <typename LightsManager>
+    static void sort_lights_by_distance(eastl::vector<uint16_t>& lights_id, const LightsManager& lights, Point3 cur_view_pos)
+    {
+        eastl::vector<eastl::pair<float, uint16_t>, nau::EastlFrameAllocator> distances;
+        distances.reserve(lights_id.size());
+        for (const uint16_t id : lights_id)
+        {
+            distances.emplace_back(float(lengthSqr(cur_view_pos - Point3(lights.getBoundingSphere(id).getXYZ()))), id);
+        }
+
+        stlsort::sort(distances.begin(), distances.end(), [](const eastl::pair<float, uint16_t>& a, const eastl::pair<float, uint16_t>& b)
+        {
+            return a.first < b.first;
+        });
+
+        for (size_t i = 0; i < distances.size(); ++i)
+        {
+            lights_id[i] = distances[i].second;
+        }
+    }
+
     void ClusteredLights::cullFrustumLights(Point3 cur_view_pos,
                                             const Matrix4& globtm,
                                             const Matrix4& view,
@@ -358,12 +381,7 @@ namespace nau::render
         if (visibleOmniLightsId.size() > MAX_OMNI_LIGHTS)
         {
             // Spotlights were always sorted, this is only here to move the farthests ones into the far buffer.
-            stlsort::sort(visibleOmniLightsId.begin(), visibleOmniLightsId.end(), [this, &cur_view_pos](uint16_t i, uint16_t j)
-            {
-                const float distI = lengthSqr(cur_view_pos - Point3(omniLights.getBoundingSphere(i).getXYZ()));
-                const float distJ = lengthSqr(cur_view_pos - Point3(omniLights.getBoundingSphere(j).getXYZ()));
-                return distI < distJ;
-            });
+            sort_lights_by_distance(visibleOmniLightsId, omniLights, cur_view_pos);
             auto oldFarSize = visibleFarOmniLightsId.size();
             auto excessSize = visibleOmniLightsId.size() - MAX_OMNI_LIGHTS;
             for (int k = MAX_OMNI_LIGHTS; k < MAX_OMNI_LIGHTS + excessSize; ++k)
@@ -394,12 +412,7 @@ namespace nau::render
                            cur_view_pos,
                            spot_light_mask);
 
-        stlsort::sort(visibleSpotLightsId.begin(), visibleSpotLightsId.end(), [this, &cur_view_pos](uint16_t i, uint16_t j)
-        {
-            const float distI = lengthSqr(cur_view_pos - Point3(spotLights.getBoundingSphere(i).getXYZ()));
-            const float distJ = lengthSqr(cur_view_pos - Point3(spotLights.getBoundingSphere(j).getXYZ()));
-            return distI < distJ;
-        });
+        sort_lights_by_distance(visibleSpotLightsId, spotLights, cur_view_pos);
         // separate close and far lights cb (so we can render more far lights easier)
         if (visibleSpotLightsId.size() > MAX_SPOT_LIGHTS)
         {
@@ -6,6 +6,7 @@
 
 #include "dag_occlusionTest.h"
 #include "lights_common.h"
+#include "nau/async/parallel_for.h"
 
 #define SHRINK_SPHERE 1
 #define VALIDATE_CLUSTERS 0
@@ -221,149 +222,192 @@ namespace nau::render
         if (!items.rects3d.size())
             return 0;
 
-        uint32_t currentMasksStart = 0, totalItemsCount = 0;
+        // the slice masks of each item are stored as [z0..z1] x [y0..y1] rows, so their positions are known before the fill
+        eastl::array<SpheresFillItem, ClusterGridItemMasks::MAX_ITEM_COUNT> fillItems;
+        uint32_t currentMasksStart = 0;
+        int firstSlice = CLUSTERS_D, lastSlice = -1;
+        for (int i = 0; i < items.rects3d.size(); ++i)
+        {
+            const ItemRect3D& grid = items.rects3d[i];
+            items.sliceMasksStart[i] = currentMasksStart;
+            fillItems[i].masksStart = currentMasksStart;
+            currentMasksStart += (grid.zmax - grid.zmin + 1) * (grid.rect.max_y - grid.rect.min_y + 1);
+            firstSlice = std::min(firstSlice, int(grid.zmin));
+            lastSlice = std::max(lastSlice, int(grid.zmax));
+
+#if SHRINK_SPHERE
+            const Vector4& lightViewSpace = lightsViewSpace[i];
+            Vector4 pt = proj * lightViewSpace;
+            fillItems[i].centerZ = lightViewSpace.getZ() <= znear ? -1 : getSliceAtDepth(lightViewSpace.getZ(), depthSliceScale, depthSliceBias);
+            fillItems[i].centerY = (abs(pt.getW()) > 0.001f)
+                                       ? floorf(CLUSTERS_H * (pt.getY() / pt.getW()) * -0.5f + 0.5)
+                                       : grid.rect.center_y;  //(grid->rect.max_y+grid->rect.min_y)/2;
+#endif
+        }
+        NAU_ASSERT(currentMasksStart <= items.sliceMasks.size());
+
+        // TIME_PROFILE(fillSlices);
+        // each slice is filled by one thread only, so the result masks (and the slice masks of the items) written by different threads never overlap;
+        // smaller sets are filled faster by the calling thread alone
+        constexpr size_t MinParallelItemsCount = 32;
+        async::Executor::Ptr executor = items.rects3d.size() >= MinParallelItemsCount ? async::Executor::getDefault() : nullptr;
+        async::ParallelFor fill{executor.get(), lastSlice >= firstSlice ? size_t(lastSlice - firstSlice + 1) : 0};
+
+        std::atomic<uint32_t> totalItemsCount = 0;
+        fill.run([&](size_t chunk, size_t)
+        {
+            const int z = firstSlice + int(chunk);
+            totalItemsCount.fetch_add(fillItemsSpheresSlice(items, lightsViewSpace, fillItems.data(), z, result_mask, word_count));
+        }, fillHelpersCompleted);
+
+        items.itemsListCount = totalItemsCount.load();
+        return items.itemsListCount;
+    }
+
+    uint32_t FrustumClusters::fillItemsSpheresSlice(ClusterGridItemMasks& items,
+                                                    const dag::RelocatableFixedVector<Vector4, ClusterGridItemMasks::MAX_ITEM_COUNT>& lightsViewSpace,
+                                                    const SpheresFillItem* fill_items,
+                                                    int z,
+                                                    uint32_t* result_mask,
+                                                    uint32_t word_count) const
+    {
+        uint32_t totalItemsCount = 0;
         const ItemRect3D* grid = items.rects3d.data();
         for (int i = 0; i < items.rects3d.size(); ++i, grid++)
         {
-            items.sliceMasksStart[i] = currentMasksStart;
+            int z0 = grid->zmin, z1 = grid->zmax;
+            if (z < z0 || z > z1)
+            {
+                continue;
+            }
 
             const uint32_t itemId = items.rects3d[i].itemId;
             uint32_t* resultMasksUse = result_mask + (itemId >> 5);
             const uint32_t itemMask = 1 << (itemId & 31);
 
             // int x_center = (grid->rect.max_x+grid->rect.min_x)/2;
-            int z0 = grid->zmin, z1 = grid->zmax;
             int y0 = grid->rect.min_y, y1 = grid->rect.max_y + 1;
             int x0 = grid->rect.min_x, x1 = grid->rect.max_x + 1;
+            uint32_t currentMasksStart = fill_items[i].masksStart + (z - z0) * (y1 - y0);
 
 #if !SHRINK_SPHERE
             const MaskType x_mask = ((MaskType(1) << MaskType(grid->rect.max_x)) | ((MaskType(1) << MaskType(grid->rect.max_x)) - 1)) &
                                     (~((MaskType(1) << MaskType(x0)) - 1));
-            totalItemsCount += (z1 - z0 + 1) * (y1 - y0) * (x1 - x0);
+            totalItemsCount += (y1 - y0) * (x1 - x0);
             (void)lightsViewSpace;
 #else
             const Vector4& lightViewSpace = *(lightsViewSpace.data() + i);
-            Vector4 pt = proj * lightsViewSpace[i];
             float radiusSq = lightViewSpace.getW() * lightViewSpace.getW();
-            int center_z = lightViewSpace.getZ() <= znear ? -1 : getSliceAtDepth(lightViewSpace.getZ(), depthSliceScale, depthSliceBias);
-            int center_y = (abs(pt.getW()) > 0.001f)
-                               ? floorf(CLUSTERS_H * (pt.getY() / pt.getW()) * -0.5f + 0.5)
-                               : grid->rect.center_y;  //(grid->rect.max_y+grid->rect.min_y)/2;
+            const int center_z = fill_items[i].centerZ;
+            const int center_y = fill_items[i].centerY;
+
+            Vector4 z_light_pos = lightViewSpace;
+            float z_lightRadiusSq = radiusSq;
+            if (z != center_z)
+            {
+                float planeSign = z < center_z ? 1.0f : -1.0f;
+                int zPlaneId = z < center_z ? z + 1 : z;
+                const float sliceDist = center_z < 0 ? znear : sliceDists[zPlaneId];
+                float zPlaneDist = planeSign * (lightViewSpace.getZ() - sliceDist);
+                z_light_pos.setZ(z_light_pos.getZ() - zPlaneDist * planeSign);
+                z_lightRadiusSq = max(0.f, radiusSq - zPlaneDist * zPlaneDist);
+                z_light_pos.setW(sqrtf(z_lightRadiusSq));
+                // NAU_CORE_DEBUG_LF("%d: z = %d lightViewSpace = %@ z_light_pos= %@ zPlaneDist = %@ plane = %f dist %f",
+                //   i, z, lightViewSpace, z_light_pos, zPlaneDist, planeSign, sliceDists[zPlaneId]);
+            }
+            Point2 z_light_pos2(z_light_pos.getY(), z_light_pos.getZ());
 #endif
-            for (int z = z0; z <= z1; z++)
+            const uint8_t* sliceNoRow = maxSlicesNo.data() + y0 * CLUSTERS_W;
+            for (int y = y0; y < y1; y++, currentMasksStart++, sliceNoRow += CLUSTERS_W)
             {
-#if SHRINK_SPHERE
-                Vector4 z_light_pos = lightViewSpace;
-                float z_lightRadiusSq = radiusSq;
-                if (z != center_z)
+                if (sliceNoRowMax[y] < z)
                 {
-                    float planeSign = z < center_z ? 1.0f : -1.0f;
-                    int zPlaneId = z < center_z ? z + 1 : z;
-                    const float sliceDist = center_z < 0 ? znear : sliceDists[zPlaneId];
-                    float zPlaneDist = planeSign * (lightViewSpace.getZ() - sliceDist);
-                    z_light_pos.setZ(z_light_pos.getZ() - zPlaneDist * planeSign);
-                    z_lightRadiusSq = max(0.f, radiusSq - zPlaneDist * zPlaneDist);
-                    z_light_pos.setW(sqrtf(z_lightRadiusSq));
-                    // NAU_CORE_DEBUG_LF("%d: z = %d lightViewSpace = %@ z_light_pos= %@ zPlaneDist = %@ plane = %f dist %f",
-                    //   i, z, lightViewSpace, z_light_pos, zPlaneDist, planeSign, sliceDists[zPlaneId]);
+                    continue;
                 }
-                Point2 z_light_pos2(z_light_pos.getY(), z_light_pos.getZ());
-#endif
-                uint8_t* sliceNoRow = maxSlicesNo.data() + y0 * CLUSTERS_W;
-                for (int y = y0; y < y1; y++, currentMasksStart++, sliceNoRow += CLUSTERS_W)
+#if SHRINK_SPHERE
+                // if (shrinkSphere.get())
                 {
-                    if (sliceNoRowMax[y] < z)
+                    Vector4 y_light_pos = z_light_pos;
+                    if (y != center_y)
+                    {  // Use original in the middle, shrunken sphere otherwise
+                        // project to plane
+                        // y_light = project_to_plane(y_light, plane);
+                        // const Point3 &plane = (y < center_y) ? y_planes.data()[y + 1] : -y_planes.data()[y];
+                        // float yPlaneT = dot(plane, *(Point3*)&y_light_pos);
+                        // y_light_pos += yPlaneT*plane.xyz;
+                        // y_light_pos.y -= yPlaneT*plane.y; y_light_pos.z -= yPlaneT*plane.z;
+
+                        const Point2& plane2 = (y < center_y) ? y_planes2.data()[y + 1] : y_planes2.data()[y] * (-1.f);
+                        float yPlaneT = dot(plane2, z_light_pos2);
+                        y_light_pos.setY(y_light_pos.getY() - yPlaneT * plane2.getX());
+                        y_light_pos.setZ(y_light_pos.getZ() - yPlaneT * plane2.getY());
+                        float y_lightRadiusSq = z_lightRadiusSq - yPlaneT * yPlaneT;
+                        if (y_lightRadiusSq < 0)
+                        {
+                            // NAU_CORE_DEBUG_LF("z=%d y=%d: plane=%@, dist = %@ z_light = %@ skip",z,y, plane, yPlaneT,
+                            //   z_light_pos);
+                            items.sliceMasks.data()[currentMasksStart] = 0;
+                            continue;
+                        }
+                        y_light_pos.setW(sqrtf(y_lightRadiusSq));
+                        // NAU_CORE_DEBUG_LF("z=%d y=%d: plane=%@, dist = %@ z_light = %@ y_light = %@",z,y, plane, yPlaneT,
+                        //   z_light_pos, y_light_pos);
+                    }
+                    Point2 y_light_pos2(y_light_pos.getX(), y_light_pos.getZ());
+                    int x = x0;
+                    do
+                    {  // Scan from left until with hit the sphere
+                        ++x;
+                    } while (x < x1 && (sliceNoRow[x] < z || dot(x_planes2.data()[x], y_light_pos2) >= y_light_pos.getW()));
+                    // while (x < x1 && dot(x_planes.data()[x], *(Point3*)&y_light_pos) >= y_light_pos.w);
+
+                    int xs = x1;
+                    do
+                    {  // Scan from right until with hit the sphere
+                        --xs;
+                    } while (xs >= x && (sliceNoRow[x] < z || -dot(x_planes2.data()[xs], y_light_pos2) >= y_light_pos.getW()));
+                    // while (xs >= x && -dot(x_planes.data()[xs], *(Point3*)&y_light_pos) >= y_light_pos.w);
+
+                    --x;
+                    uint32_t* resultMaskAt = resultMasksUse + (x + y * CLUSTERS_W + z * CLUSTERS_W * CLUSTERS_H) * word_count;
+
+#if NO_OCCLUSION
+                    items.sliceMasks.data()[currentMasksStart] =
+                        ((MaskType(1) << MaskType(xs)) | ((MaskType(1) << MaskType(xs)) - 1)) & (~((MaskType(1) << MaskType(x)) - 1));
+
+                    totalItemsCount += xs - x + 1;
+
+                    for (; x <= xs; x++, resultMaskAt += word_count)
                     {
-                        continue;
+                        *resultMaskAt |= itemMask;
                     }
-#if SHRINK_SPHERE
-                    // if (shrinkSphere.get())
+#else
+                    uint32_t mask = 0, bit = 1 << x;
+                    for (; x <= xs; x++, bit <<= 1, resultMaskAt += word_count)
                     {
-                        Vector4 y_light_pos = z_light_pos;
-                        if (y != center_y)
-                        {  // Use original in the middle, shrunken sphere otherwise
-                            // project to plane
-                            // y_light = project_to_plane(y_light, plane);
-                            // const Point3 &plane = (y < center_y) ? y_planes.data()[y + 1] : -y_planes.data()[y];
-                            // float yPlaneT = dot(plane, *(Point3*)&y_light_pos);
-                            // y_light_pos += yPlaneT*plane.xyz;
-                            // y_light_pos.y -= yPlaneT*plane.y; y_light_pos.z -= yPlaneT*plane.z;
-
-                            const Point2& plane2 = (y < center_y) ? y_planes2.data()[y + 1] : y_planes2.data()[y] * (-1.f);
-                            float yPlaneT = dot(plane2, z_light_pos2);
-                            y_light_pos.setY(y_light_pos.getY() - yPlaneT * plane2.getX());
-                            y_light_pos.setZ(y_light_pos.getZ() - yPlaneT * plane2.getY());
-                            float y_lightRadiusSq = z_lightRadiusSq - yPlaneT * yPlaneT;
-                            if (y_lightRadiusSq < 0)
-                            {
-                                // NAU_CORE_DEBUG_LF("z=%d y=%d: plane=%@, dist = %@ z_light = %@ skip",z,y, plane, yPlaneT,
-                                //   z_light_pos);
-                                items.sliceMasks.data()[currentMasksStart] = 0;
-                                continue;
-                            }
-                            y_light_pos.setW(sqrtf(y_lightRadiusSq));
-                            // NAU_CORE_DEBUG_LF("z=%d y=%d: plane=%@, dist = %@ z_light = %@ y_light = %@",z,y, plane, yPlaneT,
-                            //   z_light_pos, y_light_pos);
-                        }
-                        Point2 y_light_pos2(y_light_pos.getX(), y_light_pos.getZ());
-                        int x = x0;
-                        do
-                        {  // Scan from left until with hit the sphere
-                            ++x;
-                        } while (x < x1 && (sliceNoRow[x] < z || dot(x_planes2.data()[x], y_light_pos2) >= y_light_pos.getW()));
-                        // while (x < x1 && dot(x_planes.data()[x], *(Point3*)&y_light_pos) >= y_light_pos.w);
-
-                        int xs = x1;
-                        do
-                        {  // Scan from right until with hit the sphere
-                            --xs;
-                        } while (xs >= x && (sliceNoRow[x] < z || -dot(x_planes2.data()[xs], y_light_pos2) >= y_light_pos.getW()));
-                        // while (xs >= x && -dot(x_planes.data()[xs], *(Point3*)&y_light_pos) >= y_light_pos.w);
-
-                        --x;
-                        uint32_t* resultMaskAt = resultMasksUse + (x + y * CLUSTERS_W + z * CLUSTERS_W * CLUSTERS_H) * word_count;
-
-    #if NO_OCCLUSION
-                        items.sliceMasks.data()[currentMasksStart] =
-                            ((MaskType(1) << MaskType(xs)) | ((MaskType(1) << MaskType(xs)) - 1)) & (~((MaskType(1) << MaskType(x)) - 1));
-
-                        totalItemsCount += xs - x + 1;
-
-                        for (; x <= xs; x++, resultMaskAt += word_count)
+                        if (z <= sliceNoRow[x])
                         {
+                            totalItemsCount++;
                             *resultMaskAt |= itemMask;
+                            mask |= bit;
                         }
-    #else
-                        uint32_t mask = 0, bit = 1 << x;
-                        for (; x <= xs; x++, bit <<= 1, resultMaskAt += word_count)
-                        {
-                            if (z <= sliceNoRow[x])
-                            {
-                                totalItemsCount++;
-                                *resultMaskAt |= itemMask;
-                                mask |= bit;
-                            }
-                        }
-                        items.sliceMasks.data()[currentMasksStart] = mask;
-    #endif
-                        // if (lightsSliceMasks[currentMasksStart]!=x_mask)
-                        //   NAU_CORE_DEBUG_LF("save lights");
-                        // continue;
-                    }
-#else
-                    items.sliceMasks[currentMasksStart] = x_mask;
-                    uint32_t* resultMaskAt = resultMasksUse + (x0 + y * CLUSTERS_W + z * CLUSTERS_W * CLUSTERS_H) * word_count;
-                    for (int x = x0; x < x1; x++, resultMaskAt += word_count)
-                    {
-                        *resultMaskAt |= itemMask;
                     }
+                    items.sliceMasks.data()[currentMasksStart] = mask;
 #endif
+                    // if (lightsSliceMasks[currentMasksStart]!=x_mask)
+                    //   NAU_CORE_DEBUG_LF("save lights");
+                    // continue;
+                }
+#else
+                items.sliceMasks[currentMasksStart] = x_mask;
+                uint32_t* resultMaskAt = resultMasksUse + (x0 + y * CLUSTERS_W + z * CLUSTERS_W * CLUSTERS_H) * word_count;
+                for (int x = x0; x < x1; x++, resultMaskAt += word_count)
+                {
+                    *resultMaskAt |= itemMask;
                 }
+#endif
             }
-            // currentMasksStart += (grid->zmax-grid->zmin+1) * (grid->rect.max_y-grid->rect.min_y+1);
         }
-        NAU_ASSERT(currentMasksStart <= items.sliceMasks.size());
-        items.itemsListCount = totalItemsCount;
         return totalItemsCount;
     }
 
@@ -12,6 +12,7 @@
 #include "dag_vecMath_est.h"
 #include "frustumClipRegion.h"
 #include "nau/math/dag_frustum.h"
+#include "nau/threading/event.h"
 #include "nau/utils/dag_relocatableFixedVector.h"
 
 namespace nau::render
@@ -118,11 +119,27 @@ namespace nau::render
                                           dag::RelocatableFixedVector<ItemRect3D, ClusterGridItemMasks::MAX_ITEM_COUNT>& rects3d,
                                           dag::RelocatableFixedVector<math::Vector4, ClusterGridItemMasks::MAX_ITEM_COUNT>& spheresViewSpace);
 
+        // item data computed before the slices are filled
+        struct SpheresFillItem
+        {
+            uint32_t masksStart;  // first slice mask of the item in ClusterGridItemMasks::sliceMasks
+            int centerZ, centerY;
+        };
+
+        // the depth slices are filled in parallel by the default executor threads
         uint32_t fillItemsSpheresGrid(ClusterGridItemMasks& items,
                                       const dag::RelocatableFixedVector<math::Vector4, ClusterGridItemMasks::MAX_ITEM_COUNT>& lightsViewSpace,
                                       uint32_t* result_mask,
                                       uint32_t word_count);
 
+        // fills the masks of the depth slice z, returns the count of the items added to its clusters
+        uint32_t fillItemsSpheresSlice(ClusterGridItemMasks& items,
+                                       const dag::RelocatableFixedVector<math::Vector4, ClusterGridItemMasks::MAX_ITEM_COUNT>& lightsViewSpace,
+                                       const SpheresFillItem* fill_items,
+                                       int z,
+                                       uint32_t* result_mask,
+                                       uint32_t word_count) const;
+
         uint32_t fillItemsSpheres(const math::Vector4* pos_radius,
                                   int aligned_stride,
                                   int count,
@@ -155,5 +172,6 @@ namespace nau::render
         float depthSliceScale = 1, depthSliceBias = 0, minSliceDist = 0, maxSliceDist = 1, znear = 0.01;
 
         nau::math::Matrix4 view, proj;  //-V730_NOINIT
+        threading::Event fillHelpersCompleted;
     };
 }  // namespace nau::render
\ No newline at end of file
@@ -9,6 +9,7 @@
 
 #include "lights_common.h"
 #include "nau/debugRenderer/debug_render_system.h"
+#include "nau/math/dag_lsbVisitor.h"
 
 namespace nau::render
 {
@@ -114,54 +115,60 @@ namespace nau::render
         lightsInside.reserve(reserveSize);
         lightsOutside.reserve(reserveSize);
         Vector4 rad_scale = Vector4(1.1f);
-        for (int i = 0; i <= maxLightIndex; ++i)
+
+        // hierarchical culling: the grid cells are tested first, then the lights of the partially visible cells
+        eastl::array<uint32_t, MAX_LIGHTS / 32> visibleLights;
+        const size_t wordCount = (maxLightIndex + 32) / 32;
+        lightsGrid.cull(frustum, visibleLights.data(), wordCount);
+
+        for (size_t word = 0; word < wordCount; ++word)
         {
-            if (!(accept_mask & masks[i]))
-            {
-                continue;
-            }
-            const RawLight& l = rawLights[i];
-            if (l.pos_radius.w <= 0)
+            for (const uint32_t bit : nau::math::LsbVisitor{visibleLights[word]})
             {
-                continue;
-            }
-            nau::math::Vector4 lightPosRad = Vector4(l.pos_radius.toVec4());
-            float rad = lightPosRad.getW();
-            if (!frustum.testSphereB(lightPosRad.getXYZ(), Vector4(rad)))
-            {
-                //continue;
-            }
-            /* TODO Support occlusion
-            if (occlusion && occlusion->isOccludedSphere(lightPosRad, rad))
-                continue;
-            */
-            if (visibleIdBitset)
-            {
-                visibleIdBitset->set(i, true);
-            }
+                const int i = static_cast<int>(word * 32 + bit);
+                if (!(accept_mask & masks[i]))
+                {
+                    continue;
+                }
+                const RawLight& l = rawLights[i];
+                if (l.pos_radius.w <= 0)
+                {
+                    continue;
+                }
+                nau::math::Vector4 lightPosRad = Vector4(l.pos_radius.toVec4());
+                float rad = lightPosRad.getW();
+                /* TODO Support occlusion
+                if (occlusion && occlusion->isOccludedSphere(lightPosRad, rad))
+                    continue;
+                */
+                if (visibleIdBitset)
+                {
+                    visibleIdBitset->set(i, true);
+                }
 
-            nau::math::Vector4 radScaled = rad_scale * rad;
-            float res = lightPosRad.getX() * znear_plane.getX() - radScaled.getX() + znear_plane.getW();
-            float length_sq = float(lengthSqr(cameraPos - math::Point3(lightPosRad.getXYZ())));
-            float camInSphereVec = length_sq - rad * rad;
+                nau::math::Vector4 radScaled = rad_scale * rad;
+                float res = lightPosRad.getX() * znear_plane.getX() - radScaled.getX() + znear_plane.getW();
+                float length_sq = float(lengthSqr(cameraPos - math::Point3(lightPosRad.getXYZ())));
+                float camInSphereVec = length_sq - rad * rad;
 
-            bool intersectsNear = res < 0;
-            bool camInSphere = camInSphereVec < 0;
+                bool intersectsNear = res < 0;
+                bool camInSphere = camInSphereVec < 0;
 
-            lightsOutside.push_back(i);//TODO: remove when the division of light sources into distant and close ones will be used
+                lightsOutside.push_back(i);//TODO: remove when the division of light sources into distant and close ones will be used
 
-            bool smallLight = shadows[i] == shadow_index_t(~0) && is_viewed_small(lightPosRad.getW(), length_sq, markSmallLightsAsFarLimit);
-            if ((intersectsNear || smallLight) && !camInSphere)
-            {
-                inside_box += lightPosRad.getXYZ() - Vector3(rad);
-                inside_box += lightPosRad.getXYZ() + Vector3(rad);
-                //lightsInside.push_back(i);
-            }
-            else
-            {
-                outside_box += lightPosRad.getXYZ() - Vector3(rad);
-                outside_box += lightPosRad.getXYZ() + Vector3(rad);
-                //lightsOutside.push_back(i);
+                bool smallLight = shadows[i] == shadow_index_t(~0) && is_viewed_small(lightPosRad.getW(), length_sq, markSmallLightsAsFarLimit);
+                if ((intersectsNear || smallLight) && !camInSphere)
+                {
+                    inside_box += lightPosRad.getXYZ() - Vector3(rad);
+                    inside_box += lightPosRad.getXYZ() + Vector3(rad);
+                    //lightsInside.push_back(i);
+                }
+                else
+                {
+                    outside_box += lightPosRad.getXYZ() - Vector3(rad);
+                    outside_box += lightPosRad.getXYZ() + Vector3(rad);
+                    //lightsOutside.push_back(i);
+                }
             }
         }
     }
@@ -227,6 +234,7 @@ namespace nau::render
         rawLights[id] = l;
         masks[id] = ~mask_type_t(0);
         lightPriority[id] = priority;
+        updateGridSphere(id);
         return id;
     }
 
@@ -254,6 +262,7 @@ namespace nau::render
 
         memset(&rawLights[id], 0, sizeof(rawLights[id]));
         masks[id] = 0;
+        lightsGrid.remove(id);
 
         if (id == maxLightIndex)
         {
@@ -275,6 +284,7 @@ namespace nau::render
     void OmniLightsManager::destroyAllLights()
     {
         maxLightIndex = -1;
+        lightsGrid.clear();
         freeLightIds.clear();
     }
     /*
@@ -9,6 +9,7 @@
 
 #include "lights_common.h"
 #include "nau/debugRenderer/debug_render_system.h"
+#include "nau/math/dag_lsbVisitor.h"
 
 namespace nau::render
 {
@@ -29,6 +30,7 @@ namespace nau::render
         mem_set_0(freeLightIds);
         freeLightIds.clear();
         nonOptLightIds.reset();
+        lightsGrid.clear();
         /* TODO: Support photometry
         photometryTextures = IesTextureCollection::acquireRef();
         */
@@ -66,55 +68,59 @@ namespace nau::render
         using nau::math::Vector4;
         inside_box.setempty();
         outside_box.setempty();
-        const Vector4* boundings = (Vector4*)boundingSpheres.data();
-        for (int i = 0; i <= maxLightIndex; ++i, boundings++)
-        {
-            if (!(accept_mask & masks[i]))
-            {
-                continue;
-            }
-            const RawLight& l = rawLights[i];
-            if (l.pos_radius.w <= 0)
-            {
-                continue;
-            }
-            Vector4 lightPosRad = *boundings;
-            float rad = lightPosRad.getW();
-            if (!frustum.testSphereB(lightPosRad.getXYZ(), Vector4{rad}))  // completely not visible
-            {
-                continue;
-            }
-            // if (occlusion && occlusion->isOccludedSphere(lightPosRad, rad))
-            //   continue;
-            /* TODO Support occlusion
-            if (occlusion && occlusion->isOccludedBox(boundingBoxes[i]))
-                continue;
-            */
-            if (visibleIdBitset)
-                visibleIdBitset->set(i, true);
-
-            float res = lightPosRad.getX() * znear_plane.getX() - rad + znear_plane.getW();
-            float length_sq = distSqr(cameraPos, math::Point3(lightPosRad.getXYZ()));
-            float camInSphereVec = length_sq - rad * rad;
-
-            bool intersectsNear = res < 0;
-            bool camInSphere = camInSphereVec < 0;
-
-            const bool smallLight = shadows[i] == shadow_index_t(~0) && is_viewed_small(lightPosRad.getX(), length_sq, markSmallLightsAsFarLimit);
+        // hierarchical culling: the grid cells are tested first, then the lights of the partially visible cells
+        eastl::array<uint32_t, MAX_LIGHTS / 32> visibleLights;
+        const size_t wordCount = (maxLightIndex + 32) / 32;
+        lightsGrid.cull(frustum, visibleLights.data(), wordCount);
 
-            lights_outside_plane.push_back(i);//TODO: remove when the division of light sources into distant and close ones will be used
-
-            if ((intersectsNear || smallLight) && !camInSphere)
-            {
-                inside_box += lightPosRad.getXYZ() - Vector3(rad);
-                inside_box += lightPosRad.getXYZ() + Vector3(rad);
-                //lights_inside_plane.push_back(i);
-            }
-            else
+        for (size_t word = 0; word < wordCount; ++word)
+        {
+            for (const uint32_t bit : nau::math::LsbVisitor{visibleLights[word]})
             {
-                outside_box += lightPosRad.getXYZ() - Vector3(rad);
-                outside_box += lightPosRad.getXYZ() + Vector3(rad);
-                //lights_outside_plane.push_back(i);
+                const int i = static_cast<int>(word * 32 + bit);
+                if (!(accept_mask & masks[i]))
+                {
+                    continue;
+                }
+                const RawLight& l = rawLights[i];
+                if (l.pos_radius.w <= 0)
+                {
+                    continue;
+                }
+                Vector4 lightPosRad = boundingSpheres[i];
+                float rad = lightPosRad.getW();
+                // if (occlusion && occlusion->isOccludedSphere(lightPosRad, rad))
+                //   continue;
+                /* TODO Support occlusion
+                if (occlusion && occlusion->isOccludedBox(boundingBoxes[i]))
+                    continue;
+                */
+                if (visibleIdBitset)
+                    visibleIdBitset->set(i, true);
+
+                float res = lightPosRad.getX() * znear_plane.getX() - rad + znear_plane.getW();
+                float length_sq = distSqr(cameraPos, math::Point3(lightPosRad.getXYZ()));
+                float camInSphereVec = length_sq - rad * rad;
+
+                bool intersectsNear = res < 0;
+                bool camInSphere = camInSphereVec < 0;
+
+                const bool smallLight = shadows[i] == shadow_index_t(~0) && is_viewed_small(lightPosRad.getX(), length_sq, markSmallLightsAsFarLimit);
+
+                lights_outside_plane.push_back(i);//TODO: remove when the division of light sources into distant and close ones will be used
+
+                if ((intersectsNear || smallLight) && !camInSphere)
+                {
+                    inside_box += lightPosRad.getXYZ() - Vector3(rad);
+                    inside_box += lightPosRad.getXYZ() + Vector3(rad);
+                    //lights_inside_plane.push_back(i);
+                }
+                else
+                {
+                    outside_box += lightPosRad.getXYZ() - Vector3(rad);
+                    outside_box += lightPosRad.getXYZ() + Vector3(rad);
+                    //lights_outside_plane.push_back(i);
+                }
             }
         }
     }
@@ -192,6 +198,7 @@ namespace nau::render
         setLightOptimized(id);
         memset(&rawLights[id], 0, sizeof(rawLights[id]));
         masks[id] = 0;
+        lightsGrid.remove(id);
 
         if (id == maxLightIndex)
         {
@@ -213,6 +220,7 @@ namespace nau::render
     void SpotLightsManager::destroyAllLights()
     {
         maxLightIndex = -1;
+        lightsGrid.clear();
         freeLightIds.clear();
         nonOptLightIds.reset();
     }
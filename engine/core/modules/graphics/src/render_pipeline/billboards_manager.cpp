@@ -86,7 +86,8 @@ namespace nau
         }
     }
 
-    RenderList::Ptr BillboardsManager::getRenderList(const nau::math::Vector3& viewerPosition,
+    RenderList::Ptr BillboardsManager::getRenderList(const ViewLodParams& lodParams,
+        const nau::math::NauFrustum& frustum,
         eastl::function<bool(const InstanceInfo&)>& filterFunc,
         eastl::function<bool(const nau::MaterialAssetView::Ptr)>& materialFilter)
     {
@@ -8,7 +8,9 @@
 
 #include "nau/3d/dag_drv3d.h"
 #include "nau/math/dag_bounds3.h"
+#include "nau/math/dag_frustum.h"
 #include "graphics_assets/material_asset.h"
+#include "lod_selection.h"
 #include "render_entity.h"
 #include "render_list.h"
 
@@ -24,17 +26,31 @@ namespace nau
     };
 
 
+    struct InstanceBucketSlot
+    {
+        uint32_t bucketIndex;
+        uint32_t indexInBucket;
+    };
+
+
     struct InstanceInfo
     {
         InstanceID id;
 
         nau::math::Matrix4 worldMatrix;
+        nau::math::Matrix4 normalMatrix;  // transpose(inverse(worldMatrix)), updated together with the world matrix
         nau::math::BSphere3 worldSphere;
         nau::math::BSphere3 localSphere;
 
         eastl::map<uint64_t, MaterialOverrideInfo> overrideInfo;
         bool toDelete = false;
 
+        // Index of the instance bounds within the group culling data (maintained by the instance group)
+        uint32_t cullingIndex = ~0u;
+
+        // Instance buckets the instance belongs to and its positions within them (maintained by the instance group)
+        eastl::vector<InstanceBucketSlot> bucketSlots;
+
         // RenderParameters
         RenderTags tags;
         bool isVisible = true;
@@ -53,7 +69,8 @@ namespace nau
         virtual void removeInstance(InstanceID instID) = 0;
         virtual bool contains(InstanceID instID) const = 0;
         virtual RenderEntity createRenderEntity() = 0;
-        virtual RenderList::Ptr createRenderList(const nau::math::Vector3& viewerPosition, 
+        virtual RenderList::Ptr createRenderList(const ViewLodParams& lodParams,
+            const nau::math::NauFrustum& frustum,
             eastl::function<bool(const InstanceInfo&)>& filterFunc,
             eastl::function<bool(const nau::MaterialAssetView::Ptr)>& materialFilter) = 0;
 
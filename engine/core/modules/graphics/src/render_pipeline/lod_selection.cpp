@@ -0,0 +1,68 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "lod_selection.h"
+
+#include <cmath>
+#include <limits>
+
+
+namespace nau
+{
+    namespace
+    {
+        float getLodThreshold(const GraphicsLodConfig& config, eastl::span<const float> lodsScreenSize, uint32_t lodLevel)
+        {
+            if (lodLevel < lodsScreenSize.size())
+            {
+                return lodsScreenSize[lodLevel];
+            }
+
+            return config.firstLodScreenSize * std::pow(config.lodScreenSizeStep, static_cast<float>(lodLevel - 1));
+        }
+    }  // namespace
+
+    float getLodScreenSize(const ViewLodParams& params, const nau::math::BSphere3& worldSphere)
+    {
+        const float distance = static_cast<float>(nau::math::length(worldSphere.c - params.viewerPosition));
+        if (distance <= worldSphere.r)
+        {
+            return std::numeric_limits<float>::max();
+        }
+
+        // projected diameter relative to the view height (the height is 2 in the clip space)
+        const float screenSize = worldSphere.r * params.screenScale / distance;
+        return screenSize * std::exp2(-params.config.lodBias);
+    }
+
+    uint32_t selectLod(const ViewLodParams& params, float screenSize, uint32_t lodsCount, eastl::span<const float> lodsScreenSize, uint32_t currentLod)
+    {
+        if (params.screenScale <= 0.f || lodsCount <= 1)
+        {
+            return 0;
+        }
+
+        const float hysteresis = params.config.hysteresis;
+
+        // Thresholds that have already been passed are left only when the size grows above the band,
+        // the next ones are passed only when the size drops below the band.
+        uint32_t lodLevel = 0;
+        while (lodLevel + 1 < lodsCount)
+        {
+            const uint32_t nextLevel = lodLevel + 1;
+            const bool isPassed = currentLod != InvalidLodLevel && nextLevel <= currentLod;
+            const float threshold = getLodThreshold(params.config, lodsScreenSize, nextLevel) * (isPassed ? 1.f + hysteresis : 1.f - hysteresis);
+
+            if (screenSize >= threshold)
+            {
+                break;
+            }
+
+            lodLevel = nextLevel;
+        }
+
+        return lodLevel;
+    }
+
+}  // namespace nau
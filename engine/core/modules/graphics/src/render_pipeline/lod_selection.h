@@ -0,0 +1,73 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/span.h>
+
+#include "nau/math/dag_bounds3.h"
+#include "nau/math/math.h"
+#include "nau/meta/class_info.h"
+
+
+namespace nau
+{
+    /**
+     * @brief Mesh level of detail settings (read from "/graphics/lod").
+     *
+     * The screen size is the projected diameter of the mesh bounding sphere relative to the view height.
+     */
+    struct GraphicsLodConfig
+    {
+        // Positive values select less detailed lods, each 1.0 halves the screen size used for the selection.
+        float lodBias = 0.f;
+
+        // Relative screen size band around a lod threshold within which the previously selected lod is kept.
+        float hysteresis = 0.1f;
+
+        // Thresholds used when the mesh does not provide its own: lod i is selected below firstLodScreenSize * lodScreenSizeStep^(i - 1).
+        float firstLodScreenSize = 0.5f;
+        float lodScreenSizeStep = 0.5f;
+
+        NAU_CLASS_FIELDS(
+            CLASS_FIELD(lodBias),
+            CLASS_FIELD(hysteresis),
+            CLASS_FIELD(firstLodScreenSize),
+            CLASS_FIELD(lodScreenSizeStep))
+    };
+
+    /**
+     * @brief Describes how a view selects the mesh lods.
+     */
+    struct ViewLodParams
+    {
+        // Index of the view within the render scene: the selected lods are kept per view for the hysteresis.
+        uint32_t viewIndex = 0;
+
+        nau::math::Vector3 viewerPosition = nau::math::Vector3::zero();
+
+        // Vertical scale of the view projection (cot(fovY / 2)). Zero disables the lod selection (lod 0 is always used).
+        float screenScale = 0.f;
+
+        GraphicsLodConfig config;
+    };
+
+    // Lod level that has not been selected yet
+    inline constexpr uint8_t InvalidLodLevel = 0xFF;
+
+    /**
+     * @brief Computes the biased screen size of the bounding sphere.
+     */
+    float getLodScreenSize(const ViewLodParams& params, const nau::math::BSphere3& worldSphere);
+
+    /**
+     * @brief Selects the lod for the screen size.
+     *
+     * @param [in] lodsScreenSize   Screen size thresholds provided by the mesh (element i - the size below which lod i is used),
+     *                              the config thresholds are used when it is empty.
+     * @param [in] currentLod       The lod selected by the view at the previous frame or InvalidLodLevel.
+     */
+    uint32_t selectLod(const ViewLodParams& params, float screenSize, uint32_t lodsCount, eastl::span<const float> lodsScreenSize, uint32_t currentLod);
+
+}  // namespace nau
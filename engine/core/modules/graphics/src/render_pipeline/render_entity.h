@@ -46,7 +46,12 @@ namespace nau
 
         uint32_t startInstance;
         uint32_t instancesCount;
-        eastl::vector<InstanceData> instanceData;
+
+        // Instances of the entity: indices into the instance data kept by the producer of the entity.
+        // The data is copied into the view instance buffer by RenderView::prepareInstanceData.
+        const InstanceData* instanceSource = nullptr;
+        eastl::vector<uint32_t> instanceIndices;
+        bool hasHighlightedInstances = false;
 
         nau::Ptr<nau::MaterialAssetView> material;
 
@@ -8,8 +8,17 @@
 
 nau::RenderList::RenderList(eastl::vector<RenderList::Ptr>&& vec)
 {
-    for (auto rendList : vec)
+    size_t entitiesCount = 0;
+    for (const auto& rendList : vec)
     {
-        m_entities.insert(m_entities.end(), rendList->m_entities.begin(), rendList->m_entities.end());
+        entitiesCount += rendList->m_entities.size();
+    }
+
+    // the merged lists are not used after the merge, so the entities (and their instance data) are moved instead of copied
+    m_entities.reserve(entitiesCount);
+    for (auto& rendList : vec)
+    {
+        m_entities.insert(m_entities.end(), eastl::make_move_iterator(rendList->m_entities.begin()), eastl::make_move_iterator(rendList->m_entities.end()));
+        rendList->m_entities.clear();
     }
 }
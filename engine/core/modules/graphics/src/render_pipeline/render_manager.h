@@ -15,7 +15,8 @@ namespace nau
 
     public:
         virtual void update() = 0;
-        virtual RenderList::Ptr getRenderList(const nau::math::Vector3& viewerPosition,
+        virtual RenderList::Ptr getRenderList(const ViewLodParams& lodParams,
+            const nau::math::NauFrustum& frustum,
             eastl::function<bool(const InstanceInfo&)>& filterFunc,
             eastl::function<bool(const nau::MaterialAssetView::Ptr)>& materialFilter) = 0;
     };
@@ -4,6 +4,8 @@
 
 #include "render_scene.h"
 
+#include "nau/app/global_properties.h"
+#include "nau/service/service_provider.h"
 #include "nau/utils/performance_profiling.h"
 
 #include "nau/render/cascadeShadows.h"
@@ -21,6 +23,14 @@ namespace nau
         nau::MaterialAssetRef billboardsMatRef = AssetPath{"file:/res/materials/billboards.nmat_json" };
         auto billboardsMaterialTask = billboardsMatRef.getAssetViewTyped<MaterialAssetView>();
 
+        if (GlobalProperties* const properties = getServiceProvider().find<GlobalProperties>())
+        {
+            if (auto lodConfig = properties->getValue<GraphicsLodConfig>("/graphics/lod"))
+            {
+                m_lodConfig = *lodConfig;
+            }
+        }
+
         co_await async::whenAll(Expiration::never(), zPrepassMaterialTask, billboardsMaterialTask, outlineMaterialTask);
 
         m_zPrepassMaterial = *zPrepassMaterialTask;
@@ -59,14 +69,32 @@ namespace nau
         return m_billboardsManager;
     }
 
+    void RenderScene::setLodConfig(const GraphicsLodConfig& config)
+    {
+        m_lodConfig = config;
+    }
+
+    const GraphicsLodConfig& RenderScene::getLodConfig() const
+    {
+        return m_lodConfig;
+    }
+
     void RenderScene::updateViews(const nau::math::Matrix4& vp)
     {
-        for (auto& view : m_views)
+        for (uint32_t viewIndex = 0; viewIndex < m_views.size(); ++viewIndex)
         {
+            auto& view = m_views[viewIndex];
+
+            ViewLodParams lodParams;
+            lodParams.viewIndex = viewIndex;
+            lodParams.viewerPosition = view->getLodViewerPosition();
+            lodParams.screenScale = view->getLodScreenScale();
+            lodParams.config = m_lodConfig;
+
             view->clearLists();
             for (auto& manager : m_managers)
             {
-                view->addRenderList(manager->getRenderList({}, view->getInstanceFilter(), view->getMaterialFilter()));
+                view->addRenderList(manager->getRenderList(lodParams, view->getFrustum(), view->getInstanceFilter(), view->getMaterialFilter()));
             }
             view->prepareInstanceData();
         }
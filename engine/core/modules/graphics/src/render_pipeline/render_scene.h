@@ -48,6 +48,9 @@ namespace nau
 
         nau::Ptr<BillboardsManager> getBillboardsManager();
 
+        void setLodConfig(const GraphicsLodConfig& config);
+        const GraphicsLodConfig& getLodConfig() const;
+
         void updateViews(const nau::math::Matrix4& vp);
         void updateManagers();
         void renderScene(const nau::math::Matrix4& vp);
@@ -72,6 +75,8 @@ namespace nau
 
         nau::Ptr<BillboardsManager> m_billboardsManager;
 
+        GraphicsLodConfig m_lodConfig;
+
         MaterialAssetView::Ptr m_zPrepassMaterial;
         MaterialAssetView::Ptr m_outlineMaterial;
 
@@ -6,6 +6,7 @@
 
 #include "nau/shaders/shader_globals.h"
 
+#include <EASTL/algorithm.h>
 #include <EASTL/functional.h>
 
 
@@ -34,11 +35,6 @@ nau::RenderView::RenderView(eastl::string_view viewName) :
         nau::shader_globals::addVariable("uid", sizeof(math::IVector4), &uid);
     }
 
-    m_instanceFilter = eastl::function<bool(const InstanceInfo&)>([this](const InstanceInfo& info) 
-        {
-            return m_frustum.testSphere(info.worldSphere) != 0;
-        });
-
     m_materialFilter = eastl::function<bool(const MaterialAssetView::Ptr)>([](const MaterialAssetView::Ptr material) 
         {
             nau::BlendMode mode = material->getBlendMode("default");
@@ -145,12 +141,7 @@ void nau::RenderView::renderOutlineMask(const nau::math::Matrix4& vp, nau::Mater
     {
         for (auto& ent : list->getEntities())
         {
-            auto highlightedIt = std::find_if(ent.instanceData.begin(), ent.instanceData.end(),
-                                              [](auto& data) -> bool
-            {
-                return data.isHighlighted;
-            });
-            if (highlightedIt == ent.instanceData.end())
+            if (!ent.hasHighlightedInstances)
             {
                 continue;
             }
@@ -171,14 +162,42 @@ void nau::RenderView::updateFrustum(const nau::math::Matrix4& vp)
     m_frustum = nau::math::NauFrustum(vp);
 }
 
+void nau::RenderView::setLodViewer(const nau::math::Vector3& viewerPosition, float screenScale)
+{
+    m_lodViewerPosition = viewerPosition;
+    m_lodScreenScale = screenScale;
+}
+
+const nau::math::Vector3& nau::RenderView::getLodViewerPosition() const
+{
+    return m_lodViewerPosition;
+}
+
+float nau::RenderView::getLodScreenScale() const
+{
+    return m_lodScreenScale;
+}
+
+const nau::RenderView::Stats& nau::RenderView::getStats() const
+{
+    return m_stats;
+}
+
 void nau::RenderView::prepareInstanceData()
 {
+    m_stats = {};
+
     uint32_t instsCount = 0;
     for (auto& list : m_lists)
     {
-        for (const auto& ent : list->getEntities())
+        for (auto& ent : list->getEntities())
         {
-            instsCount += ent.instancesCount;
+            ent.startInstance = instsCount;
+            instsCount += ent.instanceIndices.size();
+
+            m_stats.entitiesCount++;
+            m_stats.instancesCount += ent.instancesCount;
+            m_stats.trianglesCount += uint64_t((ent.endIndex - ent.startIndex) / 3) * ent.instancesCount;
         }
     }
 
@@ -187,18 +206,6 @@ void nau::RenderView::prepareInstanceData()
         return;
     }
 
-    eastl::vector<nau::RenderEntity::InstanceData> instDataVec;
-    instDataVec.reserve(instsCount);
-
-    for (auto& list : m_lists)
-    {
-        for (auto& ent : list->getEntities())
-        {
-            ent.startInstance = instDataVec.size();
-            instDataVec.insert(instDataVec.end(), ent.instanceData.begin(), ent.instanceData.end());
-        }
-    }
-
     if (m_maxInstancesCount < instsCount)
     {
         m_maxInstancesCount = instsCount;
@@ -212,8 +219,28 @@ void nau::RenderView::prepareInstanceData()
     }
     NAU_ASSERT(m_instanceData);
 
-    bool isUpdated = m_instanceData->updateData(0, sizeof(nau::RenderEntity::InstanceData) * instsCount, instDataVec.data(), VBLOCK_WRITEONLY | VBLOCK_DISCARD);
-    NAU_ASSERT(isUpdated);
+    // instance data is gathered from the producers straight into the mapped buffer
+    nau::RenderEntity::InstanceData* mappedData = nullptr;
+    const bool isLocked = m_instanceData->lockEx(0, sizeof(nau::RenderEntity::InstanceData) * instsCount, &mappedData, VBLOCK_WRITEONLY | VBLOCK_DISCARD);
+    NAU_ASSERT(isLocked);
+    if (!isLocked)
+    {
+        return;
+    }
+
+    for (auto& list : m_lists)
+    {
+        for (const auto& ent : list->getEntities())
+        {
+            nau::RenderEntity::InstanceData* entityData = mappedData + ent.startInstance;
+            for (const uint32_t index : ent.instanceIndices)
+            {
+                *entityData++ = ent.instanceSource[index];
+            }
+        }
+    }
+
+    m_instanceData->unlock();
 }
 
 bool nau::RenderView::containsTag(RenderTag tag)
@@ -18,6 +18,16 @@ namespace nau
     class RenderView
     {
     public:
+        /**
+         * @brief Geometry submitted by the view at the current frame.
+         */
+        struct Stats
+        {
+            uint32_t entitiesCount = 0;
+            uint32_t instancesCount = 0;
+            uint64_t trianglesCount = 0;
+        };
+
         RenderView(eastl::string_view viewName);
         virtual ~RenderView();
 
@@ -31,6 +41,19 @@ namespace nau
 
         void updateFrustum(const nau::math::Matrix4& vp);
 
+        /**
+         * @brief Sets the viewer used for the mesh lod selection.
+         *
+         * @param [in] screenScale  Vertical scale of the viewer projection (cot(fovY / 2)), zero disables the lod selection.
+         */
+        void setLodViewer(const nau::math::Vector3& viewerPosition, float screenScale);
+
+        const nau::math::Vector3& getLodViewerPosition() const;
+        float getLodScreenScale() const;
+
+        // Updated by prepareInstanceData()
+        const Stats& getStats() const;
+
         void prepareInstanceData();
 
         const nau::math::NauFrustum& getFrustum() const
@@ -46,6 +69,7 @@ namespace nau
         void* getUserData();
 
 
+        // Additional instance filter applied after the frustum culling (empty - no filtering)
         eastl::function<bool(const InstanceInfo&)>& getInstanceFilter();
         void setInstanceFilter(eastl::function<bool(const InstanceInfo&)>& filter);
 
@@ -64,6 +88,11 @@ namespace nau
 
         RenderTags m_tags;
 
+        nau::math::Vector3 m_lodViewerPosition = nau::math::Vector3::zero();
+        float m_lodScreenScale = 0.f;
+
+        Stats m_stats;
+
         void* m_userData = nullptr;
     };
 
@@ -24,7 +24,8 @@ namespace nau
         return eastl::move(ret);
     }
 
-    RenderList::Ptr nau::SkinnedMeshManager::getRenderList(const nau::math::Vector3& viewerPosition,
+    RenderList::Ptr nau::SkinnedMeshManager::getRenderList(const ViewLodParams& lodParams,
+        const nau::math::NauFrustum& frustum,
         eastl::function<bool(const InstanceInfo&)>& filterFunc,
         eastl::function<bool(const nau::MaterialAssetView::Ptr)>& materialFilter)
     {
@@ -59,8 +60,20 @@ namespace nau
 
             nau::Ptr<SkinnedMeshAssetView> skinnedMeshView;
             skinnedMesh->getTyped<SkinnedMeshAssetView>(skinnedMeshView);
+            const SkinnedMesh& mesh = *skinnedMeshView->getMesh();
 
-            const SkinnedMeshLod& lod = skinnedMeshView->getMesh()->getLod(0);
+            eastl::vector<uint8_t>& viewLods = skinnedMeshInstance->m_viewLods;
+            if (viewLods.size() <= lodParams.viewIndex)
+            {
+                viewLods.resize(lodParams.viewIndex + 1, InvalidLodLevel);
+            }
+
+            const nau::math::BSphere3 worldSphere{skinnedMeshInstance->worldMatrix.getTranslation(), mesh.getLod0BSphere().r};
+            const float screenSize = getLodScreenSize(lodParams, worldSphere);
+            const uint32_t lodLevel = selectLod(lodParams, screenSize, mesh.getLodsCount(), mesh.getLodsScreenSize(), viewLods[lodParams.viewIndex]);
+            viewLods[lodParams.viewIndex] = static_cast<uint8_t>(lodLevel);
+
+            const SkinnedMeshLod& lod = mesh.getLod(lodLevel);
             ent.positionBuffer = lod.m_positionsBuffer;
             ent.normalsBuffer = lod.m_normalsBuffer;
             ent.texcoordsBuffer = lod.m_texcoordsBuffer;
@@ -72,19 +85,20 @@ namespace nau
 
             ent.startInstance = 0;
             ent.instancesCount = 1;
-            ent.instanceData = {};
             ent.tags = {};
 
             ent.startIndex = 0;
             ent.endIndex = lod.m_indexCount;
-            ent.material = skinnedMeshInstance->getActiveMaterial(0, 0);
+            ent.material = skinnedMeshInstance->getActiveMaterial(lodLevel, 0);
 
             ent.instancingSupported = false;
             ent.worldTransform = skinnedMeshInstance->worldMatrix;
             ent.cbStructsData["BonesTransforms"] = RenderEntity::ConstBufferStructData{sizeof(skinnedMeshInstance->bonesTransforms), skinnedMeshInstance->bonesTransforms};
             ent.cbStructsData["BonesNormalTransforms"] = RenderEntity::ConstBufferStructData{sizeof(skinnedMeshInstance->bonesNormalTransforms), skinnedMeshInstance->bonesNormalTransforms};
 
-            ent.instanceData.emplace_back(skinnedMeshInstance->worldMatrix, skinnedMeshInstance->worldMatrix, skinnedMeshInstance->getUid(), skinnedMeshInstance->isHighlighted());
+            ent.instanceSource = &skinnedMeshInstance->m_instanceData;
+            ent.instanceIndices.push_back(0);
+            ent.hasHighlightedInstances = skinnedMeshInstance->isHighlighted();
         }
 
         return eastl::make_shared<RenderList>(std::move(lists));
@@ -101,6 +115,8 @@ namespace nau
     void SkinnedMeshInstance::setWorldPos(const nau::math::Matrix4& matrix)
     {
         worldMatrix = matrix;
+        m_instanceData.worldMatrix = matrix;
+        m_instanceData.normalMatrix = matrix;
 
         // update aabb, bounding sphere, etc.
         worldSphere.c = worldMatrix.getTranslation();  // TODO: need to take into account the scale
@@ -127,13 +143,14 @@ namespace nau
         nau::Ptr<SkinnedMeshAssetView> skinnedMeshView;
         skinnedMesh->getTyped<SkinnedMeshAssetView>(skinnedMeshView);
         nau::Ptr<MaterialAssetView> materialMeshView;
-        skinnedMeshView->getMesh()->getLod(0).m_material->getTyped<MaterialAssetView>(materialMeshView);
+        skinnedMeshView->getMesh()->getLod(lodIndex).m_material->getTyped<MaterialAssetView>(materialMeshView);
         return materialMeshView;
     }
 
     void SkinnedMeshInstance::setUid(const nau::Uid& uid)
     {
         m_uid = uid;
+        m_instanceData.uid = uid;
     }
 
     nau::Uid SkinnedMeshInstance::getUid() const
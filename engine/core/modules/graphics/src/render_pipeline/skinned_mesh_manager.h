@@ -38,7 +38,13 @@ namespace nau
         nau::math::Matrix4 worldMatrix;
         nau::math::BSphere3 worldSphere;
         nau::Uid m_uid;
-        bool m_isHighlighted;
+        bool m_isHighlighted = false;
+
+        // Data of the view instance buffer, updated together with the instance
+        RenderEntity::InstanceData m_instanceData{};
+
+        // Lods selected by the views (indexed by ViewLodParams::viewIndex)
+        eastl::vector<uint8_t> m_viewLods;
     };
 
     class SkinnedMeshManager : public IRenderManager
@@ -51,7 +57,8 @@ namespace nau
         eastl::shared_ptr<nau::SkinnedMeshInstance> addSkinnedMesh(SkinnedMeshAssetRef ref);
 
         // IRenderManager
-        RenderList::Ptr getRenderList(const nau::math::Vector3& viewerPosition,
+        RenderList::Ptr getRenderList(const ViewLodParams& lodParams,
+            const nau::math::NauFrustum& frustum,
             eastl::function<bool(const InstanceInfo&)>& filterFunc,
             eastl::function<bool(const nau::MaterialAssetView::Ptr)>& materialFilter) override;
 
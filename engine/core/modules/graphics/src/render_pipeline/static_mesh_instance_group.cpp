@@ -5,11 +5,14 @@
 #include "static_mesh_instance_group.h"
 
 #include "graphics_assets/static_mesh_asset.h"
+#include "nau/async/parallel_for.h"
+#include "nau/math/dag_lsbVisitor.h"
 #include "nau/string/hash.h"
 
+#include <EASTL/algorithm.h>
+
 namespace nau
 {
-
     StaticMeshInstanceGroup::StaticMeshInstanceGroup(nau::ReloadableAssetView::Ptr mesh) :
         m_staticMesh(mesh)
     {
@@ -25,7 +28,27 @@ namespace nau
 
     void StaticMeshInstanceGroup::addInstance(const InstanceInfo& inst)
     {
-        m_instances[inst.id] = inst;
+        InstanceInfo& info = m_instances[inst.id];
+        const uint32_t cullingIndex = info.cullingIndex;
+        if (cullingIndex != ~0u)
+        {
+            removeFromBuckets(info);
+        }
+
+        info = inst;
+        info.cullingIndex = cullingIndex;
+        info.bucketSlots.clear();
+
+        if (cullingIndex == ~0u)
+        {
+            addCullingEntry(info);
+        }
+        else
+        {
+            updateCullingEntry(info);
+        }
+
+        addToBuckets(info);
     }
 
     InstanceID StaticMeshInstanceGroup::reserveID()
@@ -41,6 +64,7 @@ namespace nau
         info.id = newID;
         info.isVisible = true;
         info.worldMatrix = matrix;
+        info.normalMatrix = math::transpose(math::inverse(matrix));
         Ptr<StaticMeshAssetView> meshView;
         m_staticMesh->getTyped<StaticMeshAssetView>(meshView);
         info.localSphere = meshView->getMesh()->getLod0BSphere();
@@ -56,7 +80,62 @@ namespace nau
     }
 
 
-    RenderList::Ptr nau::StaticMeshInstanceGroup::createRenderList(const nau::math::Vector3& viewerPosition,
+    eastl::span<const uint32_t> StaticMeshInstanceGroup::cullInstances(const nau::math::NauFrustum& frustum)
+    {
+        const size_t instancesCount = m_culling.instances.size();
+        m_culling.visibility.resize((instancesCount + 31) / 32);
+
+        // The large groups are split into the chunks processed by the default executor threads too.
+        static constexpr size_t ChunkSize = 4096;  // must be a multiple of 32
+        constexpr size_t MinParallelInstancesCount = ChunkSize * 4;
+
+        async::Executor::Ptr executor = instancesCount >= MinParallelInstancesCount ? async::Executor::getDefault() : nullptr;
+        async::ParallelFor culling{executor.get(), (instancesCount + ChunkSize - 1) / ChunkSize};
+
+        culling.run([this, &frustum, instancesCount](size_t chunk, size_t)
+        {
+            const size_t first = chunk * ChunkSize;
+            const size_t count = std::min(ChunkSize, instancesCount - first);
+            frustum.testSpheresB(m_culling.centerX.data() + first, m_culling.centerY.data() + first, m_culling.centerZ.data() + first,
+                m_culling.radius.data() + first, count, m_culling.visibility.data() + first / 32);
+        }, m_cullingHelpersCompleted);
+
+        return m_culling.visibility;
+    }
+
+    eastl::vector<uint8_t>& StaticMeshInstanceGroup::selectLods(const ViewLodParams& lodParams, const StaticMesh& mesh)
+    {
+        if (m_culling.viewLods.size() <= lodParams.viewIndex)
+        {
+            m_culling.viewLods.resize(lodParams.viewIndex + 1);
+        }
+
+        eastl::vector<uint8_t>& lods = m_culling.viewLods[lodParams.viewIndex];
+        lods.resize(m_culling.instances.size(), InvalidLodLevel);
+
+        const uint32_t lodsCount = mesh.getLodsCount();
+        if (lodsCount <= 1 || lodParams.screenScale <= 0.f)
+        {
+            eastl::fill(lods.begin(), lods.end(), uint8_t(0));
+            return lods;
+        }
+
+        // only the visible instances are updated, the others keep the lod they had when last seen
+        for (size_t word = 0; word < m_culling.visibility.size(); ++word)
+        {
+            for (const uint32_t bit : nau::math::LsbVisitor{m_culling.visibility[word]})
+            {
+                const size_t index = word * 32 + bit;
+                const float screenSize = getLodScreenSize(lodParams, m_culling.instances[index]->worldSphere);
+                lods[index] = static_cast<uint8_t>(selectLod(lodParams, screenSize, lodsCount, mesh.getLodsScreenSize(), lods[index]));
+            }
+        }
+
+        return lods;
+    }
+
+    RenderList::Ptr nau::StaticMeshInstanceGroup::createRenderList(const ViewLodParams& lodParams,
+        const nau::math::NauFrustum& frustum,
         eastl::function<bool(const InstanceInfo&)>& filterFunc,
         eastl::function<bool(const nau::MaterialAssetView::Ptr)>& materialFilter)
     {
@@ -66,108 +145,358 @@ namespace nau
 
         Ptr<StaticMeshAssetView> meshView;
         m_staticMesh->getTyped<StaticMeshAssetView>(meshView);
-        eastl::vector<eastl::vector<eastl::map<size_t /*material name*/, uint32_t /*entityIndex*/>>> lodSlotMats(meshView->getMesh()->getLodsCount());
+        const uint32_t lodsCount = meshView->getMesh()->getLodsCount();
 
-        for (const auto& [id, info] : m_instances)
+        cullInstances(frustum);
+
+        // apply the per-instance checks once, the lods and the render list use the visibility bits only
+        for (size_t word = 0; word < m_culling.visibility.size(); ++word)
         {
-            if (!info.isVisible)
+            uint32_t& bits = m_culling.visibility[word];
+            for (const uint32_t bit : nau::math::LsbVisitor{bits})
             {
-                continue;
+                const InstanceInfo& info = *m_culling.instances[word * 32 + bit];
+                if (!info.isVisible || (filterFunc && !filterFunc(info)))
+                {
+                    bits &= ~(1u << bit);
+                }
             }
+        }
 
-            if (!filterFunc(info))
+        const eastl::vector<uint8_t>& lods = selectLods(lodParams, *meshView->getMesh());
+
+        // group the visible instances by the selected lod, so every instance is visited only for the slots of its lod
+        m_culling.lodInstances.resize(lodsCount);
+        for (eastl::vector<uint32_t>& lodInstances : m_culling.lodInstances)
+        {
+            lodInstances.clear();
+        }
+
+        for (size_t word = 0; word < m_culling.visibility.size(); ++word)
+        {
+            for (const uint32_t bit : nau::math::LsbVisitor{m_culling.visibility[word]})
             {
-                continue;
+                const uint32_t index = static_cast<uint32_t>(word * 32 + bit);
+                if (lods[index] < lodsCount)
+                {
+                    m_culling.lodInstances[lods[index]].push_back(index);
+                }
             }
+        }
 
-            // Calculate lod level based on screen size
-            // TODO: calculate lodLevel based on distance when we get lods
-            // float distance = length(info.worldMatrix.getTranslation() - viewerPosition); // distance for now, not screen size
-            uint32_t lodLevel = 0;
+        // instances of the different buckets are merged into a single entity when the lod, slot and material name match
+        eastl::map<eastl::pair<uint64_t /*lodSlot*/, size_t /*material name*/>, uint32_t /*entityIndex*/> entityIndices;
 
-            Ptr<StaticMeshAssetView> meshView;
-            m_staticMesh->getTyped<StaticMeshAssetView>(meshView);
+        // entities of the buckets are resolved on the first visible instance
+        constexpr uint32_t UnresolvedEntity = ~0u;
+        constexpr uint32_t FilteredEntity = ~0u - 1;
+        m_culling.bucketEntities.assign(m_buckets.size(), UnresolvedEntity);
 
-            const nau::StaticMeshLod& lod = meshView->getMesh()->getLod(lodLevel);
+        const auto getBucketEntity = [&](uint32_t bucketIndex, const nau::StaticMeshLod& lod, const InstanceInfo& firstInfo) -> uint32_t
+        {
+            uint32_t& bucketEntity = m_culling.bucketEntities[bucketIndex];
+            if (bucketEntity != UnresolvedEntity)
+            {
+                return bucketEntity;
+            }
 
-            auto& slotMats = lodSlotMats[lodLevel];
+            bucketEntity = FilteredEntity;
 
-            if (slotMats.empty())
+            const InstanceBucket& bucket = m_buckets[bucketIndex];
+            if (bucket.slotIndex >= lod.m_materialSlots.size())
             {
-                slotMats.resize(lod.m_materialSlots.size());
+                return bucketEntity;
             }
 
-            // iterate through slots
-            for (size_t slotInd = 0; slotInd < lod.m_materialSlots.size(); slotInd++)
+            const nau::MaterialSlot& slot = lod.m_materialSlots[bucket.slotIndex];
+
+            nau::Ptr<nau::MaterialAssetView> material;
+            if (bucket.overrideMaterial)
             {
-                const nau::MaterialSlot& slot = lod.m_materialSlots[slotInd];
-                uint64_t lodSlot = (uint64_t(lodLevel) << 32) | uint64_t(slotInd);
+                bucket.overrideMaterial->getTyped<MaterialAssetView>(material);
+            }
+            else
+            {
+                slot.m_material->getTyped<MaterialAssetView>(material);
+            }
 
-                nau::Ptr<nau::MaterialAssetView> material;
-                if (info.overrideInfo.count(lodSlot))
-                {
-                    info.overrideInfo.at(lodSlot).material->getTyped<MaterialAssetView>(material);
-                }
-                else
-                {
-                    slot.m_material->getTyped<MaterialAssetView>(material);
-                }
+            if (!materialFilter(material))
+            {
+                return bucketEntity;
+            }
 
-                if (!materialFilter(material))
-                {
-                    continue;
-                }
+            const uint64_t lodSlot = (uint64_t(bucket.lodLevel) << 32) | uint64_t(bucket.slotIndex);
+            const size_t matNameHash = material->getNameHash(); // TODO: cache this inside material
 
-                size_t matNameHash = material->getNameHash(); // TODO: cache this inside material
-                auto& mats = slotMats[slotInd];
+            auto [entityIndex, isNewEntity] = entityIndices.insert(eastl::make_pair(eastl::make_pair(lodSlot, matNameHash), ret->getEntitiesCount()));
+            if (isNewEntity)
+            {
+                nau::RenderEntity& ent = ret->emplaceBack();
+                ent.positionBuffer = lod.m_positionsBuffer;
+                ent.normalsBuffer = lod.m_normalsBuffer;
+                ent.texcoordsBuffer = lod.m_texCoordsBuffer;
+                ent.tangentsBuffer = lod.m_tangentsBuffer;
+                ent.indexBuffer = lod.m_indexBuffer;
+                ent.startInstance = 0;
+                ent.instancesCount = 0;
+                ent.instanceSource = m_culling.instanceData.data();
+                ent.tags = {};
+
+                ent.worldTransform = firstInfo.worldMatrix;  // keep first world matrix
+                ent.startIndex = slot.m_startIndex;
+                ent.endIndex = slot.m_endIndex;
+                ent.material = material;
+            }
 
-                if (!mats.count(matNameHash))
-                {
-                    mats[matNameHash] = ret->getEntitiesCount();
-
-                    nau::RenderEntity& ent = ret->emplaceBack();
-                    ent.positionBuffer = lod.m_positionsBuffer;
-                    ent.normalsBuffer = lod.m_normalsBuffer;
-                    ent.texcoordsBuffer = lod.m_texCoordsBuffer;
-                    ent.tangentsBuffer = lod.m_tangentsBuffer;
-                    ent.indexBuffer = lod.m_indexBuffer;
-                    ent.startInstance = 0;
-                    ent.instancesCount = 0;
-                    ent.instanceData = {};
-                    ent.tags = {};
-
-                    ent.worldTransform = info.worldMatrix;  // keep first world matrix
-                    ent.startIndex = slot.m_startIndex;
-                    ent.endIndex = slot.m_endIndex;
-                    ent.material = material;
-                }
+            bucketEntity = entityIndex->second;
+            return bucketEntity;
+        };
 
-                uint32_t entInd = mats[matNameHash];
-                nau::RenderEntity& entity = (*ret)[entInd];
+        // InstanceInfo::bucketSlots are ordered by the lod and then by the slot
+        uint32_t lodSlotsOffset = 0;
+        for (uint32_t lodLevel = 0; lodLevel < lodsCount; ++lodLevel)
+        {
+            const nau::StaticMeshLod& lod = meshView->getMesh()->getLod(lodLevel);
+            const uint32_t slotsCount = static_cast<uint32_t>(lod.m_materialSlots.size());
 
-                entity.instancesCount++;
-                const nau::math::Matrix4 normalMatrix = math::transpose(math::inverse(info.worldMatrix));
-                entity.instanceData.emplace_back(info.worldMatrix, normalMatrix, info.uid, info.isHighlighted);
+            for (uint32_t slotIndex = 0; slotIndex < slotsCount; ++slotIndex)
+            {
+                for (const uint32_t index : m_culling.lodInstances[lodLevel])
+                {
+                    const InstanceInfo& info = *m_culling.instances[index];
+                    if (lodSlotsOffset + slotIndex >= info.bucketSlots.size())
+                    {
+                        continue;
+                    }
+
+                    const uint32_t entityIndex = getBucketEntity(info.bucketSlots[lodSlotsOffset + slotIndex].bucketIndex, lod, info);
+                    if (entityIndex == FilteredEntity)
+                    {
+                        continue;
+                    }
+
+                    nau::RenderEntity& entity = (*ret)[entityIndex];
+                    entity.instancesCount++;
+                    entity.instanceIndices.push_back(index);
+                    entity.hasHighlightedInstances |= info.isHighlighted;
+                }
             }
+
+            lodSlotsOffset += slotsCount;
         }
 
         return ret;
     }
 
+    void StaticMeshInstanceGroup::setInstanceTransform(InstanceID instID, const nau::math::Matrix4& matrix, const nau::math::BSphere3& worldSphere)
+    {
+        NAU_ASSERT(contains(instID));
+
+        InstanceInfo& info = m_instances[instID];
+        info.worldMatrix = matrix;
+        info.normalMatrix = math::transpose(math::inverse(matrix));
+        info.worldSphere = worldSphere;
+        updateCullingEntry(info);
+    }
+
+    void StaticMeshInstanceGroup::setInstanceMaterials(InstanceID instID, const eastl::map<uint64_t, MaterialOverrideInfo>& overrideInfo)
+    {
+        NAU_ASSERT(contains(instID));
+
+        InstanceInfo& info = m_instances[instID];
+        removeFromBuckets(info);
+        info.overrideInfo = overrideInfo;
+        addToBuckets(info);
+    }
+
+    void StaticMeshInstanceGroup::setInstanceSelection(InstanceID instID, const nau::Uid& uid, bool isHighlighted)
+    {
+        NAU_ASSERT(contains(instID));
+
+        InstanceInfo& info = m_instances[instID];
+        info.uid = uid;
+        info.isHighlighted = isHighlighted;
+
+        RenderEntity::InstanceData& instanceData = m_culling.instanceData[info.cullingIndex];
+        instanceData.uid = uid;
+        instanceData.isHighlighted = isHighlighted;
+    }
+
     void StaticMeshInstanceGroup::clearPendingInstances()
     {
-        eastl::erase_if(m_instances, [](const auto& pair)
+        for (auto it = m_instances.begin(); it != m_instances.end();)
         {
-            return pair.second.toDelete;
-        });
+            if (it->second.toDelete)
+            {
+                removeFromBuckets(it->second);
+                removeCullingEntry(it->second);
+                it = m_instances.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        removeEmptyBuckets();
     }
 
     void StaticMeshInstanceGroup::removeInstance(InstanceID instID)
     {
         NAU_ASSERT(contains(instID));
+        removeFromBuckets(m_instances[instID]);
+        removeCullingEntry(m_instances[instID]);
         m_instances.erase(instID);
     }
 
+    void StaticMeshInstanceGroup::addToBuckets(InstanceInfo& info)
+    {
+        Ptr<StaticMeshAssetView> meshView;
+        m_staticMesh->getTyped<StaticMeshAssetView>(meshView);
+
+        const uint32_t lodsCount = meshView->getMesh()->getLodsCount();
+        for (uint32_t lodLevel = 0; lodLevel < lodsCount; ++lodLevel)
+        {
+            const nau::StaticMeshLod& lod = meshView->getMesh()->getLod(lodLevel);
+
+            for (uint32_t slotIndex = 0; slotIndex < lod.m_materialSlots.size(); ++slotIndex)
+            {
+                const uint64_t lodSlot = (uint64_t(lodLevel) << 32) | uint64_t(slotIndex);
+                const auto overrideIt = info.overrideInfo.find(lodSlot);
+                const ReloadableAssetView* const overrideMaterial = overrideIt != info.overrideInfo.end() ? overrideIt->second.material.get() : nullptr;
+
+                auto [bucketIndexIt, isNewBucket] = m_bucketIndices.insert(eastl::make_pair(BucketKey{lodSlot, overrideMaterial}, static_cast<uint32_t>(m_buckets.size())));
+                if (isNewBucket)
+                {
+                    InstanceBucket& newBucket = m_buckets.emplace_back();
+                    newBucket.lodLevel = lodLevel;
+                    newBucket.slotIndex = slotIndex;
+                    newBucket.overrideMaterial = overrideIt != info.overrideInfo.end() ? overrideIt->second.material : nullptr;
+                }
+
+                const uint32_t bucketIndex = bucketIndexIt->second;
+                InstanceBucket& bucket = m_buckets[bucketIndex];
+
+                info.bucketSlots.push_back({bucketIndex, static_cast<uint32_t>(bucket.instances.size())});
+                bucket.instances.push_back({&info, static_cast<uint32_t>(info.bucketSlots.size() - 1)});
+            }
+        }
+    }
+
+    void StaticMeshInstanceGroup::removeFromBuckets(InstanceInfo& info)
+    {
+        for (const InstanceBucketSlot& bucketSlot : info.bucketSlots)
+        {
+            eastl::vector<InstanceBucket::Entry>& instances = m_buckets[bucketSlot.bucketIndex].instances;
+            NAU_ASSERT(bucketSlot.indexInBucket < instances.size() && instances[bucketSlot.indexInBucket].instance == &info);
+
+            const InstanceBucket::Entry& lastEntry = instances.back();
+            if (lastEntry.instance != &info)
+            {
+                lastEntry.instance->bucketSlots[lastEntry.bucketSlot].indexInBucket = bucketSlot.indexInBucket;
+                instances[bucketSlot.indexInBucket] = lastEntry;
+            }
+
+            instances.pop_back();
+        }
+
+        info.bucketSlots.clear();
+    }
+
+    void StaticMeshInstanceGroup::removeEmptyBuckets()
+    {
+        uint32_t bucketsCount = 0;
+        for (uint32_t bucketIndex = 0; bucketIndex < m_buckets.size(); ++bucketIndex)
+        {
+            InstanceBucket& bucket = m_buckets[bucketIndex];
+            const uint64_t lodSlot = (uint64_t(bucket.lodLevel) << 32) | uint64_t(bucket.slotIndex);
+            const BucketKey bucketKey{lodSlot, bucket.overrideMaterial.get()};
+
+            if (bucket.instances.empty())
+            {
+                m_bucketIndices.erase(bucketKey);
+                continue;
+            }
+
+            if (bucketIndex != bucketsCount)
+            {
+                m_bucketIndices[bucketKey] = bucketsCount;
+                for (const InstanceBucket::Entry& entry : bucket.instances)
+                {
+                    entry.instance->bucketSlots[entry.bucketSlot].bucketIndex = bucketsCount;
+                }
+
+                m_buckets[bucketsCount] = std::move(bucket);
+            }
+
+            ++bucketsCount;
+        }
+
+        m_buckets.erase(m_buckets.begin() + bucketsCount, m_buckets.end());
+    }
+
+    void StaticMeshInstanceGroup::addCullingEntry(InstanceInfo& info)
+    {
+        info.cullingIndex = static_cast<uint32_t>(m_culling.instances.size());
+
+        m_culling.centerX.push_back(info.worldSphere.c.getX());
+        m_culling.centerY.push_back(info.worldSphere.c.getY());
+        m_culling.centerZ.push_back(info.worldSphere.c.getZ());
+        m_culling.radius.push_back(info.worldSphere.r);
+        m_culling.instances.push_back(&info);
+        m_culling.instanceData.push_back({info.worldMatrix, info.normalMatrix, info.uid, info.isHighlighted});
+    }
+
+    void StaticMeshInstanceGroup::updateCullingEntry(const InstanceInfo& info)
+    {
+        const uint32_t index = info.cullingIndex;
+        NAU_ASSERT(index < m_culling.instances.size());
+
+        m_culling.centerX[index] = info.worldSphere.c.getX();
+        m_culling.centerY[index] = info.worldSphere.c.getY();
+        m_culling.centerZ[index] = info.worldSphere.c.getZ();
+        m_culling.radius[index] = info.worldSphere.r;
+        m_culling.instanceData[index] = {info.worldMatrix, info.normalMatrix, info.uid, info.isHighlighted};
+    }
+
+    void StaticMeshInstanceGroup::removeCullingEntry(const InstanceInfo& info)
+    {
+        const uint32_t index = info.cullingIndex;
+        const uint32_t lastIndex = static_cast<uint32_t>(m_culling.instances.size() - 1);
+        NAU_ASSERT(index <= lastIndex);
+
+        if (index != lastIndex)
+        {
+            m_culling.centerX[index] = m_culling.centerX[lastIndex];
+            m_culling.centerY[index] = m_culling.centerY[lastIndex];
+            m_culling.centerZ[index] = m_culling.centerZ[lastIndex];
+            m_culling.radius[index] = m_culling.radius[lastIndex];
+            m_culling.instances[index] = m_culling.instances[lastIndex];
+            m_culling.instances[index]->cullingIndex = index;
+            m_culling.instanceData[index] = m_culling.instanceData[lastIndex];
+        }
+
+        for (eastl::vector<uint8_t>& lods : m_culling.viewLods)
+        {
+            if (index < lods.size())
+            {
+                lods[index] = lastIndex < lods.size() ? lods[lastIndex] : InvalidLodLevel;
+            }
+
+            if (lastIndex < lods.size())
+            {
+                lods.pop_back();
+            }
+        }
+
+        m_culling.centerX.pop_back();
+        m_culling.centerY.pop_back();
+        m_culling.centerZ.pop_back();
+        m_culling.radius.pop_back();
+        m_culling.instances.pop_back();
+        m_culling.instanceData.pop_back();
+    }
+
     bool StaticMeshInstanceGroup::contains(InstanceID instID) const
     {
         return m_instances.contains(instID);
@@ -9,8 +9,11 @@
 #include "graphics_assets/static_meshes/static_mesh.h"
 #include "instance_group.h"
 #include "nau/3d/dag_drv3d.h"
+#include "nau/threading/event.h"
 #include "render_list.h"
 
+#include <EASTL/span.h>
+
 namespace nau
 {
     class StaticMeshInstanceGroup : public IInstanceGroup
@@ -33,10 +36,34 @@ namespace nau
         bool contains(InstanceID instID) const override;
 
         RenderEntity createRenderEntity() override;
-        RenderList::Ptr createRenderList(const nau::math::Vector3& viewerPosition,
+        RenderList::Ptr createRenderList(const ViewLodParams& lodParams,
+            const nau::math::NauFrustum& frustum,
             eastl::function<bool(const InstanceInfo&)>& filterFunc,
             eastl::function<bool(const nau::MaterialAssetView::Ptr)>& materialFilter) override;
 
+        /**
+         * @brief Updates the world transform of the instance together with the bounds used by the frustum culling.
+         */
+        void setInstanceTransform(InstanceID instID, const nau::math::Matrix4& matrix, const nau::math::BSphere3& worldSphere);
+
+        /**
+         * @brief Replaces the material overrides of the instance and moves it to the corresponding instance buckets.
+         */
+        void setInstanceMaterials(InstanceID instID, const eastl::map<uint64_t, MaterialOverrideInfo>& overrideInfo);
+
+        /**
+         * @brief Updates the uid and the highlighting of the instance written into the view instance buffers.
+         */
+        void setInstanceSelection(InstanceID instID, const nau::Uid& uid, bool isHighlighted);
+
+        /**
+         * @brief Tests the bounding spheres of all the instances against the frustum.
+         *
+         * Bit (i % 32) of the word (i / 32) is set if the instance with the culling index i is visible.
+         * Large groups are tested in parallel on the default executor.
+         */
+        eastl::span<const uint32_t> cullInstances(const nau::math::NauFrustum& frustum);
+
         void clearPendingInstances();
 
         inline nau::math::BSphere3 getMeshBSphereLod0()
@@ -47,9 +74,74 @@ namespace nau
         }
 
     protected:
+        /**
+         * Bounding spheres of the instances stored as structure of arrays to be tested in the SIMD batches.
+         * Entries are indexed by InstanceInfo::cullingIndex and kept dense (removal moves the last entry).
+         */
+        struct CullingData
+        {
+            eastl::vector<float> centerX;
+            eastl::vector<float> centerY;
+            eastl::vector<float> centerZ;
+            eastl::vector<float> radius;
+            eastl::vector<InstanceInfo*> instances;
+            eastl::vector<uint32_t> visibility;
+
+            // Data of the view instance buffers, updated in place when the instance changes.
+            // The render entities refer to it by the culling indices.
+            eastl::vector<RenderEntity::InstanceData> instanceData;
+
+            // Lods selected by the views (indexed by ViewLodParams::viewIndex), kept between the frames for the hysteresis.
+            // The arrays are extended with InvalidLodLevel when the render list of the view is built.
+            eastl::vector<eastl::vector<uint8_t>> viewLods;
+
+            // Scratch buffers of the render list building: the visible instances grouped by the selected lod and the entities of the buckets.
+            eastl::vector<eastl::vector<uint32_t>> lodInstances;
+            eastl::vector<uint32_t> bucketEntities;
+        };
+
+        /**
+         * Instances drawn with the same lod, material slot and material.
+         * Membership is updated when the instances are added, removed or get a material override.
+         * An instance belongs to the buckets of all the mesh lods: building a render list visits the visible instances
+         * and takes the buckets of the selected lod only.
+         * Buckets are addressed by the indices stored in InstanceInfo::bucketSlots: removal moves the last bucket entry in place of the removed one.
+         * New members find their bucket by the key (lod and slot, override material) in m_bucketIndices.
+         */
+        struct InstanceBucket
+        {
+            struct Entry
+            {
+                InstanceInfo* instance;
+                uint32_t bucketSlot;  // index within InstanceInfo::bucketSlots
+            };
+
+            uint32_t lodLevel = 0;
+            uint32_t slotIndex = 0;
+            ReloadableAssetView::Ptr overrideMaterial;  // nullptr - the material of the mesh slot
+            eastl::vector<Entry> instances;
+        };
+
+        eastl::vector<uint8_t>& selectLods(const ViewLodParams& lodParams, const StaticMesh& mesh);
+
+        void addToBuckets(InstanceInfo& info);
+        void removeFromBuckets(InstanceInfo& info);
+        void removeEmptyBuckets();
+
+        void addCullingEntry(InstanceInfo& info);
+        void updateCullingEntry(const InstanceInfo& info);
+        void removeCullingEntry(const InstanceInfo& info);
+
         nau::ReloadableAssetView::Ptr m_staticMesh;
         eastl::unordered_map<InstanceID, InstanceInfo> m_instances;
         std::atomic<InstanceID> freeInstanceId = 0;
+
+        using BucketKey = eastl::pair<uint64_t /*lodSlot*/, const ReloadableAssetView* /*overrideMaterial*/>;
+
+        eastl::vector<InstanceBucket> m_buckets;
+        eastl::map<BucketKey, uint32_t> m_bucketIndices;
+        CullingData m_culling;
+        threading::Event m_cullingHelpersCompleted;
     };
 
 } // namespace nau
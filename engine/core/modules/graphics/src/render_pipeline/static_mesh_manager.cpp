@@ -69,7 +69,7 @@ namespace nau
             {
                 auto dummy = eastl::function<bool(const InstanceInfo&)>([](const InstanceInfo&) -> bool { return true; });
                 auto dummyForMaterials = eastl::function<bool(const MaterialAssetView::Ptr)>([](const MaterialAssetView::Ptr) -> bool { return true; });
-                auto list = group->createRenderList({}, dummy, dummyForMaterials);
+                auto list = group->createRenderList({}, nau::math::NauFrustum{viewProj}, dummy, dummyForMaterials);
 
                 for (auto& ent : list->getEntities())
                 {
@@ -84,7 +84,8 @@ namespace nau
     }
 
 
-    RenderList::Ptr nau::StaticMeshManager::getRenderList(const nau::math::Vector3& viewerPosition,
+    RenderList::Ptr nau::StaticMeshManager::getRenderList(const ViewLodParams& lodParams,
+        const nau::math::NauFrustum& frustum,
         eastl::function<bool(const InstanceInfo&)>& filterFunc,
         eastl::function<bool(const nau::MaterialAssetView::Ptr)>& materialFilter)
     {
@@ -94,7 +95,7 @@ namespace nau
         {
             if (const auto& group = weakGroup.lock())
             {
-                lists.emplace_back(group->createRenderList({}, filterFunc, materialFilter));
+                lists.emplace_back(group->createRenderList(lodParams, frustum, filterFunc, materialFilter));
             }
             else
             {
@@ -206,12 +207,14 @@ namespace nau
         using DirtyFlags = nau::scene::StaticMeshComponent::DirtyFlags;
 
         nau::InstanceInfo& info = m_group->getInstance(m_instInfo.id);
-        info.isHighlighted = m_instInfo.isHighlighted;
-        info.uid = m_instInfo.uid;
+        if (info.isHighlighted != m_instInfo.isHighlighted || info.uid != m_instInfo.uid)
+        {
+            m_group->setInstanceSelection(m_instInfo.id, m_instInfo.uid, m_instInfo.isHighlighted);
+        }
 
         if(isMaterialDirty)
         {
-            info.overrideInfo = m_instInfo.overrideInfo;
+            m_group->setInstanceMaterials(m_instInfo.id, m_instInfo.overrideInfo);
             isMaterialDirty = false;
         }
 
@@ -222,8 +225,7 @@ namespace nau
             {
             case static_cast<uint32_t>(DirtyFlags::WorldPos):
                 setWorldTransform(component.getWorldTransform());
-                info.worldMatrix = m_instInfo.worldMatrix;
-                info.worldSphere = m_instInfo.worldSphere;
+                m_group->setInstanceTransform(m_instInfo.id, m_instInfo.worldMatrix, m_instInfo.worldSphere);
                 break;
             //case static_cast<uint32_t>(DirtyFlags::Material):
             //    info.overrideInfo = m_instInfo.overrideInfo;
@@ -27,7 +27,8 @@ namespace nau
         void render(nau::math::Matrix4 viewProj); // temporal, for testing only
 
         // Inherited via IRenderManager
-        RenderList::Ptr getRenderList(const nau::math::Vector3& viewerPosition,
+        RenderList::Ptr getRenderList(const ViewLodParams& lodParams,
+            const nau::math::NauFrustum& frustum,
             eastl::function<bool(const InstanceInfo&)>& filterFunc,
             eastl::function<bool(const nau::MaterialAssetView::Ptr)>& materialFilter) override;
 
@@ -119,9 +119,14 @@ namespace nau::render
         {
             if(m_graphicsScene->hasMainCamera())
             {
-                nau::math::Matrix4 vp = m_graphicsScene->getMainCamera().getProjMatrix() * m_graphicsScene->getMainCamera().getViewMatrix();
+                const nau::CameraNode& mainCamera = m_graphicsScene->getMainCamera();
+                const nau::math::Matrix4 proj = mainCamera.getProjMatrix();
+                nau::math::Matrix4 vp = proj * mainCamera.getViewMatrix();
                 for (auto& view : m_graphicsScene->getRenderScene()->getViews())
                 {
+                    // all the views (shadow cascades included) select the lods as seen from the main camera
+                    view->setLodViewer(mainCamera.worldPosition, proj.getCol1().getY());
+
                     if (view->containsTag(nau::RenderScene::Tags::shadowCascadeTag))
                     {
                         int cascade = (int)view->getUserData();
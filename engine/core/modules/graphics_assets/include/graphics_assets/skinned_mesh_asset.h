@@ -10,6 +10,8 @@
 #include "nau/assets/mesh_asset_accessor.h"
 #include "nau/math/dag_bounds3.h"
 
+#include <EASTL/span.h>
+
 namespace nau
 {
     struct SkinnedMeshLod final
@@ -49,6 +51,12 @@ namespace nau
             return m_localBSphere;
         }
 
+        // Screen size thresholds of the lods (element i - the screen size below which lod i is used), empty if not provided by the asset
+        inline eastl::span<const float> getLodsScreenSize() const
+        {
+            return m_lodsScreenSpaceError;
+        }
+
     public:
         static async::Task<nau::Ptr<SkinnedMesh>> createFromMeshAccessor(IMeshAssetAccessor& meshAccessor);
 
@@ -12,6 +12,8 @@
 #include "graphics_assets/material_asset.h"
 #include "nau/math/dag_bounds3.h"
 
+#include <EASTL/span.h>
+
 
 namespace nau
 {
@@ -66,6 +68,12 @@ namespace nau
             return m_localBSphere;
         }
 
+        // Screen size thresholds of the lods (element i - the screen size below which lod i is used), empty if not provided by the asset
+        inline eastl::span<const float> getLodsScreenSize() const
+        {
+            return m_lodsScreenSpaceError;
+        }
+
     public:
         static async::Task<nau::Ptr<StaticMesh>> createFromStaticMeshAccessor(IMeshAssetAccessor& accessor);
 
@@ -39,6 +39,22 @@ namespace nau
          */
         bool write(const nau::NetworkingMessage& message) override;
 
+        /**
+         * @brief Attempts to read complete length-prefixed messages.
+         *
+         * @param [out] messages    A collection of received messages (views into the pooled receive buffers).
+         * @return                  Number of received messages, i.e. size of **messages**.
+         */
+        size_t readMessages(eastl::vector<BufferView>& messages) override;
+
+        /**
+         * @brief Attempts to send the specified message with length-prefixed framing.
+         *
+         * @param [in] message  Message to send.
+         * @return              `true` if the message can be sent, `false` otherwise.
+         */
+        bool writeMessage(BufferView message) override;
+
         /**
          * @brief Checks if the connection is alive.
          *
@@ -3,9 +3,11 @@
 // network_component_api.h
 
 #pragma once
+#include <EASTL/optional.h>
 #include <EASTL/string_view.h>
 
 #include "nau/memory/bytes_buffer.h"
+#include "nau/network/netsync/net_relevancy.h"
 #include "nau/rtti/rtti_object.h"
 #include "nau/scene/scene_object.h"
 
@@ -72,6 +74,26 @@ namespace nau
          * @param [in] buffer Buffer with serialized data.
          */
         virtual void netRead(const eastl::string& buffer) = 0;
+
+        /**
+         * @brief Retrieves the replication parameters used by the relevancy filtering (see NetRelevancySettings).
+         *
+         * @return Replication policy of the component.
+         */
+        virtual NetReplicationPolicy getReplicationPolicy()
+        {
+            return {};
+        }
+
+        /**
+         * @brief Retrieves the world position used by the interest management.
+         *
+         * @return Component position or `eastl::nullopt` if the component has no location (it is relevant for every connection then).
+         */
+        virtual eastl::optional<math::vec3> getNetPosition()
+        {
+            return eastl::nullopt;
+        }
     };
 
     /**
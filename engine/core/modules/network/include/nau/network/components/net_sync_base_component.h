@@ -32,6 +32,17 @@ namespace nau
             CLASS_ATTRIBUTE(scene::ComponentDisplayNameAttrib, "Net Sync Base"),
             CLASS_ATTRIBUTE(scene::ComponentDescriptionAttrib, "Net Sync Base (description)"))
 
+    public:
+        /**
+         * @brief Changes the replication parameters of the component, see NetReplicationPolicy.
+         *
+         * @param [in] policy Replication policy to assign.
+         */
+        void setReplicationPolicy(const NetReplicationPolicy& policy)
+        {
+            m_replicationPolicy = policy;
+        }
+
     protected:
         /**
          * @brief Changes whether the component is replicated from the remote peer or owned by the local peer.
@@ -73,6 +84,26 @@ namespace nau
             return m_path;
         }
 
+        /**
+         * @brief Retrieves the replication parameters of the component.
+         *
+         * @return Replication policy.
+         */
+        NetReplicationPolicy getReplicationPolicy() override
+        {
+            return m_replicationPolicy;
+        }
+
+        /**
+         * @brief Retrieves the world position of the parent object for the interest management.
+         *
+         * @return World translation of the parent object.
+         */
+        eastl::optional<math::vec3> getNetPosition() override
+        {
+            return getParentObject().getWorldTransform().getTranslation();
+        }
+
         /**
         * @brief Noop, see IComponentNetSync::netWrite.
         *
@@ -196,5 +227,6 @@ namespace nau
         INetSnapshots* m_snapshots = nullptr;
         IComponentNetScene* m_scene = nullptr;
         eastl::string m_path;
+        NetReplicationPolicy m_replicationPolicy;
     };
 }  // namespace nau
@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
 
 #pragma once
+#include "nau/network/netsync/net_snapshot_codec.h"
 #include "nau/scene/components/component_attributes.h"
 #include "nau/scene/components/internal/component_internal_attributes.h"
 #include "nau/serialization/json_utils.h"
@@ -47,6 +48,32 @@ namespace nau
             }
             return false;
         }
+
+        /**
+         * @brief Writes quantized binary representation, see net_quantization.
+         */
+        void write(NetBinaryWriter& writer) const
+        {
+            net_quantization::writeVec3(writer, position);
+            net_quantization::writeQuat(writer, rotation);
+            net_quantization::writeVec3(writer, scale);
+        }
+
+        bool read(NetBinaryReader& reader)
+        {
+            const math::vec3 newPosition = net_quantization::readVec3(reader);
+            const math::quat newRotation = net_quantization::readQuat(reader);
+            const math::vec3 newScale = net_quantization::readVec3(reader);
+            if (!reader.isValid())
+            {
+                return false;
+            }
+
+            position = newPosition;
+            rotation = newRotation;
+            scale = newScale;
+            return true;
+        }
     };
 
     /**
@@ -75,37 +102,53 @@ namespace nau
     protected:
         void netWrite(BytesBuffer& buffer) override
         {
-            auto str = serialization::JsonUtils::stringify(*this);
-            size_t length = str.length();
-            buffer.resize(length);
-            std::byte* data = buffer.data();
-            std::memcpy(data, str.begin(), length);
+            updateTransformFromOwner();
+
+            eastl::string data;
+            NetBinaryWriter writer{data};
+            m_transform.write(writer);
+
+            buffer.resize(data.size());
+            std::memcpy(buffer.data(), data.data(), data.size());
         }
 
         void netRead(const BytesBuffer& buffer) override
         {
-            eastl::u8string str((char8_t*)buffer.data(), (char8_t*)(buffer.data() + buffer.size()));
-            auto res = serialization::JsonUtils::parse(*this, str);
-            m_wasReplicated = true;
+            NetBinaryReader reader{buffer.data(), buffer.size()};
+            if (m_transform.read(reader))
+            {
+                applyTransformToOwner();
+                m_wasReplicated = true;
+            }
         }
 
         void netWrite(eastl::string& buffer) override
+        {
+            updateTransformFromOwner();
+            m_transform.write(buffer);
+        }
+
+        void netRead(const eastl::string& buffer) override
+        {
+            m_transform.read(buffer);
+            applyTransformToOwner();
+            m_wasReplicated = true;
+        }
+
+        void updateTransformFromOwner()
         {
             auto& owner = getParentObject();
             m_transform.position = owner.getTranslation();
             m_transform.rotation = owner.getRotation();
             m_transform.scale = owner.getScale();
-            m_transform.write(buffer);
         }
 
-        void netRead(const eastl::string& buffer) override
+        void applyTransformToOwner()
         {
-            m_transform.read(buffer);
             auto& owner = getParentObject();
             owner.setTranslation(m_transform.position);
             owner.setRotation(m_transform.rotation);
             owner.setScale(m_transform.scale);
-            m_wasReplicated = true;
         }
 
         NetworkTransformData m_transform;
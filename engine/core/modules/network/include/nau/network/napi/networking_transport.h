@@ -33,6 +33,26 @@ namespace nau
          */
         virtual bool write(const nau::NetworkingMessage& message) = 0;
 
+        /**
+         * @brief Attempts to read complete length-prefixed messages (see writeMessage).
+         *
+         * @param [out] messages    A collection of received messages. Empty if no messages.
+         *                          Messages reference the transport receive buffers directly (no copy is made),
+         *                          a buffer is reused by the transport only after all of its messages have been released.
+         * @return                  Number of received messages, i.e. size of **messages**.
+         *
+         * @note Length-prefixed and raw (read/write) modes must not be mixed on the same transport.
+         */
+        virtual size_t readMessages(eastl::vector<BufferView>& messages) = 0;
+
+        /**
+         * @brief Attempts to send the specified message with length-prefixed framing.
+         *
+         * @param [in] message  Message to send. It is referenced (not copied) until it has been written.
+         * @return              `true` if the message can be sent, `false` otherwise.
+         */
+        virtual bool writeMessage(BufferView message) = 0;
+
         /**
          * @brief Checks if the connection is alive.
          * 
@@ -5,8 +5,12 @@
 #pragma once
 
 #include <EASTL/string.h>
+#include <EASTL/string_view.h>
 #include <EASTL/vector.h>
 
+#include <limits>
+
+#include "nau/memory/bytes_buffer.h"
 #include "nau/rtti/type_info.h"
 
 namespace nau
@@ -18,6 +22,13 @@ namespace nau
     {
         NAU_TYPEID(INetConnector)
 
+        /**
+         * @brief Interned peer ID: cheap to compare and hash, valid for the connector lifetime.
+         */
+        using PeerHandle = uint32_t;
+
+        static constexpr PeerHandle InvalidPeerHandle = std::numeric_limits<PeerHandle>::max();
+
         /**
          * @brief Encapsulates connection information.
          */
@@ -142,6 +153,14 @@ namespace nau
          */
         virtual void writeFrame(const eastl::string& peerId, const eastl::string& frame) = 0;
 
+        /**
+         * @brief Write frame state to the single remote peer (i.e. delta encoded per connection state)
+         * @param peerId - local peer, source
+         * @param toPeerId - remote peer, destination
+         * @param frame - serialized frame state
+         */
+        virtual void writeFrame(const eastl::string& peerId, const eastl::string& toPeerId, const eastl::string& frame) = 0;
+
         /**
          * @brief Read frame state
          * @param peerId - local peer, destination
@@ -151,6 +170,46 @@ namespace nau
          */
         virtual bool readFrame(const eastl::string& peerId, const eastl::string& fromPeerId, eastl::string& frame) = 0;
 
+        /**
+         * @brief Read frame state without copying
+         * @param peerId - local peer, destination
+         * @param fromPeerId - remote peer, source of frame state
+         * @param frame - serialized frame state, valid until the next update() call
+         * @return True, if frame state exists, false otherwise
+         */
+        virtual bool readFrame(const eastl::string& peerId, const eastl::string& fromPeerId, eastl::string_view& frame) = 0;
+
+        /**
+         * @brief Interns the peer ID.
+         * @param peerId - peer ID
+         * @return Handle of the peer, the same for the equal IDs
+         */
+        virtual PeerHandle getPeerHandle(eastl::string_view peerId) = 0;
+
+        /**
+         * @brief Get peers connected to specified peer
+         * @param peer - specific peer
+         * @param peers - cleared and filled by handles of the peers connected to specific peer
+         */
+        virtual void getConnections(PeerHandle peer, eastl::vector<PeerHandle>& peers) = 0;
+
+        /**
+         * @brief Write frame state to the single remote peer
+         * @param peer - local peer, source
+         * @param toPeer - remote peer, destination
+         * @param frame - serialized frame state
+         */
+        virtual void writeFrame(PeerHandle peer, PeerHandle toPeer, eastl::string_view frame) = 0;
+
+        /**
+         * @brief Take the received frame state over: the next call returns false until a new frame is received
+         * @param peer - local peer, destination
+         * @param fromPeer - remote peer, source of frame state
+         * @param frame - serialized frame state, references the transport receive buffer while it is held
+         * @return True, if a new frame state exists, false otherwise
+         */
+        virtual bool takeFrame(PeerHandle peer, PeerHandle fromPeer, BufferView& frame) = 0;
+
         /**
          * @brief Update service. Must be called once per frame.
          */
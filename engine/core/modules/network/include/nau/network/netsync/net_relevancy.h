@@ -0,0 +1,288 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+// net_relevancy.h
+
+#pragma once
+
+#include <EASTL/algorithm.h>
+#include <EASTL/optional.h>
+#include <EASTL/string.h>
+#include <EASTL/string_view.h>
+#include <EASTL/unordered_map.h>
+#include <EASTL/vector.h>
+
+#include <cmath>
+#include <limits>
+
+#include "nau/diag/assertion.h"
+#include "nau/math/math.h"
+
+namespace nau
+{
+    /**
+     * @brief Replication parameters of the single IComponentNetSync component.
+     */
+    struct NetReplicationPolicy
+    {
+        /**
+         * @brief Relative importance of the component: the priority accumulated per frame while the component is not sent.
+         */
+        float priority = 1.f;
+
+        /**
+         * @brief Minimal amount of frames between two consecutive sends of the component (1 - every frame).
+         */
+        uint32_t updateInterval = 1;
+
+        /**
+         * @brief Relevant for every connection regardless of the interest area (i.e. game state, score).
+         */
+        bool alwaysRelevant = false;
+    };
+
+    /**
+     * @brief Relevancy filtering settings of the net snapshots service.
+     */
+    struct NetRelevancySettings
+    {
+        /**
+         * @brief Enables relevancy filtering: interest area, update rates and bandwidth budget.
+         * When disabled every replicated component is sent to every connection each frame.
+         */
+        bool enabled = false;
+
+        /**
+         * @brief Size of the interest grid cell (world units, XZ plane).
+         */
+        float cellSize = 32.f;
+
+        /**
+         * @brief Radius of the connection interest area in cells around the viewer cell.
+         */
+        uint32_t interestRadius = 2;
+
+        /**
+         * @brief Payload bytes budget per connection per frame (0 - unlimited).
+         */
+        size_t bytesPerFrame = 0;
+    };
+
+    /**
+     * @brief Uniform grid over the XZ plane which finds the entries near the connection viewer.
+     *
+     * Cells keep their storage between rebuilds, so the steady state rebuild does not allocate.
+     */
+    class NetInterestGrid
+    {
+    public:
+        void clear(float cellSize)
+        {
+            NAU_ASSERT(cellSize > 0.f);
+            m_cellSize = cellSize;
+            for (auto& cell : m_cells)
+            {
+                cell.second.clear();
+            }
+        }
+
+        void add(uint32_t entry, const math::vec3& position)
+        {
+            m_cells[cellKey(cellCoord(static_cast<float>(position.getX())), cellCoord(static_cast<float>(position.getZ())))].push_back(entry);
+        }
+
+        /**
+         * @brief Iterates over the entries in the square area of (2 * radius + 1) cells around the position.
+         *
+         * @param [in] callback Callable with (uint32_t entry) signature.
+         */
+        template <typename Callback>
+        void forEachNear(const math::vec3& position, uint32_t radius, Callback&& callback) const
+        {
+            const int32_t centerX = cellCoord(static_cast<float>(position.getX()));
+            const int32_t centerZ = cellCoord(static_cast<float>(position.getZ()));
+            const int32_t r = static_cast<int32_t>(radius);
+            for (int32_t z = centerZ - r; z <= centerZ + r; ++z)
+            {
+                for (int32_t x = centerX - r; x <= centerX + r; ++x)
+                {
+                    const auto iter = m_cells.find(cellKey(x, z));
+                    if (iter == m_cells.end())
+                    {
+                        continue;
+                    }
+
+                    for (const uint32_t entry : iter->second)
+                    {
+                        callback(entry);
+                    }
+                }
+            }
+        }
+
+        float getCellSize() const
+        {
+            return m_cellSize;
+        }
+
+    private:
+        int32_t cellCoord(float value) const
+        {
+            return static_cast<int32_t>(std::floor(value / m_cellSize));
+        }
+
+        static uint64_t cellKey(int32_t x, int32_t z)
+        {
+            return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(z);
+        }
+
+        float m_cellSize = 32.f;
+        eastl::unordered_map<uint64_t, eastl::vector<uint32_t>> m_cells;
+    };
+
+    /**
+     * @brief Chooses the components that are sent to the single connection within the frame bandwidth budget.
+     *
+     * Every relevant component accumulates its priority (scaled down with the distance to the viewer) each frame
+     * it is not sent. Candidates are sent in the order of the accumulated priority until the budget is exhausted,
+     * so skipped components eventually win over the frequently changing ones and nothing starves.
+     */
+    class NetRelevancyScheduler
+    {
+    public:
+        /**
+         * @brief Starts a new frame.
+         *
+         * @param [in] frame    Frame number. Must increase between the calls.
+         */
+        void beginFrame(uint32_t frame)
+        {
+            m_frame = frame;
+            m_candidates.clear();
+        }
+
+        /**
+         * @brief Adds the component relevant for the connection in the current frame.
+         *
+         * @param [in] entry            Caller defined index of the component, returned by schedule().
+         * @param [in] sceneName        Scene name of the component.
+         * @param [in] componentPath    Path of the component in the scene.
+         * @param [in] policy           Component replication policy.
+         * @param [in] distance         Distance from the connection viewer (0 if it is unknown).
+         * @param [in] size             Estimated amount of bytes the component takes in the frame.
+         */
+        void addCandidate(uint32_t entry, eastl::string_view sceneName, eastl::string_view componentPath, const NetReplicationPolicy& policy, float distance, size_t size)
+        {
+            m_key.assign(sceneName.data(), sceneName.size());
+            m_key.push_back('\0');
+            m_key.append(componentPath.data(), componentPath.size());
+            auto [iter, inserted] = m_states.emplace(m_key, State{});
+            State& state = iter->second;
+            state.lastSeenFrame = m_frame;
+
+            const bool isFirstSend = state.lastSentFrame == NeverSent;
+            if (!isFirstSend && m_frame - state.lastSentFrame < eastl::max(policy.updateInterval, 1u))
+            {
+                return;
+            }
+
+            state.accumulatedPriority += policy.priority / (1.f + distance / m_distanceScale);
+            m_candidates.push_back({entry, size, &state, isFirstSend});
+        }
+
+        /**
+         * @brief Chooses the components to send.
+         *
+         * @param [in] bytesBudget  Bytes budget of the frame (0 - unlimited).
+         * @param [in] callback     Callable with (uint32_t entry) signature, invoked in the order of importance.
+         */
+        template <typename Callback>
+        void schedule(size_t bytesBudget, Callback&& callback)
+        {
+            // Components which never were sent go first: the remote side has no state for them at all.
+            eastl::sort(m_candidates.begin(), m_candidates.end(), [](const Candidate& left, const Candidate& right)
+            {
+                if (left.isFirstSend != right.isFirstSend)
+                {
+                    return left.isFirstSend;
+                }
+                return left.state->accumulatedPriority > right.state->accumulatedPriority;
+            });
+
+            size_t bytesLeft = bytesBudget > 0 ? bytesBudget : std::numeric_limits<size_t>::max();
+            bool isFirst = true;
+            for (const Candidate& candidate : m_candidates)
+            {
+                // The most important component is always sent, even if it alone exceeds the budget.
+                if (candidate.size > bytesLeft && !isFirst)
+                {
+                    continue;
+                }
+
+                bytesLeft -= eastl::min(candidate.size, bytesLeft);
+                isFirst = false;
+
+                candidate.state->accumulatedPriority = 0.f;
+                candidate.state->lastSentFrame = m_frame;
+                callback(candidate.entry);
+            }
+
+            purgeStates();
+        }
+
+        /**
+         * @brief Sets the distance at which the component priority is halved.
+         */
+        void setDistanceScale(float distanceScale)
+        {
+            NAU_ASSERT(distanceScale > 0.f);
+            m_distanceScale = distanceScale;
+        }
+
+    private:
+        static constexpr uint32_t NeverSent = std::numeric_limits<uint32_t>::max();
+
+        // States of the components that have not been relevant for so many frames are dropped.
+        static constexpr uint32_t StateLifetime = 256;
+
+        struct State
+        {
+            float accumulatedPriority = 0.f;
+            uint32_t lastSentFrame = NeverSent;
+            uint32_t lastSeenFrame = 0;
+        };
+
+        struct Candidate
+        {
+            uint32_t entry;
+            size_t size;
+            State* state;
+            bool isFirstSend;
+        };
+
+        void purgeStates()
+        {
+            if (m_frame % StateLifetime != 0)
+            {
+                return;
+            }
+
+            for (auto iter = m_states.begin(); iter != m_states.end();)
+            {
+                if (m_frame - iter->second.lastSeenFrame > StateLifetime)
+                {
+                    iter = m_states.erase(iter);
+                }
+                else
+                {
+                    ++iter;
+                }
+            }
+        }
+
+        uint32_t m_frame = 0;
+        float m_distanceScale = 32.f;
+        eastl::unordered_map<eastl::string, State> m_states;
+        eastl::vector<Candidate> m_candidates;
+        eastl::string m_key;
+    };
+}  // namespace nau
@@ -0,0 +1,804 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+// net_snapshot_codec.h
+
+#pragma once
+
+#include <EASTL/algorithm.h>
+#include <EASTL/map.h>
+#include <EASTL/optional.h>
+#include <EASTL/string.h>
+#include <EASTL/string_view.h>
+#include <EASTL/unordered_map.h>
+#include <EASTL/utility.h>
+#include <EASTL/vector.h>
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include "nau/math/math.h"
+
+namespace nau
+{
+    /**
+     * @brief Appends binary data (little-endian, LEB128 variable-length integers) to a byte string.
+     */
+    class NetBinaryWriter
+    {
+    public:
+        explicit NetBinaryWriter(eastl::string& buffer) :
+            m_buffer(buffer)
+        {
+        }
+
+        void writeByte(uint8_t value)
+        {
+            m_buffer.push_back(static_cast<char>(value));
+        }
+
+        void writeBytes(const void* data, size_t size)
+        {
+            m_buffer.append(static_cast<const char*>(data), size);
+        }
+
+        void writeVarUInt(uint64_t value)
+        {
+            while (value >= 0x80)
+            {
+                writeByte(static_cast<uint8_t>(value) | 0x80);
+                value >>= 7;
+            }
+            writeByte(static_cast<uint8_t>(value));
+        }
+
+        /**
+         * @brief Writes signed value with zigzag encoding: small absolute values take a single byte.
+         */
+        void writeVarInt(int64_t value)
+        {
+            writeVarUInt((static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+        }
+
+        void writeFloat(float value)
+        {
+            writeBytes(&value, sizeof(value));
+        }
+
+        void writeString(eastl::string_view value)
+        {
+            writeVarUInt(value.size());
+            writeBytes(value.data(), value.size());
+        }
+
+        size_t size() const
+        {
+            return m_buffer.size();
+        }
+
+    private:
+        eastl::string& m_buffer;
+    };
+
+    /**
+     * @brief Reads data written by NetBinaryWriter.
+     *
+     * Reading past the end (or malformed data) does not fail immediately: zeroes are returned and the reader becomes invalid.
+     */
+    class NetBinaryReader
+    {
+    public:
+        NetBinaryReader(const void* data, size_t size) :
+            m_data(static_cast<const uint8_t*>(data)),
+            m_size(size)
+        {
+        }
+
+        explicit NetBinaryReader(eastl::string_view data) :
+            NetBinaryReader(data.data(), data.size())
+        {
+        }
+
+        uint8_t readByte()
+        {
+            if (m_position >= m_size)
+            {
+                m_isValid = false;
+                return 0;
+            }
+            return m_data[m_position++];
+        }
+
+        bool readBytes(void* data, size_t size)
+        {
+            const eastl::string_view bytes = readView(size);
+            if (bytes.size() != size)
+            {
+                std::memset(data, 0, size);
+                return false;
+            }
+            std::memcpy(data, bytes.data(), size);
+            return true;
+        }
+
+        /**
+         * @brief Returns the next `size` bytes without copying. The view refers to the reader's source data.
+         */
+        eastl::string_view readView(size_t size)
+        {
+            if (size > m_size - m_position)
+            {
+                m_isValid = false;
+                m_position = m_size;
+                return {};
+            }
+            const char* const data = reinterpret_cast<const char*>(m_data + m_position);
+            m_position += size;
+            return {data, size};
+        }
+
+        uint64_t readVarUInt()
+        {
+            uint64_t value = 0;
+            for (unsigned shift = 0; shift < 64; shift += 7)
+            {
+                const uint8_t byte = readByte();
+                value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+                if ((byte & 0x80) == 0)
+                {
+                    return value;
+                }
+            }
+
+            m_isValid = false;
+            return 0;
+        }
+
+        int64_t readVarInt()
+        {
+            const uint64_t value = readVarUInt();
+            return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+        }
+
+        float readFloat()
+        {
+            float value = 0.f;
+            readBytes(&value, sizeof(value));
+            return value;
+        }
+
+        eastl::string_view readString()
+        {
+            return readView(static_cast<size_t>(readVarUInt()));
+        }
+
+        bool isValid() const
+        {
+            return m_isValid;
+        }
+
+        bool isEnd() const
+        {
+            return m_position == m_size;
+        }
+
+    private:
+        const uint8_t* m_data;
+        size_t m_size;
+        size_t m_position = 0;
+        bool m_isValid = true;
+    };
+
+    /**
+     * @brief Quantization helpers for the replicated values.
+     */
+    namespace net_quantization
+    {
+        /**
+         * @brief Fixed-point precision of the replicated positions and scales (1/1024 of the unit).
+         */
+        inline constexpr float LinearPrecision = 1024.f;
+
+        inline void writeVec3(NetBinaryWriter& writer, const math::vec3& value, float precision = LinearPrecision)
+        {
+            writer.writeVarInt(std::lround(static_cast<float>(value.getX()) * precision));
+            writer.writeVarInt(std::lround(static_cast<float>(value.getY()) * precision));
+            writer.writeVarInt(std::lround(static_cast<float>(value.getZ()) * precision));
+        }
+
+        inline math::vec3 readVec3(NetBinaryReader& reader, float precision = LinearPrecision)
+        {
+            const float x = static_cast<float>(reader.readVarInt()) / precision;
+            const float y = static_cast<float>(reader.readVarInt()) / precision;
+            const float z = static_cast<float>(reader.readVarInt()) / precision;
+            return math::vec3{x, y, z};
+        }
+
+        /**
+         * @brief Writes unit quaternion with "smallest three" encoding:
+         * 2 bits for the index of the largest component and 15 bits for each of the other three, packed into 6 bytes.
+         */
+        inline void writeQuat(NetBinaryWriter& writer, const math::quat& value)
+        {
+            constexpr unsigned ComponentBits = 15;
+            constexpr float MaxValue = static_cast<float>((1u << ComponentBits) - 1);
+            constexpr float Range = 0.70710678f;
+
+            const float components[4] = {value.getX(), value.getY(), value.getZ(), value.getW()};
+
+            unsigned largest = 0;
+            for (unsigned i = 1; i < 4; ++i)
+            {
+                if (std::fabs(components[i]) > std::fabs(components[largest]))
+                {
+                    largest = i;
+                }
+            }
+
+            // q and -q are the same rotation: the largest component is always restored as positive.
+            const float sign = components[largest] < 0.f ? -1.f : 1.f;
+
+            uint64_t packed = largest;
+            unsigned shift = 2;
+            for (unsigned i = 0; i < 4; ++i)
+            {
+                if (i == largest)
+                {
+                    continue;
+                }
+
+                const float normalized = eastl::clamp((components[i] * sign / Range + 1.f) * 0.5f, 0.f, 1.f);
+                packed |= static_cast<uint64_t>(std::lround(normalized * MaxValue)) << shift;
+                shift += ComponentBits;
+            }
+
+            for (unsigned i = 0; i < 6; ++i)
+            {
+                writer.writeByte(static_cast<uint8_t>(packed >> (i * 8)));
+            }
+        }
+
+        inline math::quat readQuat(NetBinaryReader& reader)
+        {
+            constexpr unsigned ComponentBits = 15;
+            constexpr uint64_t ComponentMask = (1u << ComponentBits) - 1;
+            constexpr float MaxValue = static_cast<float>(ComponentMask);
+            constexpr float Range = 0.70710678f;
+
+            uint64_t packed = 0;
+            for (unsigned i = 0; i < 6; ++i)
+            {
+                packed |= static_cast<uint64_t>(reader.readByte()) << (i * 8);
+            }
+
+            const unsigned largest = static_cast<unsigned>(packed & 3);
+            float components[4] = {};
+            float sumOfSquares = 0.f;
+            unsigned shift = 2;
+            for (unsigned i = 0; i < 4; ++i)
+            {
+                if (i == largest)
+                {
+                    continue;
+                }
+
+                const float normalized = static_cast<float>((packed >> shift) & ComponentMask) / MaxValue;
+                components[i] = (normalized * 2.f - 1.f) * Range;
+                sumOfSquares += components[i] * components[i];
+                shift += ComponentBits;
+            }
+
+            components[largest] = std::sqrt(eastl::max(0.f, 1.f - sumOfSquares));
+            return math::quat{components[0], components[1], components[2], components[3]};
+        }
+    }  // namespace net_quantization
+
+    /**
+     * @brief Component payloads of a single snapshot frame, stored contiguously and indexed by the (connection local) component id.
+     */
+    class NetSnapshotPayloads
+    {
+    public:
+        void clear()
+        {
+            m_data.clear();
+            m_ranges.clear();
+        }
+
+        void add(uint32_t id, eastl::string_view payload)
+        {
+            if (id >= m_ranges.size())
+            {
+                m_ranges.resize(id + 1, Range{});
+            }
+            m_ranges[id] = {static_cast<uint32_t>(m_data.size()), static_cast<uint32_t>(payload.size())};
+            m_data.append(payload.data(), payload.size());
+        }
+
+        bool contains(uint32_t id) const
+        {
+            return id < m_ranges.size() && m_ranges[id].size != NoPayload;
+        }
+
+        eastl::string_view get(uint32_t id) const
+        {
+            if (!contains(id))
+            {
+                return {};
+            }
+            return {m_data.data() + m_ranges[id].offset, m_ranges[id].size};
+        }
+
+        template <typename Callback>
+        void forEach(Callback&& callback) const
+        {
+            for (uint32_t id = 0; id < m_ranges.size(); ++id)
+            {
+                if (m_ranges[id].size != NoPayload)
+                {
+                    callback(id, get(id));
+                }
+            }
+        }
+
+    private:
+        static constexpr uint32_t NoPayload = std::numeric_limits<uint32_t>::max();
+
+        struct Range
+        {
+            uint32_t offset = 0;
+            uint32_t size = NoPayload;
+        };
+
+        eastl::string m_data;
+        eastl::vector<Range> m_ranges;
+    };
+
+    /**
+     * @brief Common definitions of the binary snapshot format.
+     *
+     * Frame layout:
+     *  - format tag byte (distinguishes binary frames from the JSON ones which always start with '{');
+     *  - frame number, distance to the baseline frame (0 - no baseline) and acknowledged remote frame + 1 (0 - nothing acknowledged);
+     *  - components count, then for each component: id (with the definition flag in the lowest bit),
+     *    optional definition (scene name and component path), payload delta against the baseline.
+     */
+    struct NetSnapshotFormat
+    {
+        static constexpr uint8_t FormatTag = 0xB5;
+
+        /**
+         * @brief Amount of frames the both sides keep for the delta encoding.
+         */
+        static constexpr uint32_t HistorySize = 32;
+
+        enum PayloadEncoding : uint8_t
+        {
+            // Payload equals to the baseline payload.
+            Unchanged = 0,
+            // Payload is written completely.
+            Full = 1,
+            // Payload has the same size as baseline: only the changed byte ranges are written.
+            Patch = 2
+        };
+
+        static bool isBinaryFrame(eastl::string_view frame)
+        {
+            return !frame.empty() && static_cast<uint8_t>(frame.front()) == FormatTag;
+        }
+    };
+
+    /**
+     * @brief Encodes outgoing snapshot frames for the single connection.
+     *
+     * Component ids are interned per connection: the definition (scene name and component path) is sent
+     * until one of the frames carrying it has been acknowledged by the remote side (a later acknowledged frame
+     * does not prove the delivery: the frames can be lost and the component can be skipped). Payloads are delta encoded
+     * against the last acknowledged frame.
+     */
+    class NetSnapshotEncoder
+    {
+    public:
+        /**
+         * @brief Starts a new frame.
+         *
+         * @param [in] frame            Frame number. Must increase between the calls.
+         * @param [in] remoteFrameAck   Last frame that has been received (decoded) from the remote side, if any.
+         */
+        void beginFrame(uint32_t frame, eastl::optional<uint32_t> remoteFrameAck)
+        {
+            m_frame = frame;
+            m_remoteFrameAck = remoteFrameAck;
+            m_entries.clear();
+            m_current.clear();
+        }
+
+        void writeComponent(eastl::string_view sceneName, eastl::string_view componentPath, eastl::string_view payload)
+        {
+            m_key.assign(sceneName.data(), sceneName.size());
+            m_key.push_back('\0');
+            m_key.append(componentPath.data(), componentPath.size());
+
+            auto [iter, inserted] = m_ids.emplace(m_key, static_cast<uint32_t>(m_definitions.size()));
+            if (inserted)
+            {
+                m_definitions.push_back({eastl::string{sceneName}, eastl::string{componentPath}});
+            }
+
+            const uint32_t id = iter->second;
+            m_entries.push_back(id);
+            m_current.add(id, payload);
+        }
+
+        /**
+         * @brief Finishes the frame and writes it into the buffer.
+         */
+        void endFrame(eastl::string& buffer)
+        {
+            const NetSnapshotPayloads* const baseline = findBaseline();
+
+            buffer.clear();
+            NetBinaryWriter writer{buffer};
+            writer.writeByte(NetSnapshotFormat::FormatTag);
+            writer.writeVarUInt(m_frame);
+            writer.writeVarUInt(baseline ? m_frame - *m_ackedFrame : 0);
+            writer.writeVarUInt(m_remoteFrameAck ? static_cast<uint64_t>(*m_remoteFrameAck) + 1 : 0);
+            writer.writeVarUInt(m_entries.size());
+
+            for (const uint32_t id : m_entries)
+            {
+                Definition& definition = m_definitions[id];
+
+                writer.writeVarUInt((static_cast<uint64_t>(id) << 1) | (definition.isAcked ? 0 : 1));
+                if (!definition.isAcked)
+                {
+                    writer.writeString(definition.sceneName);
+                    writer.writeString(definition.componentPath);
+
+                    if (definition.carryingFrames.empty())
+                    {
+                        m_unackedDefinitions.push_back(id);
+                    }
+                    definition.carryingFrames.push_back(m_frame);
+                }
+
+                writePayload(writer, baseline && baseline->contains(id) ? &*baseline : nullptr, id);
+            }
+
+            m_history[m_frame] = eastl::move(m_current);
+            while (m_history.size() > NetSnapshotFormat::HistorySize)
+            {
+                m_history.erase(m_history.begin());
+            }
+        }
+
+        /**
+         * @brief Marks the frame as received by the remote side: it becomes the baseline for the subsequent frames.
+         */
+        void acknowledge(uint32_t frame)
+        {
+            if (m_ackedFrame && *m_ackedFrame >= frame)
+            {
+                return;
+            }
+
+            m_ackedFrame = frame;
+            m_history.erase(m_history.begin(), m_history.lower_bound(frame));
+
+            // The earlier frames can not be acknowledged anymore: only the later carrying frames are kept.
+            eastl::erase_if(m_unackedDefinitions, [this, frame](uint32_t id)
+            {
+                Definition& definition = m_definitions[id];
+                definition.isAcked = eastl::find(definition.carryingFrames.begin(), definition.carryingFrames.end(), frame) != definition.carryingFrames.end();
+                eastl::erase_if(definition.carryingFrames, [frame](uint32_t carryingFrame)
+                {
+                    return carryingFrame <= frame;
+                });
+
+                return definition.isAcked || definition.carryingFrames.empty();
+            });
+        }
+
+    private:
+        struct Definition
+        {
+            eastl::string sceneName;
+            eastl::string componentPath;
+            bool isAcked = false;
+
+            // Not acknowledged frames that have carried the definition (in the increasing order).
+            eastl::vector<uint32_t> carryingFrames;
+        };
+
+        const NetSnapshotPayloads* findBaseline() const
+        {
+            if (!m_ackedFrame || m_frame - *m_ackedFrame >= NetSnapshotFormat::HistorySize)
+            {
+                return nullptr;
+            }
+
+            const auto iter = m_history.find(*m_ackedFrame);
+            return iter != m_history.end() ? &iter->second : nullptr;
+        }
+
+        void writePayload(NetBinaryWriter& writer, const NetSnapshotPayloads* baseline, uint32_t id)
+        {
+            const eastl::string_view payload = m_current.get(id);
+            const eastl::string_view baselinePayload = baseline ? baseline->get(id) : eastl::string_view{};
+
+            if (baseline && payload == baselinePayload)
+            {
+                writer.writeByte(NetSnapshotFormat::Unchanged);
+                return;
+            }
+
+            if (baseline && payload.size() == baselinePayload.size())
+            {
+                // (unchanged bytes count, changed bytes count, changed bytes) ranges.
+                m_patch.clear();
+                NetBinaryWriter patchWriter{m_patch};
+                for (size_t i = 0; i < payload.size();)
+                {
+                    const size_t changedBegin = eastl::mismatch(payload.begin() + i, payload.end(), baselinePayload.begin() + i).first - payload.begin();
+                    if (changedBegin == payload.size())
+                    {
+                        break;
+                    }
+
+                    size_t changedEnd = changedBegin + 1;
+                    while (changedEnd < payload.size() && payload[changedEnd] != baselinePayload[changedEnd])
+                    {
+                        ++changedEnd;
+                    }
+
+                    patchWriter.writeVarUInt(changedBegin - i);
+                    patchWriter.writeVarUInt(changedEnd - changedBegin);
+                    patchWriter.writeBytes(payload.data() + changedBegin, changedEnd - changedBegin);
+                    i = changedEnd;
+                }
+
+                if (m_patch.size() < payload.size())
+                {
+                    writer.writeByte(NetSnapshotFormat::Patch);
+                    writer.writeString(m_patch);
+                    return;
+                }
+            }
+
+            writer.writeByte(NetSnapshotFormat::Full);
+            writer.writeString(payload);
+        }
+
+        uint32_t m_frame = 0;
+        eastl::optional<uint32_t> m_remoteFrameAck;
+        eastl::optional<uint32_t> m_ackedFrame;
+
+        eastl::unordered_map<eastl::string, uint32_t> m_ids;
+        eastl::vector<Definition> m_definitions;
+        eastl::vector<uint32_t> m_unackedDefinitions;  // definitions with the carrying frames
+        eastl::vector<uint32_t> m_entries;
+        NetSnapshotPayloads m_current;
+        eastl::map<uint32_t, NetSnapshotPayloads> m_history;
+
+        eastl::string m_key;
+        eastl::string m_patch;
+    };
+
+    /**
+     * @brief Decodes incoming snapshot frames of the single connection (see NetSnapshotEncoder).
+     */
+    class NetSnapshotDecoder
+    {
+    public:
+        /**
+         * @brief Decodes the frame.
+         *
+         * The decoded frame replaces the last one only if it has been decoded completely: a rejected frame does not change the decoder state.
+         *
+         * @param [in] frame    Frame data.
+         * @return              `true` if a new frame has been decoded, `false` if the frame is malformed, outdated or its baseline is unknown.
+         */
+        bool decode(eastl::string_view frame)
+        {
+            NetBinaryReader reader{frame};
+            if (reader.readByte() != NetSnapshotFormat::FormatTag)
+            {
+                return false;
+            }
+
+            const uint32_t frameNumber = static_cast<uint32_t>(reader.readVarUInt());
+            const uint32_t baselineDistance = static_cast<uint32_t>(reader.readVarUInt());
+            const uint64_t frameAck = reader.readVarUInt();
+            const uint64_t entriesCount = reader.readVarUInt();
+
+            if (!reader.isValid() || (m_lastFrame && frameNumber <= *m_lastFrame))
+            {
+                return false;
+            }
+
+            const NetSnapshotPayloads* baseline = nullptr;
+            if (baselineDistance != 0)
+            {
+                const auto iter = m_history.find(frameNumber - baselineDistance);
+                if (iter == m_history.end())
+                {
+                    return false;
+                }
+                baseline = &iter->second;
+            }
+
+            m_decodedEntries.clear();
+            m_decoded.clear();
+            m_newRemoteIds.clear();
+
+            const size_t definitionsCount = m_definitions.size();
+            const auto rollbackDefinitions = [this, definitionsCount]
+            {
+                for (const uint32_t remoteId : m_newRemoteIds)
+                {
+                    m_localIds.erase(remoteId);
+                }
+                m_definitions.erase(m_definitions.begin() + definitionsCount, m_definitions.end());
+            };
+
+            for (uint64_t i = 0; i < entriesCount && reader.isValid(); ++i)
+            {
+                const uint64_t idAndFlag = reader.readVarUInt();
+                const uint32_t remoteId = static_cast<uint32_t>(idAndFlag >> 1);
+                if ((idAndFlag & 1) != 0)
+                {
+                    const eastl::string_view sceneName = reader.readString();
+                    const eastl::string_view componentPath = reader.readString();
+
+                    // Remote ids are not trusted to be dense (the frame that has defined the previous ids can be lost):
+                    // the definitions are stored by the local ids, so the storage only grows with the definitions that are actually received.
+                    // The definition of the already known id is sent again until it is acknowledged and cannot change.
+                    auto [iter, inserted] = m_localIds.emplace(remoteId, static_cast<uint32_t>(m_definitions.size()));
+                    if (inserted)
+                    {
+                        m_newRemoteIds.push_back(remoteId);
+                        m_definitions.push_back({eastl::string{sceneName}, eastl::string{componentPath}});
+                    }
+                }
+
+                const auto iter = m_localIds.find(remoteId);
+                if (iter == m_localIds.end() || m_decoded.contains(iter->second) || !readPayload(reader, baseline, iter->second))
+                {
+                    rollbackDefinitions();
+                    return false;
+                }
+
+                m_decodedEntries.push_back(iter->second);
+            }
+
+            if (!reader.isValid() || !reader.isEnd())
+            {
+                rollbackDefinitions();
+                return false;
+            }
+
+            eastl::swap(m_entries, m_decodedEntries);
+            eastl::swap(m_current, m_decoded);
+
+            m_lastFrame = frameNumber;
+            m_remoteAck = frameAck != 0 ? eastl::optional<uint32_t>{static_cast<uint32_t>(frameAck - 1)} : eastl::nullopt;
+
+            m_history[frameNumber] = m_current;
+            while (m_history.size() > NetSnapshotFormat::HistorySize)
+            {
+                m_history.erase(m_history.begin());
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Last decoded frame number: must be sent back (acknowledged) to the remote encoder.
+         */
+        eastl::optional<uint32_t> getLastFrame() const
+        {
+            return m_lastFrame;
+        }
+
+        /**
+         * @brief Last frame of this side acknowledged by the remote side (received with the last decoded frame).
+         */
+        eastl::optional<uint32_t> getRemoteAck() const
+        {
+            return m_remoteAck;
+        }
+
+        /**
+         * @brief Iterates over the components of the last decoded frame.
+         *
+         * @param [in] callback Callable with (eastl::string_view sceneName, eastl::string_view componentPath, eastl::string_view payload) signature.
+         */
+        template <typename Callback>
+        void forEachComponent(Callback&& callback) const
+        {
+            for (const uint32_t id : m_entries)
+            {
+                const Definition& definition = m_definitions[id];
+                callback(eastl::string_view{definition.sceneName}, eastl::string_view{definition.componentPath}, m_current.get(id));
+            }
+        }
+
+    private:
+        struct Definition
+        {
+            eastl::string sceneName;
+            eastl::string componentPath;
+        };
+
+        bool readPayload(NetBinaryReader& reader, const NetSnapshotPayloads* baseline, uint32_t id)
+        {
+            const uint8_t encoding = reader.readByte();
+            if (encoding == NetSnapshotFormat::Full)
+            {
+                m_decoded.add(id, reader.readString());
+                return reader.isValid();
+            }
+
+            if (!baseline || !baseline->contains(id))
+            {
+                return false;
+            }
+
+            const eastl::string_view baselinePayload = baseline->get(id);
+            if (encoding == NetSnapshotFormat::Unchanged)
+            {
+                m_decoded.add(id, baselinePayload);
+                return true;
+            }
+
+            if (encoding != NetSnapshotFormat::Patch)
+            {
+                return false;
+            }
+
+            m_payload.assign(baselinePayload.data(), baselinePayload.size());
+            NetBinaryReader patchReader{reader.readString()};
+            for (size_t position = 0; reader.isValid() && patchReader.isValid() && !patchReader.isEnd();)
+            {
+                position += static_cast<size_t>(patchReader.readVarUInt());
+                const size_t changedSize = static_cast<size_t>(patchReader.readVarUInt());
+                const eastl::string_view changedBytes = patchReader.readView(changedSize);
+                if (!patchReader.isValid() || position > m_payload.size() || changedSize > m_payload.size() - position)
+                {
+                    return false;
+                }
+
+                eastl::copy(changedBytes.begin(), changedBytes.end(), m_payload.begin() + position);
+                position += changedSize;
+            }
+
+            m_decoded.add(id, m_payload);
+            return reader.isValid() && patchReader.isValid();
+        }
+
+        eastl::optional<uint32_t> m_lastFrame;
+        eastl::optional<uint32_t> m_remoteAck;
+
+        // Definitions and payloads are indexed by the local ids (see m_localIds).
+        eastl::unordered_map<uint32_t, uint32_t> m_localIds;
+        eastl::vector<Definition> m_definitions;
+        eastl::vector<uint32_t> m_entries;
+        NetSnapshotPayloads m_current;
+        eastl::map<uint32_t, NetSnapshotPayloads> m_history;
+
+        // Frame being decoded: becomes current only if it has been decoded completely.
+        eastl::vector<uint32_t> m_decodedEntries;
+        NetSnapshotPayloads m_decoded;
+        eastl::vector<uint32_t> m_newRemoteIds;
+        eastl::string m_payload;
+    };
+
+    /**
+     * @brief Binary snapshot state of the single connection: both directions are required for the acknowledgement.
+     */
+    struct NetSnapshotConnection
+    {
+        NetSnapshotEncoder encoder;
+        NetSnapshotDecoder decoder;
+    };
+}  // namespace nau
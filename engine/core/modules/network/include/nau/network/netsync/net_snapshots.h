@@ -4,11 +4,13 @@
 
 #pragma once
 
+#include <EASTL/optional.h>
 #include <EASTL/string.h>
 #include <EASTL/unique_ptr.h>
 
 #include "nau/memory/bytes_buffer.h"
 #include "nau/network/components/net_component_api.h"
+#include "nau/network/netsync/net_relevancy.h"
 #include "nau/rtti/type_info.h"
 #include "nau/utils/functor.h"
 
@@ -72,6 +74,35 @@ namespace nau
          */
         virtual void onComponentWrite(IComponentNetSync* component) = 0;
 
+        /**
+         * @brief Selects the snapshot format that is sent to the remote peers.
+         *
+         * @param [in] enabled  `true` to send compact binary snapshots (per connection, delta encoded against the last acknowledged frame),
+         *                      `false` to send JSON snapshots.
+         *
+         * @note Incoming snapshots of both formats are always accepted. Binary snapshots rely on IComponentNetSync binary serialization.
+         */
+        virtual void setBinarySnapshots(bool enabled) = 0;
+
+        /**
+         * @brief Changes the relevancy filtering of the outgoing snapshots.
+         *
+         * @param [in] settings Relevancy settings to apply.
+         *
+         * @note With the relevancy enabled each connection receives only components in its interest area (see setViewer),
+         *       limited by the components update rates and the connection bytes budget.
+         */
+        virtual void setRelevancySettings(const NetRelevancySettings& settings) = 0;
+
+        /**
+         * @brief Sets the center of the connection interest area (i.e. the remote player position).
+         *
+         * @param [in] peerId       Local peer ID.
+         * @param [in] remotePeerId Remote peer ID.
+         * @param [in] position     Viewer position or `eastl::nullopt` to make every component relevant for the connection.
+         */
+        virtual void setViewer(eastl::string_view peerId, eastl::string_view remotePeerId, eastl::optional<math::vec3> position) = 0;
+
         /**
          * @brief Advances networking to the next frame. The function must be called once per frame.
          */
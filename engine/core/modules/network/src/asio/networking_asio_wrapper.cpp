@@ -22,6 +22,16 @@ namespace nau
         str += "/";
     }
 
+    static uint32_t readMessageSize(const std::byte* header)
+    {
+        uint32_t size = 0;
+        for (size_t i = 0; i < sizeof(uint32_t); ++i)
+        {
+            size |= static_cast<uint32_t>(header[i]) << (i * 8);
+        }
+        return size;
+    }
+
     ASIO_Connection::ASIO_Connection(tcp::socket s) :
         m_socket(std::move(s))
     {
@@ -50,6 +60,9 @@ namespace nau
 
     bool ASIO_Connection::disconnect()
     {
+        // Bytes of the incomplete message must not be prepended to the data received after the socket is reconnected
+        m_receivedSize = 0;
+
         if (m_socket.is_open())
         {
             m_socket.close();
@@ -93,6 +106,172 @@ namespace nau
         }
     }
 
+    bool ASIO_Connection::writeMessage(BufferView message)
+    {
+        if (!m_socket.is_open() || message.size() > MaxMessageSize)
+        {
+            return false;
+        }
+
+        m_outgoingMessages.emplace_back();
+        OutgoingMessage& outgoing = m_outgoingMessages.back();
+        const uint32_t size = static_cast<uint32_t>(message.size());
+        for (size_t i = 0; i < MessageHeaderSize; ++i)
+        {
+            outgoing.header[i] = static_cast<uint8_t>(size >> (i * 8));
+        }
+        outgoing.payload = eastl::move(message);
+
+        if (!m_messagesWriteInProgress)
+        {
+            doWriteMessages();
+        }
+        return true;
+    }
+
+    void ASIO_Connection::doWriteMessages()
+    {
+        m_gatheredBuffers.clear();
+        m_gatheredMessages = eastl::min(m_outgoingMessages.size(), MaxGatheredMessages);
+        if (m_gatheredMessages == 0)
+        {
+            m_messagesWriteInProgress = false;
+            return;
+        }
+
+        // Headers and payloads are written in place with a single gather write
+        for (size_t i = 0; i < m_gatheredMessages; ++i)
+        {
+            const OutgoingMessage& outgoing = m_outgoingMessages[i];
+            m_gatheredBuffers.push_back(asio::buffer(outgoing.header.data(), outgoing.header.size()));
+            if (outgoing.payload.size() > 0)
+            {
+                m_gatheredBuffers.push_back(asio::buffer(outgoing.payload.data(), outgoing.payload.size()));
+            }
+        }
+
+        m_messagesWriteInProgress = true;
+        asio::async_write(m_socket, m_gatheredBuffers,
+                          [this](const asio::error_code& error, std::size_t bytes_transferred)
+        {
+            if (error)
+            {
+                NAU_LOG_DEBUG(nau::utils::format("ASIO_Connection::doWriteMessages error {}", error.message().c_str()));
+                m_outgoingMessages.clear();
+                m_messagesWriteInProgress = false;
+                return;
+            }
+
+            m_outgoingMessages.erase(m_outgoingMessages.begin(), m_outgoingMessages.begin() + m_gatheredMessages);
+            doWriteMessages();
+        });
+    }
+
+    void ASIO_Connection::readMessages(eastl::vector<BufferView>& messages)
+    {
+        if (!m_socket.is_open())
+        {
+            return;
+        }
+
+        std::error_code error;
+        for (size_t available = m_socket.available(error); !error && available > 0; available = m_socket.available(error))
+        {
+            if (!m_receiveChunk)
+            {
+                m_receiveChunk = acquireReceiveChunk(ReceiveChunkSize);
+            }
+
+            const size_t freeSize = m_receiveChunk.size() - m_receivedSize;
+            m_receivedSize += m_socket.read_some(asio::buffer(m_receiveChunk.data() + m_receivedSize, eastl::min(available, freeSize)), error);
+            if (error)
+            {
+                break;
+            }
+
+            parseMessages(messages);
+            if (!m_socket.is_open())
+            {
+                break;
+            }
+        }
+    }
+
+    size_t ASIO_Connection::parseMessages(eastl::vector<BufferView>& messages)
+    {
+        size_t messagesCount = 0;
+        size_t messagesEnd = 0;
+        size_t requiredSize = ReceiveChunkSize;
+        while (m_receivedSize - messagesEnd >= MessageHeaderSize)
+        {
+            const uint32_t size = readMessageSize(m_receiveChunk.data() + messagesEnd);
+            if (size > MaxMessageSize)
+            {
+                NAU_LOG_DEBUG(nau::utils::format("ASIO_Connection::readMessages invalid message size {}", size));
+                disconnect();
+                return 0;
+            }
+
+            if (m_receivedSize - messagesEnd < MessageHeaderSize + size)
+            {
+                requiredSize = eastl::max(requiredSize, MessageHeaderSize + size);
+                break;
+            }
+
+            messagesEnd += MessageHeaderSize + size;
+            ++messagesCount;
+        }
+
+        if (messagesCount == 0)
+        {
+            // Incomplete message does not fit into the chunk: the chunk is not shared yet and can be grown in place
+            if (requiredSize > m_receiveChunk.size())
+            {
+                m_receiveChunk.resize(requiredSize);
+            }
+            return 0;
+        }
+
+        // Messages are handed out as views of the chunk, the tail (incomplete message) moves to the next chunk
+        ReadOnlyBuffer chunk = m_receiveChunk.toReadOnly();
+        for (size_t offset = 0; offset < messagesEnd;)
+        {
+            const uint32_t size = readMessageSize(chunk.data() + offset);
+            messages.emplace_back(chunk, offset + MessageHeaderSize, size);
+            offset += MessageHeaderSize + size;
+        }
+
+        const size_t tailSize = m_receivedSize - messagesEnd;
+        m_receiveChunk = acquireReceiveChunk(requiredSize);
+        if (tailSize > 0)
+        {
+            std::memcpy(m_receiveChunk.data(), chunk.data() + messagesEnd, tailSize);
+        }
+        m_receivedSize = tailSize;
+
+        if (m_receiveChunksPool.size() < ReceiveChunksPoolSize)
+        {
+            m_receiveChunksPool.push_back(eastl::move(chunk));
+        }
+
+        return messagesCount;
+    }
+
+    BytesBuffer ASIO_Connection::acquireReceiveChunk(size_t minSize)
+    {
+        for (auto chunk = m_receiveChunksPool.begin(); chunk != m_receiveChunksPool.end(); ++chunk)
+        {
+            if (BufferUtils::refsCount(*chunk) == 1 && chunk->size() >= minSize)
+            {
+                BytesBuffer buffer = chunk->toBuffer();
+                m_receiveChunksPool.erase(chunk);
+                return buffer;
+            }
+        }
+
+        return BytesBuffer(eastl::max(minSize, ReceiveChunkSize));
+    }
+
     const eastl::string& ASIO_Connection::localEndPoint() const
     {
         if (isConnected())
@@ -3,6 +3,10 @@
 // networking_asio_wrapper.h
 
 #pragma once
+#include <EASTL/array.h>
+#include <EASTL/deque.h>
+#include <EASTL/vector.h>
+
 #include <asio.hpp>
 
 #include "nau/memory/bytes_buffer.h"
@@ -22,6 +26,10 @@ namespace nau
         void write(const BytesBuffer& buffer);
         void read(BytesBuffer& buffer);
 
+        // Length-prefixed framing: must not be mixed with write/read on the same connection
+        bool writeMessage(BufferView message);
+        void readMessages(eastl::vector<BufferView>& messages);
+
         const eastl::string& localEndPoint() const;
         const eastl::string& remoteEndPoint() const;
 
@@ -29,9 +37,36 @@ namespace nau
         void doWriteBuffer();
         void writeHandler(const asio::error_code& error, std::size_t bytes_transferred);
 
+        void doWriteMessages();
+        size_t parseMessages(eastl::vector<BufferView>& messages);
+        BytesBuffer acquireReceiveChunk(size_t minSize);
+
+        static constexpr size_t MessageHeaderSize = sizeof(uint32_t);
+        static constexpr size_t MaxMessageSize = 64 * 1024 * 1024;
+        static constexpr size_t ReceiveChunkSize = 64 * 1024;
+        static constexpr size_t ReceiveChunksPoolSize = 8;
+        static constexpr size_t MaxGatheredMessages = 64;
+
+        struct OutgoingMessage
+        {
+            eastl::array<uint8_t, MessageHeaderSize> header;
+            BufferView payload;
+        };
+
         asio::ip::tcp::socket m_socket;
         asio::streambuf m_read_buffer;
         asio::streambuf m_write_buffer;
+
+        eastl::deque<OutgoingMessage> m_outgoingMessages;
+        eastl::vector<asio::const_buffer> m_gatheredBuffers;
+        size_t m_gatheredMessages = 0;
+        bool m_messagesWriteInProgress = false;
+
+        // Received bytes of the incomplete message(s) are kept at the beginning of the current chunk
+        BytesBuffer m_receiveChunk;
+        size_t m_receivedSize = 0;
+        // Chunks referenced by the messages handed out: reused once all the messages have been released
+        eastl::vector<ReadOnlyBuffer> m_receiveChunksPool;
         mutable eastl::string m_localEndPoint;
         mutable eastl::string m_remoteEndPoint;
     };
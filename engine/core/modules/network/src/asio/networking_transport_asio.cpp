@@ -32,6 +32,18 @@ namespace nau
         return true;
     }
 
+    size_t NetworkingTransportASIO::readMessages(eastl::vector<BufferView>& messages)
+    {
+        messages.clear();
+        m_connection->readMessages(messages);
+        return messages.size();
+    }
+
+    bool NetworkingTransportASIO::writeMessage(BufferView message)
+    {
+        return m_connection->writeMessage(eastl::move(message));
+    }
+
     bool NetworkingTransportASIO::disconnect()
     {
         return m_connection->disconnect();
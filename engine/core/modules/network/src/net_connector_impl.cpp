@@ -48,7 +48,7 @@ namespace nau
             auto connection = eastl::make_shared<Connection>(localPeerId, remotePeerId);
             connection->m_transport = incomingTransport;
             connection->m_state = Connection::State::accepted;
-            m_connections.push_back(connection);
+            addConnection(connection);
         },
             []() -> void
         {
@@ -80,7 +80,7 @@ namespace nau
             connection->m_remotePeerId = remotePeerId;
             connection->m_transport = outgoingTransport;
             connection->m_state = Connection::State::connected;
-            m_connections.push_back(connection);
+            addConnection(connection);
         },
             []() -> void
         {
@@ -100,14 +100,17 @@ namespace nau
     void NetConnectorImpl::getConnections(const eastl::string& peerId, eastl::vector<eastl::string>& peers)
     {
         peers.clear();
-        for (auto& connection : m_connections)
+        const auto iter = m_localConnections.find(findPeerHandle(peerId));
+        if (iter == m_localConnections.end())
         {
-            if (connection->m_localPeerId == peerId)
+            return;
+        }
+
+        for (const Connection* connection : iter->second)
+        {
+            if (!connection->m_remotePeerId.empty())
             {
-                if (!connection->m_remotePeerId.empty())
-                {
-                    peers.push_back(connection->m_remotePeerId);
-                }
+                peers.push_back(connection->m_remotePeerId);
             }
         }
     }
@@ -123,30 +126,157 @@ namespace nau
 
     void NetConnectorImpl::writeFrame(const eastl::string& peerId, const eastl::string& frame)
     {
-        for (auto& connection : m_connections)
+        const auto iter = m_localConnections.find(findPeerHandle(peerId));
+        if (iter == m_localConnections.end())
         {
-            if (connection->m_localPeerId == peerId)
-            {
-                connection->writeFrame(frame);
-            }
+            return;
+        }
+
+        for (Connection* connection : iter->second)
+        {
+            connection->writeFrame(frame);
         }
     }
 
+    void NetConnectorImpl::writeFrame(const eastl::string& peerId, const eastl::string& toPeerId, const eastl::string& frame)
+    {
+        writeFrame(findPeerHandle(peerId), findPeerHandle(toPeerId), eastl::string_view{frame.data(), frame.size()});
+    }
+
     bool NetConnectorImpl::readFrame(const eastl::string& peerId, const eastl::string& fromPeerId, eastl::string& frame)
     {
+        eastl::string_view frameView;
+        if (readFrame(peerId, fromPeerId, frameView))
+        {
+            frame.assign(frameView.data(), frameView.size());
+            return true;
+        }
         frame.clear();
-        for (auto& connection : m_connections)
+        return false;
+    }
+
+    bool NetConnectorImpl::readFrame(const eastl::string& peerId, const eastl::string& fromPeerId, eastl::string_view& frame)
+    {
+        frame = {};
+        const PeerHandle localPeer = findPeerHandle(peerId);
+        const PeerHandle remotePeer = findPeerHandle(fromPeerId);
+        if (localPeer == InvalidPeerHandle || remotePeer == InvalidPeerHandle)
+        {
+            return false;
+        }
+
+        const auto [begin, end] = m_connectionIndex.equal_range(connectionKey(localPeer, remotePeer));
+        for (auto iter = begin; iter != end; ++iter)
+        {
+            if (iter->second->m_frame.size() > 0)
+            {
+                frame = iter->second->frame();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    INetConnector::PeerHandle NetConnectorImpl::getPeerHandle(eastl::string_view peerId)
+    {
+        if (const auto iter = m_peerHandles.find_as(peerId); iter != m_peerHandles.end())
+        {
+            return iter->second;
+        }
+
+        const PeerHandle handle = static_cast<PeerHandle>(m_peerHandles.size());
+        m_peerHandles.emplace(eastl::string{peerId}, handle);
+        return handle;
+    }
+
+    void NetConnectorImpl::getConnections(PeerHandle peer, eastl::vector<PeerHandle>& peers)
+    {
+        peers.clear();
+        const auto iter = m_localConnections.find(peer);
+        if (iter == m_localConnections.end())
+        {
+            return;
+        }
+
+        for (const Connection* connection : iter->second)
+        {
+            if (connection->m_remotePeer != InvalidPeerHandle)
+            {
+                peers.push_back(connection->m_remotePeer);
+            }
+        }
+    }
+
+    void NetConnectorImpl::writeFrame(PeerHandle peer, PeerHandle toPeer, eastl::string_view frame)
+    {
+        if (peer == InvalidPeerHandle || toPeer == InvalidPeerHandle)
+        {
+            return;
+        }
+
+        const auto [begin, end] = m_connectionIndex.equal_range(connectionKey(peer, toPeer));
+        for (auto iter = begin; iter != end; ++iter)
+        {
+            iter->second->writeFrame(frame);
+        }
+    }
+
+    bool NetConnectorImpl::takeFrame(PeerHandle peer, PeerHandle fromPeer, BufferView& frame)
+    {
+        frame = {};
+        if (peer == InvalidPeerHandle || fromPeer == InvalidPeerHandle)
+        {
+            return false;
+        }
+
+        const auto [begin, end] = m_connectionIndex.equal_range(connectionKey(peer, fromPeer));
+        for (auto iter = begin; iter != end; ++iter)
         {
-            if (connection->m_localPeerId == peerId && connection->m_remotePeerId == fromPeerId)
+            if (iter->second->m_frame.size() > 0)
             {
-                if (!connection->m_frameBuffer.empty())
+                frame = eastl::move(iter->second->m_frame);
+                iter->second->m_frame = {};
+                return true;
+            }
+        }
+        return false;
+    }
+
+    INetConnector::PeerHandle NetConnectorImpl::findPeerHandle(const eastl::string& peerId) const
+    {
+        const auto iter = m_peerHandles.find(peerId);
+        return iter != m_peerHandles.end() ? iter->second : InvalidPeerHandle;
+    }
+
+    void NetConnectorImpl::addConnection(const eastl::shared_ptr<Connection>& connection)
+    {
+        m_connections.push_back(connection);
+        connection->m_localPeer = getPeerHandle(connection->m_localPeerId);
+        m_localConnections[connection->m_localPeer].push_back(connection.get());
+        indexRemotePeer(*connection);
+    }
+
+    void NetConnectorImpl::indexRemotePeer(Connection& connection)
+    {
+        if (connection.m_remotePeer != InvalidPeerHandle)
+        {
+            const auto [begin, end] = m_connectionIndex.equal_range(connectionKey(connection.m_localPeer, connection.m_remotePeer));
+            for (auto iter = begin; iter != end; ++iter)
+            {
+                if (iter->second == &connection)
                 {
-                    frame = connection->m_frameBuffer;
-                    return true;
+                    m_connectionIndex.erase(iter);
+                    break;
                 }
             }
         }
-        return false;
+
+        connection.m_isRemotePeerChanged = false;
+        connection.m_remotePeer = connection.m_remotePeerId.empty() ? InvalidPeerHandle : getPeerHandle(connection.m_remotePeerId);
+        if (connection.m_remotePeer != InvalidPeerHandle)
+        {
+            m_connectionIndex.emplace(connectionKey(connection.m_localPeer, connection.m_remotePeer), &connection);
+        }
     }
 
     void NetConnectorImpl::update()
@@ -158,6 +288,10 @@ namespace nau
         for (auto& connection : m_connections)
         {
             connection->update();
+            if (connection->m_isRemotePeerChanged)
+            {
+                indexRemotePeer(*connection);
+            }
         }
     }
 
@@ -167,14 +301,12 @@ namespace nau
         {
             if (m_transport->isConnected())
             {
-                eastl::vector<NetworkingMessage> messages;
-                m_transport->read(messages);
-                // TODO - move message handling to ASIO transport implementation
-                for (auto& message : messages)
+                m_transport->readMessages(m_messages);
+                for (auto& message : m_messages)
                 {
-                    m_recBuffer.append(asStringView(message.buffer).data());
+                    processMessage(message);
                 }
-                processMessages();
+                m_messages.clear();
                 if (m_remotePeerId.empty())
                 {
                     requestRemoteId();
@@ -183,54 +315,55 @@ namespace nau
         }
     }
 
-    void NetConnectorImpl::Connection::processMessages()
+    void NetConnectorImpl::Connection::processMessage(const BufferView& message)
     {
-        while (true)
+        if (message.size() == 0)
         {
-            size_t start = m_recBuffer.find('\n');
-            if (start == eastl::string::npos)
-            {
-                return;
-            }
-            size_t end = m_recBuffer.find('\r', start);
-            if (end == eastl::string::npos)
-            {
-                return;
-            }
-            eastl::string message = m_recBuffer.substr(start, end - start + 1);
-            m_recBuffer.erase(start, end - start + 1);
-            processMessage(message);
-        }
-    }
-
-    void NetConnectorImpl::Connection::processMessage(const eastl::string& message)
-    {
-        if (message == "\n|req_id\r")
-        {
-            sendId();
             return;
         }
-        if (message.find("\n|id", 0) == 0)
+
+        const char* const data = reinterpret_cast<const char*>(message.data());
+        switch (static_cast<MessageType>(data[0]))
         {
-            m_remotePeerId = message.substr(4, message.size() - 5);
-            return;
+            case MessageType::RequestId:
+                sendId();
+                break;
+            case MessageType::Id:
+                m_remotePeerId.assign(data + 1, message.size() - 1);
+                m_isRemotePeerChanged = true;
+                break;
+            case MessageType::Frame:
+                m_frame = BufferView(message, 1);
+                break;
+            default:
+                break;
         }
-        if (message.find("{") == 1)  // frame data assumed
+    }
+
+    void NetConnectorImpl::Connection::writeMessage(MessageType type, eastl::string_view data)
+    {
+        BytesBuffer buffer(data.size() + 1);
+        buffer.data()[0] = static_cast<std::byte>(type);
+        if (!data.empty())
         {
-            m_frameBuffer = message;
+            std::memcpy(buffer.data() + 1, data.data(), data.size());
         }
+        m_transport->writeMessage(BufferView(eastl::move(buffer)));
+    }
+
+    void NetConnectorImpl::Connection::writeFrame(eastl::string_view frame)
+    {
+        writeMessage(MessageType::Frame, frame);
     }
 
-    void NetConnectorImpl::Connection::writeFrame(const eastl::string& frame)
+    eastl::string_view NetConnectorImpl::Connection::frame() const
     {
-        NetworkingMessage message("\n" + frame + "\r");
-        m_transport->write(message);
+        return {reinterpret_cast<const char*>(m_frame.data()), m_frame.size()};
     }
 
     void NetConnectorImpl::Connection::requestRemoteId()
     {
-        NetworkingMessage message("\n|req_id\r");
-        m_transport->write(message);
+        writeMessage(MessageType::RequestId, {});
         if (m_verbose)
         {
             // NAU_LOG_DEBUG("requestRemoteId()");
@@ -239,8 +372,7 @@ namespace nau
 
     void NetConnectorImpl::Connection::sendId()
     {
-        NetworkingMessage message("\n|id" + m_localPeerId + "\r");
-        m_transport->write(message);
+        writeMessage(MessageType::Id, m_localPeerId);
         if (m_verbose)
         {
             // NAU_LOG_DEBUG("sendId()");
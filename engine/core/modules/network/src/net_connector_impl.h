@@ -6,6 +6,7 @@
 
 #include <EASTL/map.h>
 #include <EASTL/string.h>
+#include <EASTL/unordered_map.h>
 #include <EASTL/utility.h>
 
 #include "nau/network/napi/networking.h"
@@ -38,22 +39,42 @@ namespace nau
         void getConnections(eastl::vector<eastl::weak_ptr<IConnection>>& connections) override;
 
         void writeFrame(const eastl::string& peerId, const eastl::string& frame) override;
+        void writeFrame(const eastl::string& peerId, const eastl::string& toPeerId, const eastl::string& frame) override;
         bool readFrame(const eastl::string& peerId, const eastl::string& fromPeerId, eastl::string& frame) override;
+        bool readFrame(const eastl::string& peerId, const eastl::string& fromPeerId, eastl::string_view& frame) override;
+
+        PeerHandle getPeerHandle(eastl::string_view peerId) override;
+        void getConnections(PeerHandle peer, eastl::vector<PeerHandle>& peers) override;
+        void writeFrame(PeerHandle peer, PeerHandle toPeer, eastl::string_view frame) override;
+        bool takeFrame(PeerHandle peer, PeerHandle fromPeer, BufferView& frame) override;
 
         void update() override;
 
     private:
         struct Connection : public IConnection
         {
+            // Transport messages are length-prefixed, the first byte of the message is its type
+            enum class MessageType : uint8_t
+            {
+                RequestId = 1,
+                Id,
+                Frame
+            };
+
             eastl::string m_localPeerId;
             eastl::string m_remotePeerId;
+            PeerHandle m_localPeer = InvalidPeerHandle;
+            PeerHandle m_remotePeer = InvalidPeerHandle;
             State m_state = none;
             eastl::shared_ptr<INetworkingTransport> m_transport;
 
-            // Temporary measure until we implement some message protocol for stream connections, like ASIO TCP
-            eastl::string m_recBuffer;
+            eastl::vector<BufferView> m_messages;
 
-            eastl::string m_frameBuffer;
+            // Last received frame, references the transport receive buffer
+            BufferView m_frame;
+
+            // Remote peer id has been received, the connection must be reindexed
+            bool m_isRemotePeerChanged = false;
 
             Connection(const eastl::string& localPeerId, const eastl::string& remotePeerId) :
                 m_localPeerId(localPeerId),
@@ -87,9 +108,10 @@ namespace nau
             }
 
             void update();
-            void processMessages();
-            void processMessage(const eastl::string& message);
-            void writeFrame(const eastl::string& frame);
+            void processMessage(const BufferView& message);
+            void writeMessage(MessageType type, eastl::string_view data);
+            void writeFrame(eastl::string_view frame);
+            eastl::string_view frame() const;
             void requestRemoteId();
             void sendId();
 
@@ -102,6 +124,22 @@ namespace nau
         eastl::vector<eastl::pair<eastl::shared_ptr<INetworkingConnector>, ConnectionData>> m_connectors;
         eastl::vector<eastl::shared_ptr<Connection>> m_connections;
 
+        static uint64_t connectionKey(PeerHandle localPeer, PeerHandle remotePeer)
+        {
+            return (static_cast<uint64_t>(localPeer) << 32) | remotePeer;
+        }
+
+        PeerHandle findPeerHandle(const eastl::string& peerId) const;
+        void addConnection(const eastl::shared_ptr<Connection>& connection);
+        void indexRemotePeer(Connection& connection);
+
+        // Interned peer ids
+        eastl::unordered_map<eastl::string, PeerHandle> m_peerHandles;
+
+        // Connections by (local peer, remote peer) and by local peer
+        eastl::unordered_multimap<uint64_t, Connection*> m_connectionIndex;
+        eastl::unordered_map<PeerHandle, eastl::vector<Connection*>> m_localConnections;
+
         // Debug
         bool m_verbose = true;
     };
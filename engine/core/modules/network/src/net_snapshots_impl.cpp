@@ -76,17 +76,79 @@ namespace nau
         auto peerPtr = getPeer(sceneName.data());
         if (peerPtr != nullptr)
         {
-            peerPtr->writeComponent(sceneName.data(), component);
+            peerPtr->writeComponent(sceneName.data(), component, m_binarySnapshots);
         }
     }
 
+    void NetSnapshotsImpl::setBinarySnapshots(bool enabled)
+    {
+        m_binarySnapshots = enabled;
+    }
+
+    void NetSnapshotsImpl::setRelevancySettings(const NetRelevancySettings& settings)
+    {
+        m_relevancySettings = settings;
+    }
+
+    void NetSnapshotsImpl::setViewer(eastl::string_view peerId, eastl::string_view remotePeerId, eastl::optional<math::vec3> position)
+    {
+        const eastl::string peerIdStr{peerId};
+        if (m_peers.count(peerIdStr) == 0)
+        {
+            m_peers.emplace(peerIdStr, PeerData());
+        }
+        m_peers[peerIdStr].m_relevancy[eastl::string{remotePeerId}].viewer = position;
+    }
+
     void NetSnapshotsImpl::nextFrame()
     {
         auto& connector = getServiceProvider().get<INetConnector>();
 
+        eastl::string buffer;
+        eastl::vector<eastl::string> connected;
         for (auto& peer : m_peers)
         {
-            eastl::string buffer;
+            if (m_relevancySettings.enabled)
+            {
+                // Every connection receives its own subset of the frame: components in its interest area, within the bytes budget.
+                peer.second.buildRelevancyIndex(m_frame, m_relevancySettings);
+                connector.getConnections(peer.first, connected);
+                for (auto& remotePeerId : connected)
+                {
+                    peer.second.selectRelevant(m_frame, remotePeerId, m_relevancySettings, m_relevant);
+                    if (m_binarySnapshots)
+                    {
+                        peer.second.serializeFrameBinary(m_frame, peer.second.m_connections[remotePeerId], m_relevant, buffer);
+                    }
+                    else
+                    {
+                        peer.second.serializeFrame(m_frame, m_relevant, buffer);
+                    }
+
+                    if (!buffer.empty())
+                    {
+                        connector.writeFrame(peer.first, remotePeerId, buffer);
+                    }
+                }
+                continue;
+            }
+
+            if (m_binarySnapshots)
+            {
+                // Binary snapshots are delta encoded against the frame acknowledged by the particular remote peer.
+                connector.getConnections(peer.first, connected);
+                for (auto& remotePeerId : connected)
+                {
+                    peer.second.serializeFrameBinary(m_frame, peer.second.m_connections[remotePeerId], buffer);
+                    if (!buffer.empty())
+                    {
+                        connector.writeFrame(peer.first, remotePeerId, buffer);
+                    }
+                }
+                continue;
+            }
+
+            buffer.clear();
             peer.second.serializeFrame(m_frame, buffer);
             if (!buffer.empty())
             {
@@ -105,17 +167,38 @@ namespace nau
     void NetSnapshotsImpl::applyPeerUpdates()
     {
         auto& connector = getServiceProvider().get<INetConnector>();
+        eastl::vector<eastl::string> peers;
         for (auto& peer : m_peers)
         {
-            eastl::vector<eastl::string> peers;
+            const INetConnector::PeerHandle peerHandle = connector.getPeerHandle(peer.first);
             connector.getConnections(peer.first, peers);
             for (auto& connected : peers)
             {
-                eastl::string frameBuffer;
-                if (connector.readFrame(peer.first, connected, frameBuffer))
+                // Each received frame is handed over once, so the same frame is never applied twice.
+                BufferView frame;
+                if (connector.takeFrame(peerHandle, connector.getPeerHandle(connected), frame))
                 {
+                    const eastl::string_view frameBuffer{reinterpret_cast<const char*>(frame.data()), frame.size()};
                     FrameSnapshot frameSnapshot;
-                    auto res = serialization::JsonUtils::parse(frameSnapshot, frameBuffer.c_str());
+                    if (NetSnapshotFormat::isBinaryFrame(frameBuffer))
+                    {
+                        if (!peer.second.deserializeFrameBinary(frameBuffer, peer.second.m_connections[connected], frameSnapshot))
+                        {
+                            continue;
+                        }
+
+                        if (m_peers.count(connected) == 0)
+                        {
+                            m_peers.emplace(connected, PeerData());
+                        }
+                        auto& dstPeer = m_peers[connected];
+                        dstPeer.m_frames.clear();
+                        dstPeer.m_frames.emplace(frameSnapshot.m_frame, frameSnapshot);
+                        applyFrameUpdate(connected, frameSnapshot.m_frame);
+                        continue;
+                    }
+
+                    auto res = serialization::JsonUtils::parse(frameSnapshot, std::string_view{frameBuffer.data(), frameBuffer.size()});
                     if (res.isSuccess())
                     {
                         if (m_peers.count(connected) == 0)
@@ -161,7 +244,15 @@ namespace nau
                     NAU_LOG_WARNING("applyFrameUpdate dst component not found");
                     continue;
                 }
-                component->netRead(componentData.second.m_data);
+                if (componentData.second.m_isBinary)
+                {
+                    const eastl::string& data = componentData.second.m_data;
+                    component->netRead(fromStringView({data.data(), data.size()}));
+                }
+                else
+                {
+                    component->netRead(componentData.second.m_data);
+                }
             }
         }
     }
@@ -247,6 +338,99 @@ namespace nau
         }
     }
 
+    void NetSnapshotsImpl::PeerData::serializeFrame(uint32_t frame, const eastl::vector<uint32_t>& relevant, eastl::string& str)
+    {
+        str.clear();
+        if (m_frames.count(frame) == 0)
+        {
+            return;
+        }
+
+        FrameSnapshot relevantFrame(frame);
+        for (const uint32_t index : relevant)
+        {
+            const RelevancyEntry& entry = m_relevancyEntries[index];
+            relevantFrame.m_scenes[*entry.sceneName].m_components.emplace(*entry.componentPath, *entry.data);
+        }
+
+        io::InplaceStringWriter<char> writer{str};
+        serialization::JsonSettings settings;
+        serialization::jsonWrite(writer, makeValueRef(relevantFrame, getDefaultAllocator()), settings).ignore();
+    }
+
+    void NetSnapshotsImpl::PeerData::buildRelevancyIndex(uint32_t frame, const NetRelevancySettings& settings)
+    {
+        m_relevancyEntries.clear();
+        m_globalEntries.clear();
+        m_interestGrid.clear(settings.cellSize);
+        if (m_frames.count(frame) == 0)
+        {
+            return;
+        }
+
+        for (auto& sceneSnapshot : m_frames[frame].m_scenes)
+        {
+            for (auto& componentData : sceneSnapshot.second.m_components)
+            {
+                const ComponentData& data = componentData.second;
+                const uint32_t index = static_cast<uint32_t>(m_relevancyEntries.size());
+                m_relevancyEntries.push_back({&sceneSnapshot.first, &componentData.first, &data});
+
+                if (data.m_policy.alwaysRelevant || !data.m_position)
+                {
+                    m_globalEntries.push_back(index);
+                }
+                else
+                {
+                    m_interestGrid.add(index, *data.m_position);
+                }
+            }
+        }
+    }
+
+    void NetSnapshotsImpl::PeerData::selectRelevant(uint32_t frame, const eastl::string& remotePeerId, const NetRelevancySettings& settings, eastl::vector<uint32_t>& relevant)
+    {
+        ConnectionRelevancy& connection = m_relevancy[remotePeerId];
+        NetRelevancyScheduler& scheduler = connection.scheduler;
+        scheduler.setDistanceScale(settings.cellSize);
+        scheduler.beginFrame(frame);
+
+        auto addCandidate = [&](uint32_t index)
+        {
+            const RelevancyEntry& entry = m_relevancyEntries[index];
+            float distance = 0.f;
+            if (connection.viewer && entry.data->m_position)
+            {
+                distance = static_cast<float>(length(*entry.data->m_position - *connection.viewer));
+            }
+            scheduler.addCandidate(index, *entry.sceneName, *entry.componentPath, entry.data->m_policy, distance, entry.data->m_data.size());
+        };
+
+        if (connection.viewer)
+        {
+            for (const uint32_t index : m_globalEntries)
+            {
+                addCandidate(index);
+            }
+            m_interestGrid.forEachNear(*connection.viewer, settings.interestRadius, addCandidate);
+        }
+        else
+        {
+            // Viewer is unknown: the whole frame is relevant, only update rates and the bytes budget apply.
+            for (uint32_t index = 0; index < m_relevancyEntries.size(); ++index)
+            {
+                addCandidate(index);
+            }
+        }
+
+        relevant.clear();
+        scheduler.schedule(settings.bytesPerFrame, [&relevant](uint32_t index)
+        {
+            relevant.push_back(index);
+        });
+        eastl::sort(relevant.begin(), relevant.end());
+    }
+
     void NetSnapshotsImpl::PeerData::deserializeFrame(const eastl::string& str)
     {
         FrameSnapshot frameSnapshot;
@@ -257,7 +441,68 @@ namespace nau
         }
     }
 
-    void NetSnapshotsImpl::PeerData::writeComponent(const eastl::string& sceneName, IComponentNetSync* component)
+    void NetSnapshotsImpl::PeerData::serializeFrameBinary(uint32_t frame, NetSnapshotConnection& connection, eastl::string& buffer)
+    {
+        buffer.clear();
+        if (m_frames.count(frame) == 0)
+        {
+            return;
+        }
+
+        connection.encoder.beginFrame(frame, connection.decoder.getLastFrame());
+        for (auto& sceneSnapshot : m_frames[frame].m_scenes)
+        {
+            for (auto& componentData : sceneSnapshot.second.m_components)
+            {
+                NAU_ASSERT(componentData.second.m_isBinary);
+                connection.encoder.writeComponent(sceneSnapshot.first, componentData.first, componentData.second.m_data);
+            }
+        }
+        connection.encoder.endFrame(buffer);
+    }
+
+    void NetSnapshotsImpl::PeerData::serializeFrameBinary(uint32_t frame, NetSnapshotConnection& connection, const eastl::vector<uint32_t>& relevant, eastl::string& buffer)
+    {
+        buffer.clear();
+        if (m_frames.count(frame) == 0)
+        {
+            return;
+        }
+
+        // Components which are not relevant for the connection are omitted: the remote side keeps their last received state.
+        connection.encoder.beginFrame(frame, connection.decoder.getLastFrame());
+        for (const uint32_t index : relevant)
+        {
+            const RelevancyEntry& entry = m_relevancyEntries[index];
+            NAU_ASSERT(entry.data->m_isBinary);
+            connection.encoder.writeComponent(*entry.sceneName, *entry.componentPath, entry.data->m_data);
+        }
+        connection.encoder.endFrame(buffer);
+    }
+
+    bool NetSnapshotsImpl::PeerData::deserializeFrameBinary(eastl::string_view buffer, NetSnapshotConnection& connection, FrameSnapshot& frameSnapshot)
+    {
+        if (!connection.decoder.decode(buffer))
+        {
+            return false;
+        }
+
+        if (const auto remoteAck = connection.decoder.getRemoteAck())
+        {
+            connection.encoder.acknowledge(*remoteAck);
+        }
+
+        frameSnapshot.m_frame = *connection.decoder.getLastFrame();
+        connection.decoder.forEachComponent([&frameSnapshot](eastl::string_view sceneName, eastl::string_view componentPath, eastl::string_view payload)
+        {
+            auto& sceneSnapshot = frameSnapshot.m_scenes[eastl::string{sceneName}];
+            sceneSnapshot.m_components[eastl::string{componentPath}] = ComponentData(payload, true);
+        });
+
+        return true;
+    }
+
+    void NetSnapshotsImpl::PeerData::writeComponent(const eastl::string& sceneName, IComponentNetSync* component, bool isBinary)
     {
         if (m_peerScenes.count(sceneName) == 0)
         {
@@ -265,32 +510,50 @@ namespace nau
             return;
         }
         auto& frame = m_frames[m_currentFrame];
-        frame.writeComponent(sceneName, component);
+        frame.writeComponent(sceneName, component, isBinary);
+    }
+
+    NetSnapshotsImpl::ComponentData::ComponentData(IComponentNetSync* component, bool isBinary) :
+        m_isBinary(isBinary),
+        m_policy(component->getReplicationPolicy()),
+        m_position(component->getNetPosition())
+    {
+        if (isBinary)
+        {
+            BytesBuffer buffer;
+            component->netWrite(buffer);
+            m_data.assign(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+        }
+        else
+        {
+            component->netWrite(m_data);
+        }
     }
 
-    NetSnapshotsImpl::ComponentData::ComponentData(IComponentNetSync* component)
+    NetSnapshotsImpl::ComponentData::ComponentData(eastl::string_view data, bool isBinary) :
+        m_data(data.data(), data.size()),
+        m_isBinary(isBinary)
     {
-        component->netWrite(m_data);
     }
 
-    void NetSnapshotsImpl::FrameSnapshot::writeComponent(const eastl::string& sceneName, IComponentNetSync* component)
+    void NetSnapshotsImpl::FrameSnapshot::writeComponent(const eastl::string& sceneName, IComponentNetSync* component, bool isBinary)
     {
         if (m_scenes.count(sceneName) == 0)
         {
             m_scenes.emplace(sceneName, SceneSnapshot());
         }
         auto& sceneSnapshot = m_scenes[sceneName];
-        sceneSnapshot.writeComponent(component);
+        sceneSnapshot.writeComponent(component, isBinary);
     }
 
-    void NetSnapshotsImpl::SceneSnapshot::writeComponent(IComponentNetSync* component)
+    void NetSnapshotsImpl::SceneSnapshot::writeComponent(IComponentNetSync* component, bool isBinary)
     {
         if (m_components.count(component->getComponentPath().data()) != 0)
         {
             NAU_LOG_ERROR("Net writeComponent must be called once per frame");
             return;
         }
-        m_components.emplace(component->getComponentPath().data(), ComponentData(component));
+        m_components.emplace(component->getComponentPath().data(), ComponentData(component, isBinary));
     }
 
     NetSnapshotsImpl::PeerData* NetSnapshotsImpl::getPeer(const eastl::string& sceneName)
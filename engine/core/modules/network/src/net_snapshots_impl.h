@@ -7,6 +7,8 @@
 #include <EASTL/map.h>
 #include <EASTL/string.h>
 
+#include "nau/network/netsync/net_relevancy.h"
+#include "nau/network/netsync/net_snapshot_codec.h"
 #include "nau/network/netsync/net_snapshots.h"
 #include "nau/rtti/rtti_impl.h"
 #include "nau/rtti/rtti_object.h"
@@ -32,6 +34,10 @@ namespace nau
         void onComponentDeactivated(IComponentNetSync* component) override;
         void onComponentWrite(IComponentNetSync* component) override;
 
+        void setBinarySnapshots(bool enabled) override;
+        void setRelevancySettings(const NetRelevancySettings& settings) override;
+        void setViewer(eastl::string_view peerId, eastl::string_view remotePeerId, eastl::optional<math::vec3> position) override;
+
         void nextFrame() override;
         void applyPeerUpdates();
         void applyFrameUpdate(const eastl::string& peerId, uint32_t frame);
@@ -49,8 +55,16 @@ namespace nau
                 CLASS_FIELD(m_data))
 
             ComponentData() = default;
-            ComponentData(IComponentNetSync* component);
+            ComponentData(IComponentNetSync* component, bool isBinary);
+            ComponentData(eastl::string_view data, bool isBinary);
             eastl::string m_data;
+
+            // Not serializable: m_data is produced by IComponentNetSync::netWrite(BytesBuffer&) (binary snapshots)
+            bool m_isBinary = false;
+
+            // Not serializable: relevancy filtering of the outgoing snapshots
+            NetReplicationPolicy m_policy;
+            eastl::optional<math::vec3> m_position;
         };
 
         // Seriazable
@@ -60,7 +74,7 @@ namespace nau
                 CLASS_FIELD(m_components))
 
             eastl::map<eastl::string, ComponentData> m_components;
-            void writeComponent(IComponentNetSync* component);
+            void writeComponent(IComponentNetSync* component, bool isBinary);
         };
 
         // Seriazable
@@ -78,7 +92,22 @@ namespace nau
             }
             uint32_t m_frame = 0;
             eastl::map<eastl::string, SceneSnapshot> m_scenes;
-            void writeComponent(const eastl::string& sceneName, IComponentNetSync* component);
+            void writeComponent(const eastl::string& sceneName, IComponentNetSync* component, bool isBinary);
+        };
+
+        // Local, not serializable
+        struct RelevancyEntry
+        {
+            const eastl::string* sceneName;
+            const eastl::string* componentPath;
+            const ComponentData* data;
+        };
+
+        // Local, not serializable
+        struct ConnectionRelevancy
+        {
+            eastl::optional<math::vec3> viewer;
+            NetRelevancyScheduler scheduler;
         };
 
         // Local, not serializable
@@ -88,21 +117,43 @@ namespace nau
             eastl::map<eastl::string, IComponentNetScene*> m_peerScenes;
             eastl::map<uint32_t, FrameSnapshot> m_frames;
 
+            // Binary snapshots state, by remote peer id
+            eastl::map<eastl::string, NetSnapshotConnection> m_connections;
+
+            // Relevancy filtering state, by remote peer id
+            eastl::map<eastl::string, ConnectionRelevancy> m_relevancy;
+
+            // Components of the frame being sent, rebuilt by buildRelevancyIndex
+            eastl::vector<RelevancyEntry> m_relevancyEntries;
+            eastl::vector<uint32_t> m_globalEntries;
+            NetInterestGrid m_interestGrid;
+
             void activateScene(IComponentNetScene* scene);
             void deactivateScene(IComponentNetScene* scene);
 
-            void writeComponent(const eastl::string& sceneName, IComponentNetSync* component);
+            void writeComponent(const eastl::string& sceneName, IComponentNetSync* component, bool isBinary);
 
             void advanceToFrame(uint32_t frame);
             void purgeFrames(uint32_t frame);
 
+            void buildRelevancyIndex(uint32_t frame, const NetRelevancySettings& settings);
+            void selectRelevant(uint32_t frame, const eastl::string& remotePeerId, const NetRelevancySettings& settings, eastl::vector<uint32_t>& relevant);
+
             void serializeFrame(uint32_t frame, eastl::string& str);
+            void serializeFrame(uint32_t frame, const eastl::vector<uint32_t>& relevant, eastl::string& str);
             void deserializeFrame(const eastl::string& str);
+
+            void serializeFrameBinary(uint32_t frame, NetSnapshotConnection& connection, eastl::string& buffer);
+            void serializeFrameBinary(uint32_t frame, NetSnapshotConnection& connection, const eastl::vector<uint32_t>& relevant, eastl::string& buffer);
+            bool deserializeFrameBinary(eastl::string_view buffer, NetSnapshotConnection& connection, FrameSnapshot& frameSnapshot);
         };
 
         PeerData* getPeer(const eastl::string& sceneName);
 
         uint32_t m_frame = 0;
+        bool m_binarySnapshots = false;
+        NetRelevancySettings m_relevancySettings;
+        eastl::vector<uint32_t> m_relevant;
         eastl::map<eastl::string, PeerData> m_peers;
         eastl::map<eastl::string, PeerData*> m_sceneToPeer;
         nau::Functor<void(eastl::string_view peerId, eastl::string_view sceneName)> m_onSceneMissing;
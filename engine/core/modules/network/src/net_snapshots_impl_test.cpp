@@ -105,7 +105,7 @@ namespace nau
         TestSceneComponent tsc1(peerName, sceneName);
         peer1.activateScene(&tsc1);
         TestSyncComponent tsyc1(componentPath, sceneName);
-        peer1.writeComponent(sceneName, &tsyc1);
+        peer1.writeComponent(sceneName, &tsyc1, false);
 
         eastl::string frameBuffer;
         peer1.serializeFrame(1, frameBuffer);
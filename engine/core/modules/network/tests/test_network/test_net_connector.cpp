@@ -143,5 +143,78 @@ namespace nau
             ASSERT_TRUE(peers.size() == 2);
         }
 
+        /**
+            Frames are routed by the (local, remote) peer ids for the growing amount of local loopback connections:
+            each client peer is connected to the single server peer and the server must receive the frame of every client from its own connection.
+        */
+        TEST(TestNetConnector, ConnectionIndexRouting)
+        {
+            using namespace std::chrono;
+
+            const eastl::string serverId("Server");
+
+            NetworkingFactoryImpl::Register("ASIO", NetworkingASIO::create);
+            int port = 9960;
+            for (const size_t connectionsCount : {1, 10, 100})
+            {
+                auto netPtr = NetworkingFactoryImpl::Create("ASIO");
+                ASSERT_TRUE(netPtr);
+                eastl::shared_ptr<NetConnectorImpl> netConnector = eastl::make_shared<NetConnectorImpl>();
+                netConnector->init(netPtr);
+
+                const eastl::string url{eastl::string::CtorSprintf{}, "tcp://127.0.0.1:%d/", port++};
+                // Remote peer id is not set: the accepted connections request the ids of the clients.
+                netConnector->listen(serverId, "", url);
+                netConnector->update();
+
+                eastl::vector<eastl::string> clientIds;
+                for (size_t i = 0; i < connectionsCount; ++i)
+                {
+                    clientIds.emplace_back(eastl::string::CtorSprintf{}, "Client%zu", i);
+                    netConnector->connect(clientIds.back(), serverId, url);
+                }
+
+                eastl::vector<eastl::string> peers;
+                size_t established = 0;
+                for (size_t attempt = 0; attempt < 1000 && established < connectionsCount; ++attempt)
+                {
+                    netConnector->update();
+                    std::this_thread::sleep_for(milliseconds(1));
+
+                    established = 0;
+                    for (const auto& clientId : clientIds)
+                    {
+                        netConnector->getConnections(clientId, peers);
+                        established += peers.size();
+                    }
+                }
+                ASSERT_EQ(established, connectionsCount);
+
+                for (const auto& clientId : clientIds)
+                {
+                    netConnector->writeFrame(clientId, serverId, clientId);
+                }
+
+                size_t received = 0;
+                eastl::string_view frameView;
+                for (size_t attempt = 0; attempt < 1000 && received < connectionsCount; ++attempt)
+                {
+                    netConnector->update();
+                    std::this_thread::sleep_for(milliseconds(1));
+
+                    received = 0;
+                    for (const auto& clientId : clientIds)
+                    {
+                        if (netConnector->readFrame(serverId, clientId, frameView))
+                        {
+                            ASSERT_EQ(frameView, eastl::string_view{clientId});
+                            ++received;
+                        }
+                    }
+                }
+                ASSERT_EQ(received, connectionsCount);
+            }
+        }
+
     }  // namespace test
 }  // namespace nau
@@ -2,16 +2,457 @@
 // Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
 
 
-#include "nau/netsync/net_snapshots.h"
+#include "nau/network/components/net_sync_transform_component.h"
+#include "nau/network/netsync/net_relevancy.h"
+#include "nau/network/netsync/net_snapshot_codec.h"
 
 namespace nau
 {
     namespace test
     {
+        namespace
+        {
+            constexpr size_t ComponentsCount = 2000;
+            constexpr size_t MovedComponentsCount = 100;
+            constexpr uint32_t FramesCount = 60;
+
+            eastl::vector<NetworkTransformData> makeTransforms()
+            {
+                eastl::vector<NetworkTransformData> transforms(ComponentsCount);
+                for (size_t i = 0; i < ComponentsCount; ++i)
+                {
+                    const float value = static_cast<float>(i);
+                    transforms[i].position = math::vec3{value, value * 0.5f, -value};
+                    transforms[i].rotation = math::quat::rotationY(value * 0.01f);
+                    transforms[i].scale = math::vec3{1.f, 1.f, 1.f};
+                }
+                return transforms;
+            }
+
+            void moveTransforms(eastl::vector<NetworkTransformData>& transforms, uint32_t frame)
+            {
+                for (size_t i = 0; i < MovedComponentsCount; ++i)
+                {
+                    auto& transform = transforms[(frame * MovedComponentsCount + i) % ComponentsCount];
+                    transform.position += math::vec3{0.1f, 0.f, 0.05f};
+                    transform.rotation = normalize(transform.rotation * math::quat::rotationY(0.02f));
+                }
+            }
+
+            eastl::string componentPath(size_t index)
+            {
+                return eastl::string{eastl::string::CtorSprintf{}, "Object%zu/NetSyncTransformComponent", index};
+            }
+        }  // namespace
+
         TEST(TestNetSnapshots, TestTemplate)
         {
             ASSERT_TRUE(true);
         }
 
+        TEST(TestNetSnapshots, BinaryFrameRoundTrip)
+        {
+            NetSnapshotConnection sender;
+            NetSnapshotConnection receiver;
+
+            eastl::string frameBuffer;
+            sender.encoder.beginFrame(0, eastl::nullopt);
+            sender.encoder.writeComponent("Scene", "Object/Component", "payload");
+            sender.encoder.endFrame(frameBuffer);
+
+            ASSERT_TRUE(NetSnapshotFormat::isBinaryFrame(frameBuffer));
+            ASSERT_TRUE(receiver.decoder.decode(frameBuffer));
+            ASSERT_FALSE(receiver.decoder.decode(frameBuffer));
+
+            size_t componentsCount = 0;
+            receiver.decoder.forEachComponent([&](eastl::string_view sceneName, eastl::string_view path, eastl::string_view payload)
+            {
+                ASSERT_EQ(sceneName, "Scene");
+                ASSERT_EQ(path, "Object/Component");
+                ASSERT_EQ(payload, "payload");
+                ++componentsCount;
+            });
+            ASSERT_EQ(componentsCount, 1);
+
+            // Malformed frame must be rejected
+            frameBuffer.resize(frameBuffer.size() / 2);
+            NetSnapshotDecoder decoder;
+            ASSERT_FALSE(decoder.decode(frameBuffer));
+        }
+
+        /**
+            Frame defining the remote ids can be lost: the decoder must accept the ids that are not dense
+            and must not size its storage by the (untrusted) id values.
+        */
+        TEST(TestNetSnapshots, BinaryFrameSparseRemoteIds)
+        {
+            NetSnapshotConnection sender;
+            NetSnapshotConnection receiver;
+            eastl::string frameBuffer;
+
+            // Frame 0 (defines id 0) is lost.
+            sender.encoder.beginFrame(0, eastl::nullopt);
+            sender.encoder.writeComponent("Scene", "Object0/Component", "payload0");
+            sender.encoder.endFrame(frameBuffer);
+
+            sender.encoder.beginFrame(1, eastl::nullopt);
+            sender.encoder.writeComponent("Scene", "Object1/Component", "payload1");
+            sender.encoder.endFrame(frameBuffer);
+            ASSERT_TRUE(receiver.decoder.decode(frameBuffer));
+
+            frameBuffer.clear();
+            NetBinaryWriter writer{frameBuffer};
+            writer.writeByte(NetSnapshotFormat::FormatTag);
+            writer.writeVarUInt(2);  // frame
+            writer.writeVarUInt(0);  // no baseline
+            writer.writeVarUInt(0);  // no ack
+            writer.writeVarUInt(1);  // components count
+            writer.writeVarUInt((static_cast<uint64_t>(std::numeric_limits<uint32_t>::max() - 1) << 1) | 1);
+            writer.writeString("Scene");
+            writer.writeString("Object2/Component");
+            writer.writeByte(NetSnapshotFormat::Full);
+            writer.writeString("payload2");
+            ASSERT_TRUE(receiver.decoder.decode(frameBuffer));
+
+            eastl::vector<eastl::string> payloads;
+            receiver.decoder.forEachComponent([&](eastl::string_view, eastl::string_view, eastl::string_view payload)
+            {
+                payloads.emplace_back(payload);
+            });
+            ASSERT_EQ(payloads, (eastl::vector<eastl::string>{"payload2"}));
+        }
+
+        /**
+            Rejected frame must not change the last decoded frame nor keep the definitions it contains.
+        */
+        TEST(TestNetSnapshots, BinaryFrameRejectedKeepsState)
+        {
+            NetSnapshotConnection sender;
+            NetSnapshotConnection receiver;
+            eastl::string frameBuffer;
+
+            sender.encoder.beginFrame(0, eastl::nullopt);
+            sender.encoder.writeComponent("Scene", "Object0/Component", "payload0");
+            sender.encoder.endFrame(frameBuffer);
+            ASSERT_TRUE(receiver.decoder.decode(frameBuffer));
+
+            // Frame defining id 1 is truncated.
+            sender.encoder.acknowledge(0);
+            sender.encoder.beginFrame(1, eastl::nullopt);
+            sender.encoder.writeComponent("Scene", "Object0/Component", "payload0");
+            sender.encoder.writeComponent("Scene", "Object1/Component", "payload1");
+            sender.encoder.endFrame(frameBuffer);
+            frameBuffer.resize(frameBuffer.size() - 1);
+            ASSERT_FALSE(receiver.decoder.decode(frameBuffer));
+            ASSERT_EQ(receiver.decoder.getLastFrame(), 0u);
+
+            eastl::vector<eastl::string> payloads;
+            receiver.decoder.forEachComponent([&](eastl::string_view, eastl::string_view, eastl::string_view payload)
+            {
+                payloads.emplace_back(payload);
+            });
+            ASSERT_EQ(payloads, (eastl::vector<eastl::string>{"payload0"}));
+
+            // Id 1 is used without the definition: the definition from the rejected frame must not be kept.
+            frameBuffer.clear();
+            NetBinaryWriter writer{frameBuffer};
+            writer.writeByte(NetSnapshotFormat::FormatTag);
+            writer.writeVarUInt(2);  // frame
+            writer.writeVarUInt(0);  // no baseline
+            writer.writeVarUInt(0);  // no ack
+            writer.writeVarUInt(1);  // components count
+            writer.writeVarUInt(1 << 1);
+            writer.writeByte(NetSnapshotFormat::Full);
+            writer.writeString("payload1");
+            ASSERT_FALSE(receiver.decoder.decode(frameBuffer));
+            ASSERT_EQ(receiver.decoder.getLastFrame(), 0u);
+        }
+
+        /**
+            Frame defining the id is lost and a later frame that does not contain the component is acknowledged:
+            the definition must be sent again (acknowledgement of the later frame does not prove its delivery).
+        */
+        TEST(TestNetSnapshots, BinaryFrameLostDefinitionResent)
+        {
+            NetSnapshotConnection sender;
+            NetSnapshotConnection receiver;
+            eastl::string frameBuffer;
+
+            // Frame 0 (defines id of Object0) is lost.
+            sender.encoder.beginFrame(0, eastl::nullopt);
+            sender.encoder.writeComponent("Scene", "Object0/Component", "payload0");
+            sender.encoder.endFrame(frameBuffer);
+
+            // Object0 is skipped within the frame 1.
+            sender.encoder.beginFrame(1, eastl::nullopt);
+            sender.encoder.writeComponent("Scene", "Object1/Component", "payload1");
+            sender.encoder.endFrame(frameBuffer);
+            ASSERT_TRUE(receiver.decoder.decode(frameBuffer));
+            sender.encoder.acknowledge(*receiver.decoder.getLastFrame());
+
+            sender.encoder.beginFrame(2, eastl::nullopt);
+            sender.encoder.writeComponent("Scene", "Object0/Component", "payload0");
+            sender.encoder.writeComponent("Scene", "Object1/Component", "payload1");
+            sender.encoder.endFrame(frameBuffer);
+            ASSERT_TRUE(receiver.decoder.decode(frameBuffer));
+
+            eastl::vector<eastl::string> paths;
+            receiver.decoder.forEachComponent([&](eastl::string_view, eastl::string_view path, eastl::string_view)
+            {
+                paths.emplace_back(path);
+            });
+            ASSERT_EQ(paths, (eastl::vector<eastl::string>{"Object0/Component", "Object1/Component"}));
+
+            // The frame 2 has carried the definition: after its acknowledgement the id is used without the definition.
+            sender.encoder.acknowledge(*receiver.decoder.getLastFrame());
+            sender.encoder.beginFrame(3, eastl::nullopt);
+            sender.encoder.writeComponent("Scene", "Object0/Component", "payload0");
+            sender.encoder.endFrame(frameBuffer);
+            ASSERT_EQ(frameBuffer.find("Object0"), eastl::string::npos);
+            ASSERT_TRUE(receiver.decoder.decode(frameBuffer));
+        }
+
+        /**
+            Quantized delta encoded binary snapshots (loopback with acknowledgements) must be decoded within the quantization precision
+            and must be much smaller than the JSON ones when only a small part of the components is moved every frame.
+        */
+        TEST(TestNetSnapshots, BinarySnapshotsSize)
+        {
+            eastl::vector<eastl::string> paths;
+            for (size_t i = 0; i < ComponentsCount; ++i)
+            {
+                paths.push_back(componentPath(i));
+            }
+
+            size_t jsonBytes = 0;
+            {
+                auto transforms = makeTransforms();
+                NetworkTransformData received;
+                eastl::string buffer;
+                for (uint32_t frame = 0; frame < FramesCount; ++frame)
+                {
+                    moveTransforms(transforms, frame);
+
+                    for (size_t i = 0; i < ComponentsCount; ++i)
+                    {
+                        buffer.clear();
+                        transforms[i].write(buffer);
+                        jsonBytes += buffer.size() + paths[i].size();
+                        ASSERT_TRUE(received.read(buffer));
+                    }
+                }
+            }
+
+            size_t binaryBytes = 0;
+            {
+                auto transforms = makeTransforms();
+                NetSnapshotConnection sender;
+                NetSnapshotConnection receiver;
+                eastl::string payload;
+                eastl::string frameBuffer;
+                for (uint32_t frame = 0; frame < FramesCount; ++frame)
+                {
+                    moveTransforms(transforms, frame);
+
+                    sender.encoder.beginFrame(frame, sender.decoder.getLastFrame());
+                    for (size_t i = 0; i < ComponentsCount; ++i)
+                    {
+                        payload.clear();
+                        NetBinaryWriter writer{payload};
+                        transforms[i].write(writer);
+                        sender.encoder.writeComponent("Scene", paths[i], payload);
+                    }
+                    sender.encoder.endFrame(frameBuffer);
+                    binaryBytes += frameBuffer.size();
+
+                    ASSERT_TRUE(receiver.decoder.decode(frameBuffer));
+
+                    size_t index = 0;
+                    NetworkTransformData received;
+                    receiver.decoder.forEachComponent([&](eastl::string_view, eastl::string_view, eastl::string_view data)
+                    {
+                        NetBinaryReader reader{data};
+                        ASSERT_TRUE(received.read(reader));
+
+                        const NetworkTransformData& expected = transforms[index++];
+                        ASSERT_LE(length(received.position - expected.position), 1.f / net_quantization::LinearPrecision);
+                        ASSERT_GE(std::fabs(dot(received.rotation, expected.rotation)), 0.9999f);
+                    });
+                    ASSERT_EQ(index, ComponentsCount);
+
+                    // Loopback acknowledgement: the receiver answers with the (empty) frame carrying the ack.
+                    receiver.encoder.beginFrame(frame, receiver.decoder.getLastFrame());
+                    receiver.encoder.endFrame(frameBuffer);
+                    ASSERT_TRUE(sender.decoder.decode(frameBuffer));
+                    sender.encoder.acknowledge(*sender.decoder.getRemoteAck());
+                }
+            }
+
+            // Only the first frame contains the definitions and the full payloads of all the components.
+            ASSERT_LT(binaryBytes * 10, jsonBytes);
+        }
+
+        TEST(TestNetSnapshots, InterestGrid)
+        {
+            NetInterestGrid grid;
+            grid.clear(10.f);
+            grid.add(0, math::vec3{1.f, 0.f, 1.f});
+            grid.add(1, math::vec3{-1.f, 100.f, -1.f});
+            grid.add(2, math::vec3{25.f, 0.f, 0.f});
+            grid.add(3, math::vec3{500.f, 0.f, 500.f});
+
+            eastl::vector<uint32_t> found;
+            grid.forEachNear(math::vec3{0.f, 0.f, 0.f}, 1, [&found](uint32_t entry)
+            {
+                found.push_back(entry);
+            });
+            eastl::sort(found.begin(), found.end());
+            ASSERT_EQ(found, (eastl::vector<uint32_t>{0, 1}));
+
+            found.clear();
+            grid.forEachNear(math::vec3{0.f, 0.f, 0.f}, 2, [&found](uint32_t entry)
+            {
+                found.push_back(entry);
+            });
+            eastl::sort(found.begin(), found.end());
+            ASSERT_EQ(found, (eastl::vector<uint32_t>{0, 1, 2}));
+
+            // Rebuild keeps nothing from the previous frame
+            grid.clear(10.f);
+            found.clear();
+            grid.forEachNear(math::vec3{0.f, 0.f, 0.f}, 2, [&found](uint32_t entry)
+            {
+                found.push_back(entry);
+            });
+            ASSERT_TRUE(found.empty());
+        }
+
+        TEST(TestNetSnapshots, RelevancySchedulerBudget)
+        {
+            constexpr uint32_t CandidatesCount = 10;
+            constexpr size_t PayloadSize = 10;
+
+            NetRelevancyScheduler scheduler;
+            eastl::vector<uint32_t> sendCount(CandidatesCount, 0);
+            for (uint32_t frame = 0; frame < 100; ++frame)
+            {
+                scheduler.beginFrame(frame);
+                for (uint32_t i = 0; i < CandidatesCount; ++i)
+                {
+                    NetReplicationPolicy policy;
+                    policy.priority = i == 0 ? 10.f : 1.f;
+                    scheduler.addCandidate(i, "Scene", componentPath(i), policy, 0.f, PayloadSize);
+                }
+
+                size_t sent = 0;
+                scheduler.schedule(PayloadSize * 2, [&](uint32_t entry)
+                {
+                    ++sendCount[entry];
+                    ++sent;
+                });
+                ASSERT_EQ(sent, 2);
+            }
+
+            // The high priority component is sent most often, but nothing starves.
+            for (uint32_t i = 1; i < CandidatesCount; ++i)
+            {
+                ASSERT_GT(sendCount[i], 0);
+                ASSERT_GT(sendCount[0], sendCount[i]);
+            }
+        }
+
+        TEST(TestNetSnapshots, RelevancySchedulerUpdateInterval)
+        {
+            NetRelevancyScheduler scheduler;
+            NetReplicationPolicy policy;
+            policy.updateInterval = 4;
+
+            uint32_t sendCount = 0;
+            for (uint32_t frame = 0; frame < 16; ++frame)
+            {
+                scheduler.beginFrame(frame);
+                scheduler.addCandidate(0, "Scene", "Object/Component", policy, 0.f, 1);
+                scheduler.schedule(0, [&sendCount](uint32_t)
+                {
+                    ++sendCount;
+                });
+            }
+            ASSERT_EQ(sendCount, 4);
+        }
+
+        /**
+            Compares the egress of the full snapshots with the interest managed ones: each connection views its own part of the world.
+        */
+        TEST(TestNetSnapshots, RelevancyEgress)
+        {
+            constexpr uint32_t ConnectionsCount = 16;
+            constexpr float WorldSize = 1024.f;
+            constexpr float CellSize = 32.f;
+
+            auto transforms = makeTransforms();
+            const float spacing = WorldSize / static_cast<float>(ComponentsCount);
+            for (size_t i = 0; i < ComponentsCount; ++i)
+            {
+                const float value = static_cast<float>(i) * spacing;
+                transforms[i].position = math::vec3{value, 0.f, std::fmod(value * 7.f, WorldSize)};
+            }
+
+            eastl::vector<eastl::string> paths;
+            eastl::vector<eastl::string> payloads;
+            for (size_t i = 0; i < ComponentsCount; ++i)
+            {
+                paths.push_back(componentPath(i));
+                NetBinaryWriter writer{payloads.emplace_back()};
+                transforms[i].write(writer);
+            }
+
+            NetInterestGrid grid;
+            grid.clear(CellSize);
+            for (size_t i = 0; i < ComponentsCount; ++i)
+            {
+                grid.add(static_cast<uint32_t>(i), transforms[i].position);
+            }
+
+            size_t fullBytes = 0;
+            size_t relevantBytes = 0;
+            eastl::string frameBuffer;
+            for (uint32_t connection = 0; connection < ConnectionsCount; ++connection)
+            {
+                const float viewerPosition = WorldSize * static_cast<float>(connection) / ConnectionsCount;
+                const math::vec3 viewer{viewerPosition, 0.f, viewerPosition};
+
+                NetSnapshotEncoder fullEncoder;
+                fullEncoder.beginFrame(0, eastl::nullopt);
+                for (size_t i = 0; i < ComponentsCount; ++i)
+                {
+                    fullEncoder.writeComponent("Scene", paths[i], payloads[i]);
+                }
+                fullEncoder.endFrame(frameBuffer);
+                fullBytes += frameBuffer.size();
+
+                NetRelevancyScheduler scheduler;
+                scheduler.beginFrame(0);
+                grid.forEachNear(viewer, 2, [&](uint32_t entry)
+                {
+                    const float distance = static_cast<float>(length(transforms[entry].position - viewer));
+                    scheduler.addCandidate(entry, "Scene", paths[entry], NetReplicationPolicy{}, distance, payloads[entry].size());
+                });
+
+                NetSnapshotEncoder relevantEncoder;
+                relevantEncoder.beginFrame(0, eastl::nullopt);
+                scheduler.schedule(0, [&](uint32_t entry)
+                {
+                    relevantEncoder.writeComponent("Scene", paths[entry], payloads[entry]);
+                });
+                relevantEncoder.endFrame(frameBuffer);
+                relevantBytes += frameBuffer.size();
+            }
+
+            std::cout << "full: " << fullBytes / ConnectionsCount << " bytes per connection, "
+                      << "relevant: " << relevantBytes / ConnectionsCount << " bytes per connection" << std::endl;
+
+            ASSERT_LT(relevantBytes * 4, fullBytes);
+        }
+
     }  // namespace test
 }  // namespace nau
@@ -59,5 +59,121 @@ namespace nau
             ASSERT_TRUE(connectorState == 1);
         }
 
+        TEST(TestNetTransportASIO, TestLengthPrefixedMessages)
+        {
+            NetworkingFactoryImpl::Register("ASIO", NetworkingASIO::create);
+            auto netPtr = NetworkingFactoryImpl::Create("ASIO");
+            ASSERT_TRUE(netPtr);
+            auto listener = netPtr->createListener();
+            auto connector = netPtr->createConnector();
+            eastl::string url("tcp://127.0.0.1:9993/");
+            eastl::shared_ptr<INetworkingTransport> transportIncoming;
+            eastl::shared_ptr<INetworkingTransport> transportOutgoing;
+            listener->listen(
+                url,
+                [&transportIncoming](eastl::shared_ptr<INetworkingTransport> incomingTransport) -> void
+            {
+                transportIncoming = incomingTransport;
+            },
+                []() -> void
+            {
+            });
+            connector->connect(
+                url,
+                [&transportOutgoing](eastl::shared_ptr<INetworkingTransport> outgoingTransport) -> void
+            {
+                transportOutgoing = outgoingTransport;
+            },
+                []() -> void
+            {
+            });
+            netPtr->update();
+            ASSERT_TRUE(transportIncoming);
+            ASSERT_TRUE(transportOutgoing);
+
+            // Empty, small and larger than the receive chunk messages
+            const eastl::vector<size_t> sizes = {0, 1, 17, 300 * 1024, 5, 70 * 1024, 0, 3};
+            for (size_t i = 0; i < sizes.size(); ++i)
+            {
+                BytesBuffer buffer(sizes[i]);
+                for (size_t j = 0; j < sizes[i]; ++j)
+                {
+                    buffer.data()[j] = static_cast<std::byte>(i + j);
+                }
+                ASSERT_TRUE(transportOutgoing->writeMessage(BufferView(std::move(buffer))));
+            }
+
+            eastl::vector<BufferView> received;
+            eastl::vector<BufferView> messages;
+            for (int attempt = 0; attempt < 1000 && received.size() < sizes.size(); ++attempt)
+            {
+                netPtr->update();
+                transportIncoming->readMessages(messages);
+                received.insert(received.end(), messages.begin(), messages.end());
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+
+            ASSERT_EQ(received.size(), sizes.size());
+            for (size_t i = 0; i < sizes.size(); ++i)
+            {
+                ASSERT_EQ(received[i].size(), sizes[i]);
+                for (size_t j = 0; j < sizes[i]; ++j)
+                {
+                    ASSERT_EQ(received[i].data()[j], static_cast<std::byte>(i + j));
+                }
+            }
+        }
+
+        TEST(TestNetTransportASIO, TestInvalidMessageSizeDisconnects)
+        {
+            NetworkingFactoryImpl::Register("ASIO", NetworkingASIO::create);
+            auto netPtr = NetworkingFactoryImpl::Create("ASIO");
+            ASSERT_TRUE(netPtr);
+            auto listener = netPtr->createListener();
+            auto connector = netPtr->createConnector();
+            eastl::string url("tcp://127.0.0.1:9992/");
+            eastl::shared_ptr<INetworkingTransport> transportIncoming;
+            eastl::shared_ptr<INetworkingTransport> transportOutgoing;
+            listener->listen(
+                url,
+                [&transportIncoming](eastl::shared_ptr<INetworkingTransport> incomingTransport) -> void
+            {
+                transportIncoming = incomingTransport;
+            },
+                []() -> void
+            {
+            });
+            connector->connect(
+                url,
+                [&transportOutgoing](eastl::shared_ptr<INetworkingTransport> outgoingTransport) -> void
+            {
+                transportOutgoing = outgoingTransport;
+            },
+                []() -> void
+            {
+            });
+            netPtr->update();
+            ASSERT_TRUE(transportIncoming);
+            ASSERT_TRUE(transportOutgoing);
+
+            // Raw stream: the valid message followed by the header with the size above the limit
+            NetworkingMessage message;
+            message.buffer.resize(4 + 1 + 4);
+            const uint8_t bytes[] = {1, 0, 0, 0, 42, 0xff, 0xff, 0xff, 0xff};
+            std::memcpy(message.buffer.data(), bytes, sizeof(bytes));
+            ASSERT_TRUE(transportOutgoing->write(message));
+
+            eastl::vector<BufferView> messages;
+            for (int attempt = 0; attempt < 1000 && transportIncoming->isConnected(); ++attempt)
+            {
+                netPtr->update();
+                transportIncoming->readMessages(messages);
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+
+            ASSERT_FALSE(transportIncoming->isConnected());
+            transportIncoming->readMessages(messages);
+            ASSERT_TRUE(messages.empty());
+        }
     }  // namespace test
 }  // namespace nau
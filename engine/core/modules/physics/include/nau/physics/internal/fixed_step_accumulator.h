@@ -0,0 +1,77 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+namespace nau::physics
+{
+    /**
+        @brief Splits the elapsed time into the fixed simulation steps.
+
+        Every step advances the simulation by the same time, so the simulation does not depend on the frame rate.
+        The time that is not enough for the whole step is carried over to the next advance() call.
+        The count of the steps per call is capped: the rest of the accumulated time is dropped,
+        so on overload the simulation slows down instead of spending even more time to catch up.
+     */
+    class FixedStepAccumulator
+    {
+    public:
+        FixedStepAccumulator() = default;
+
+        /**
+            @param fixedStep Simulation step in seconds. 0 disables the fixed step.
+            @param maxStepsCount Maximum count of the steps per advance() call.
+         */
+        FixedStepAccumulator(float fixedStep, uint32_t maxStepsCount) :
+            m_fixedStep(fixedStep),
+            m_maxStepsCount(std::max(maxStepsCount, 1u))
+        {
+        }
+
+        bool isEnabled() const
+        {
+            return m_fixedStep > 0.f;
+        }
+
+        float getFixedStep() const
+        {
+            return m_fixedStep;
+        }
+
+        /**
+            @brief Accumulates the elapsed time (in seconds).
+            @return Count of the fixed steps to perform.
+         */
+        uint32_t advance(double dt)
+        {
+            if (!isEnabled())
+            {
+                return 0;
+            }
+
+            m_accumulatedTime = std::min(m_accumulatedTime + dt, static_cast<double>(m_fixedStep) * m_maxStepsCount);
+
+            const uint32_t stepsCount = static_cast<uint32_t>(m_accumulatedTime / m_fixedStep);
+            m_accumulatedTime -= static_cast<double>(m_fixedStep) * stepsCount;
+
+            return stepsCount;
+        }
+
+        /**
+            @brief Accumulated time as the fraction of the step in [0, 1): position of the state to present between the last two steps.
+         */
+        float getInterpolationAlpha() const
+        {
+            return isEnabled() ? std::min(static_cast<float>(m_accumulatedTime / m_fixedStep), 1.f) : 1.f;
+        }
+
+    private:
+        float m_fixedStep = 0.f;
+        uint32_t m_maxStepsCount = 1;
+        double m_accumulatedTime = 0.0;
+    };
+}  // namespace nau::physics
@@ -0,0 +1,131 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <EASTL/span.h>
+
+#include "nau/math/math.h"
+#include "nau/physics/physics_collider.h"
+#include "nau/physics/physics_defines.h"
+#include "nau/physics/physics_material.h"
+#include "nau/utils/uid.h"
+
+
+namespace nau::physics
+{
+    /**
+     * @brief Kind of the batched physics query.
+     */
+    enum class PhysicsQueryType : uint8_t
+    {
+        /**
+         * @brief Casts a ray and reports the closest hit.
+         */
+        RayCast,
+
+        /**
+         * @brief Sweeps a shape along the direction and reports the closest hit.
+         */
+        ShapeCast,
+
+        /**
+         * @brief Tests a shape placed at the origin and reports any overlapping body.
+         */
+        Overlap
+    };
+
+    /**
+     * @brief Encapsulates the single query of the batch performed by IPhysicsWorld::castQueriesAsync.
+     *
+     * Unlike RayCastQuery it does not own any memory: the referenced shape and channels are expected
+     * to outlive the batch, so building a batch does not allocate.
+     */
+    struct PhysicsQuery
+    {
+        static constexpr TFloat DefaultMaxDistance = 1000;
+
+        uint32_t id = 0;
+
+        PhysicsQueryType type = PhysicsQueryType::RayCast;
+
+        /**
+         * @brief World coordinates of the ray start or of the shape center.
+         */
+        math::vec3 origin;
+
+        /**
+         * @brief Orientation of the shape. Ignored by ray casts.
+         */
+        math::quat rotation = math::quat::identity();
+
+        /**
+         * @brief Normalized cast direction. Ignored by overlap queries.
+         */
+        math::vec3 direction;
+
+        /**
+         * @brief Length of the cast. Anything beyond this length will not be reported as a hit.
+         *
+         * Must be positive and finite: the shape is swept along the whole length, so shape casts reject the unbounded lengths.
+         */
+        TFloat maxDistance = DefaultMaxDistance;
+
+        /**
+         * @brief Shape of the shape cast and overlap queries, created by ICollisionShapesFactory.
+         */
+        const ICollisionShape* shape = nullptr;
+
+        /**
+         * @brief List of channels the query should hit.
+         *
+         * Empty list means the query should hit any channel.
+         */
+        eastl::span<const CollisionChannel> reactChannels;
+
+        /**
+         * @brief Indicates whether the query should ignore or hit triggers.
+         */
+        bool ignoreTriggers = false;
+    };
+
+    /**
+     * @brief Encapsulates the result of the single PhysicsQuery.
+     */
+    struct PhysicsQueryResult
+    {
+        uint32_t queryId = 0;
+
+        /**
+         * @brief Scene object the hit body is attached to, or NullUid if nothing has been hit.
+         */
+        Uid sceneObjectUid = NullUid;
+
+        /**
+         * @brief Material of the hit collider.
+         */
+        IPhysicsMaterial::Ptr material;
+
+        /**
+         * @brief Coordinates of the hit (the contact point for the shape queries).
+         */
+        math::vec3 position;
+
+        /**
+         * @brief Surface normal of the hit collider at the @ref position.
+         */
+        math::vec3 normal;
+
+        /**
+         * @brief Distance traveled along the direction until the hit (always 0 for the overlap queries).
+         */
+        TFloat distance = 0;
+
+        bool hasHit() const
+        {
+            return sceneObjectUid != NullUid;
+        }
+    };
+
+}  // namespace nau::physics
@@ -10,6 +10,7 @@
 #include "nau/memory/eastl_aliases.h"
 #include "nau/physics/physics_defines.h"
 #include "nau/physics/physics_material.h"
+#include "nau/physics/physics_query.h"
 #include "nau/physics/physics_raycast.h"
 #include "nau/rtti/rtti_impl.h"
 #include "nau/scene/scene_object.h"
@@ -22,6 +23,16 @@ namespace nau::physics
     struct IPhysicsContactListener;
     struct PhysicsBodyCreationData;
 
+    /**
+     * @brief World transform of the body moved by the simulation.
+     */
+    struct PhysicsBodyTransform
+    {
+        IPhysicsBody* body = nullptr;
+        math::vec3 position;
+        math::quat rotation;
+    };
+
     /**
      * @brief Provides physics system functionality like creating a physical body or casting a ray.
      */
@@ -98,6 +109,17 @@ namespace nau::physics
 
         virtual async::Task<eastl::vector<RayCastResult>> castRaysAsync(eastl::vector<physics::RayCastQuery> queries) const = 0;
 
+        /**
+         * @brief Performs a batch of ray casts, shape casts and overlap queries.
+         *
+         * Queries are distributed over the physics worker threads.
+         *
+         * @param [in] queries  Queries to perform. Shapes and channels referenced by the queries must stay alive until the task is completed.
+         * @param [out] results Preallocated storage for the results, at least of the queries size: results[i] is filled for queries[i].
+         *                      It must stay alive until the task is completed.
+         */
+        virtual async::Task<> castQueriesAsync(eastl::span<const PhysicsQuery> queries, eastl::span<PhysicsQueryResult> results) const = 0;
+
         inline async::Task<RayCastResult> castRayAsync(physics::RayCastQuery query) const
         {
             eastl::vector<RayCastResult> result = co_await this->castRaysAsync({std::move(query)});
@@ -109,6 +131,15 @@ namespace nau::physics
 
         virtual void setGravity(const nau::math::vec3& gravity) = 0;
 
+        /**
+         * @brief Collects the transforms of the bodies that are moved by the simulation (i.e. awake non-static bodies).
+         *
+         * @param [out] transforms  Receives the transforms. It is cleared first: keeping it between the calls avoids allocations.
+         *
+         * @note Must not be called while the simulation is ticked.
+         */
+        virtual void getActiveBodiesTransforms(eastl::vector<PhysicsBodyTransform>& transforms) const = 0;
+
     private:
 
         virtual void syncSceneState() = 0;
@@ -5,6 +5,7 @@
 #include "physics_service.h"
 
 #include "nau/app/application.h"
+#include "nau/app/global_properties.h"
 #include "nau/physics/components/rigid_body_component.h"
 #include "nau/physics/physics_collision_shapes_factory.h"
 #include "nau/scene/internal/scene_manager_internal.h"
@@ -33,12 +34,42 @@ namespace nau::physics
             return ctor->invokeToPtr(nullptr, {});
         }
 
+        struct PhysicsSimulationConfig
+        {
+            // Rate (Hz) of the fixed simulation step. 0 - the simulation is ticked once per update with the variable delta time.
+            float fixedStepRate = 60.f;
+
+            // Maximum amount of the fixed steps per update: the rest of the accumulated time is dropped,
+            // so on overload the simulation slows down instead of spending even more time to catch up.
+            uint32_t maxSubSteps = 4;
+
+            NAU_CLASS_FIELDS(
+                CLASS_FIELD(fixedStepRate),
+                CLASS_FIELD(maxSubSteps))
+        };
+
+        PhysicsSimulationConfig getPhysicsSimulationConfig()
+        {
+            if (GlobalProperties* const properties = getServiceProvider().find<GlobalProperties>())
+            {
+                return properties->getValue<PhysicsSimulationConfig>("/physics").value_or(PhysicsSimulationConfig{});
+            }
+
+            return {};
+        }
+
     }  // namespace
 
     PhysicsService::PhysicsService() = default;
 
     async::Task<> PhysicsService::preInitService()
     {
+        const PhysicsSimulationConfig config = getPhysicsSimulationConfig();
+        if (config.fixedStepRate > 0.f)
+        {
+            m_fixedStep = FixedStepAccumulator{1.f / config.fixedStepRate, config.maxSubSteps};
+        }
+
         if (auto shapesFactory = createServiceClass<ICollisionShapesFactory>())
         {
             getServiceProvider().addService(shapesFactory);
@@ -105,12 +136,26 @@ namespace nau::physics
             co_return false;
         }
 
-        constexpr float MaxSimulationStep = 0.1f;
-        const float simulationTimeStep = std::min(static_cast<float>(dt.count()) / 1000.f, MaxSimulationStep);
+        if (!m_fixedStep.isEnabled())
+        {
+            constexpr float MaxSimulationStep = 0.1f;
+            const float simulationTimeStep = std::min(static_cast<float>(dt.count()) / 1000.f, MaxSimulationStep);
 
-        for (PhysicsWorldState& physWorld : m_physicsWorlds)
+            for (PhysicsWorldState& physWorld : m_physicsWorlds)
+            {
+                physWorld.tick(simulationTimeStep);
+            }
+
+            co_return true;
+        }
+
+        const uint32_t stepsCount = m_fixedStep.advance(static_cast<double>(dt.count()) / 1000.0);
+        for (uint32_t step = 0; step < stepsCount; ++step)
         {
-            physWorld.tick(simulationTimeStep);
+            for (PhysicsWorldState& physWorld : m_physicsWorlds)
+            {
+                physWorld.tick(m_fixedStep.getFixedStep());
+            }
         }
 
         co_return true;
@@ -118,6 +163,13 @@ namespace nau::physics
 
     eastl::optional<std::chrono::milliseconds> PhysicsService::getFixedUpdateTimeStep()
     {
+        if (m_fixedStep.isEnabled())
+        {
+            // The update rate may be a bit higher than the simulation rate (the step is rounded down to milliseconds):
+            // the accumulator skips the updates without the whole step.
+            return std::chrono::milliseconds(std::max(static_cast<int>(m_fixedStep.getFixedStep() * 1000.f), 1));
+        }
+
         // The target refresh rate value can be calculated more intelligently (or at least loaded from global settings)
         constexpr size_t TargetStepsPerSecond = 75;
         constexpr size_t SimulationStepTime = 1000.0f / TargetStepsPerSecond;
@@ -10,6 +10,7 @@
 #include "nau/physics/components/rigid_body_component.h"
 #include "nau/physics/core_physics.h"
 #include "nau/physics/internal/core_physics_internal.h"
+#include "nau/physics/internal/fixed_step_accumulator.h"
 #include "nau/physics/physics_world.h"
 #include "nau/runtime/async_disposable.h"
 #include "nau/scene/scene_processor.h"
@@ -63,6 +64,11 @@ namespace nau::physics
 
         PhysicsWorldState* getPhysicsWorldState(Uid uid, bool createOnDemand);
 
+        /**
+            Disabled fixed step means the simulation is ticked once per update with the variable (clamped) delta time.
+        */
+        FixedStepAccumulator m_fixedStep;
+
         std::atomic<bool> m_isPaused = false;
         std::atomic<bool> m_isShutdownRequested = false;
         async::TaskSource<> m_physicsStopedSignal;
@@ -11,6 +11,21 @@
 
 namespace nau::physics
 {
+    namespace
+    {
+        void writeSceneTransform(PhysicsBodyEntry& entry, const math::vec3& position, const math::quat& rotation)
+        {
+            scene::SceneObject& parentObject = entry.componentRef->getParentObject();
+
+            // TODO: maybe do not need to getting world transform ?
+            // If no need to deal with scale
+            auto transform = parentObject.getWorldTransform();
+            transform.setTranslation(position);
+            transform.setRotation(rotation);
+            parentObject.setWorldTransform(transform);
+        }
+    }  // namespace
+
     PhysicsWorldState::PhysicsWorldState(Uid worldUid) :
         m_worldUid(worldUid)
     {
@@ -24,6 +39,7 @@ namespace nau::physics
 
     PhysicsWorldState::~PhysicsWorldState()
     {
+        m_bodyEntries.clear();
         m_bodies.clear();
     }
 
@@ -48,6 +64,12 @@ namespace nau::physics
         m_physics->tick(secondsDt);
     }
 
+    PhysicsBodyEntry* PhysicsWorldState::findEntry(const IPhysicsBody* body) const
+    {
+        auto iter = m_bodyEntries.find(body);
+        return iter != m_bodyEntries.end() && iter->second->componentRef ? iter->second : nullptr;
+    }
+
     async::Task<> PhysicsWorldState::activateComponents(eastl::span<const scene::Component*> components)
     {
         using namespace nau::scene;
@@ -65,18 +87,26 @@ namespace nau::physics
                 }
 
                 m_bodies.emplace_back(*rigidBodyComponent, std::move(physBody));
+                m_bodyEntries[m_bodies.back().physicsBody.get()] = &m_bodies.back();
             }
         }
     }
 
     void PhysicsWorldState::deactivateComponents(eastl::span<const scene::DeactivatedComponentData> components)
     {
-        eastl::erase_if(m_bodies, [&components](const PhysicsBodyEntry& entry)
+        eastl::erase_if(m_bodies, [this, &components](const PhysicsBodyEntry& entry)
         {
-            return eastl::find_if(components.begin(), components.end(), [&entry](const scene::DeactivatedComponentData& c)
+            const bool isDeactivated = eastl::find_if(components.begin(), components.end(), [&entry](const scene::DeactivatedComponentData& c)
             {
                 return c.componentUid == entry.componentUid;
-            });
+            }) != components.end();
+
+            if (isDeactivated)
+            {
+                m_bodyEntries.erase(entry.physicsBody.get());
+            }
+
+            return isDeactivated;
         });
     }
 
@@ -107,34 +137,58 @@ namespace nau::physics
             }
         }
 
+        if (!m_isPaused)
+        {
+            // Only the bodies moved by the simulation are written to the scene: sleeping and static bodies keep their transforms.
+            ++m_syncStamp;
+            m_physics->getActiveBodiesTransforms(m_activeTransforms);
+            for (const PhysicsBodyTransform& bodyTransform : m_activeTransforms)
+            {
+                PhysicsBodyEntry* const entry = findEntry(bodyTransform.body);
+                if (!entry)
+                {
+                    continue;
+                }
+
+                writeSceneTransform(*entry, bodyTransform.position, bodyTransform.rotation);
+                entry->syncStamp = m_syncStamp;
+                m_syncedBodiesScratch.push_back(entry->physicsBody.get());
+            }
+
+            // Bodies that have fallen asleep since the last sync are not active anymore: the scene may miss their final transform.
+            for (const IPhysicsBody* const body : m_syncedBodies)
+            {
+                PhysicsBodyEntry* const entry = findEntry(body);
+                if (entry && entry->syncStamp != m_syncStamp)
+                {
+                    math::mat4 physTransform;
+                    entry->physicsBody->getTransform(physTransform);
+                    writeSceneTransform(*entry, physTransform.getTranslation(), math::quat{physTransform.getUpper3x3()});
+                }
+            }
+
+            m_syncedBodies.swap(m_syncedBodiesScratch);
+            m_syncedBodiesScratch.clear();
+        }
+
         for (auto entry = m_bodies.begin(); entry != m_bodies.end();)
         {
             if (!entry->componentRef)
             {
+                m_bodyEntries.erase(entry->physicsBody.get());
                 entry = m_bodies.erase(entry);
                 continue;
             }
 
             NAU_FATAL(entry->physicsBody);
 
-            SceneObject& parentObject = entry->componentRef->getParentObject();
-
             if (!m_isPaused)
             {
-                math::mat4 physTransform;
-                entry->physicsBody->getTransform(physTransform);
-
-                // TODO: maybe do not need to getting world transform ?
-                // If no need to deal with scale
-                auto transform = parentObject.getWorldTransform();
-                transform.setTranslation(physTransform.getTranslation());
-                transform.setRotation(math::quat(physTransform.getUpper3x3()));
-                parentObject.setWorldTransform(transform);
-
                 entry->componentRef->applyPhysicsBodyActions(entry->physicsBody.get());
             }
             else
             {
+                SceneObject& parentObject = entry->componentRef->getParentObject();
                 entry->physicsBody->setTransform({parentObject.getRotation(), parentObject.getWorldTransform().getTranslation()});
                 entry->componentRef->applyPhysicsBodyActions(nullptr);
             }
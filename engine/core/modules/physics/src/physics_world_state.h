@@ -4,6 +4,9 @@
 
 #pragma once
 
+#include <EASTL/unordered_map.h>
+#include <EASTL/vector.h>
+
 #include "nau/memory/eastl_aliases.h"
 #include "nau/physics/components/rigid_body_component.h"
 #include "nau/physics/physics_body.h"
@@ -19,6 +22,9 @@ namespace nau::physics
         scene::ObjectWeakRef<RigidBodyComponent> componentRef;
         nau::Ptr<IPhysicsBody> physicsBody;
 
+        // Sync stamp of the last write of the body transform to the scene.
+        uint32_t syncStamp = 0;
+
         PhysicsBodyEntry(const RigidBodyComponent& inRigidBodyComponent, nau::Ptr<IPhysicsBody> inPhysicsBody) :
             componentUid(inRigidBodyComponent.getUid()),
             componentRef(const_cast<RigidBodyComponent&>(inRigidBodyComponent)),
@@ -57,9 +63,18 @@ namespace nau::physics
     private:
         async::Task<nau::Ptr<IPhysicsBody>> createPhysicsBodyForComponent(const RigidBodyComponent& component);
 
+        PhysicsBodyEntry* findEntry(const IPhysicsBody* body) const;
+
         const Uid m_worldUid;
         nau::Ptr<IPhysicsWorld> m_physics;
         List<PhysicsBodyEntry> m_bodies;
+        eastl::unordered_map<const IPhysicsBody*, PhysicsBodyEntry*> m_bodyEntries; /** < Index of m_bodies by the physics body. */
+
+        eastl::vector<PhysicsBodyTransform> m_activeTransforms;
+        eastl::vector<const IPhysicsBody*> m_syncedBodies; /** < Bodies written to the scene by the last sync. */
+        eastl::vector<const IPhysicsBody*> m_syncedBodiesScratch;
+        uint32_t m_syncStamp = 0;
+
         bool m_isPaused = false;
     };
 }  // namespace nau::physics
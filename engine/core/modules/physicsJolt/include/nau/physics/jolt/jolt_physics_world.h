@@ -4,22 +4,27 @@
 
 #pragma once
 
+#include "nau/async/executor.h"
 #include "nau/rtti/rtti_impl.h"
 #include "nau/math/math.h"
 #include "nau/debugRenderer/debug_render_system.h"
+#include "nau/physics/components/rigid_body_component.h"
 #include "nau/physics/physics_world.h"
 #include "nau/physics/physics_contact_listener.h"
 #include "nau/physics/jolt/jolt_physics_body.h"
 #include "nau/physics/jolt/jolt_physics_material.h"
 #include "nau/physics/jolt/jolt_debug_renderer.h"
+#include "nau/scene/scene_manager.h"
 
 #include <EASTL/unique_ptr.h>
 #include <EASTL/shared_ptr.h>
 #include <EASTL/tuple.h>
+#include <EASTL/unordered_map.h>
 
 #include <Jolt/Jolt.h>
 #include <Jolt/Core/Color.h>
 #include <Jolt/Core/Mutex.h>
+#include <Jolt/Physics/Body/BodyManager.h>
 #include <Jolt/Physics/Collision/ContactListener.h>
 
 namespace JPH
@@ -50,6 +55,9 @@ namespace nau::physics::jolt
          * @brief Default constructor.
          * 
          * Initializes all associated Jolt objects.
+         * 
+         * Simulation jobs run on the executor selected by the `/physics/jobThreadsCount` global property:
+         * `-1` (default) - engine default executor, `0` - single threaded simulation, `N` - dedicated pool of N threads.
          */
         JoltPhysicsWorld();
 
@@ -154,6 +162,16 @@ namespace nau::physics::jolt
 
         async::Task<eastl::vector<RayCastResult>> castRaysAsync(eastl::vector<physics::RayCastQuery> queries) const override;
 
+        /**
+         * @brief Performs a batch of ray casts, shape casts and overlap queries.
+         *
+         * @param [in] queries  Queries to perform. Shapes and channels referenced by the queries must stay alive until the task is completed.
+         * @param [out] results Preallocated storage for the results, at least of the queries size.
+         *
+         * The batch is split into chunks which are executed as Jolt jobs, i.e. on the same threads as the simulation.
+         */
+        async::Task<> castQueriesAsync(eastl::span<const PhysicsQuery> queries, eastl::span<PhysicsQueryResult> results) const override;
+
         /**
          * @brief Performs physics debug drawing.
          * 
@@ -166,10 +184,24 @@ namespace nau::physics::jolt
 
         virtual void setGravity(const nau::math::vec3& gravity) override;
 
+        /**
+         * @brief Collects the transforms of the bodies from the Jolt active bodies list.
+         *
+         * @param [out] transforms  Receives the transforms.
+         */
+        void getActiveBodiesTransforms(eastl::vector<PhysicsBodyTransform>& transforms) const override;
+
         void syncSceneState() override;
 
     private:
 
+        /**
+         * @brief Performs the batch of queries on the Jolt job system.
+         *
+         * @note Must be called on the physics executor: queries use the NoLock Jolt API, so the simulation must not be ticked concurrently.
+         */
+        void performQueries(eastl::span<const PhysicsQuery> queries, eastl::span<PhysicsQueryResult> results) const;
+
         /**
          * @brief Retrieves friction, restitution and physical material of the body.
          * 
@@ -208,6 +240,15 @@ namespace nau::physics::jolt
         static void debugDrawLine(const nau::math::Point3& pos0, const nau::math::Point3& pos1,
             const nau::math::Color4& color, float time);
 
+        /**
+         * @brief Finds the rigid body component of the scene object the contacting body is attached to.
+         *
+         * @param [in] sceneManager     Scene manager to query the object if it is not cached yet.
+         * @param [in] sceneObjectUid   Uid of the scene object.
+         * @return                      The component or nullptr if the object or the component does not exist anymore.
+         */
+        RigidBodyComponent* findContactComponent(scene::ISceneManager& sceneManager, Uid sceneObjectUid);
+
     private:
         enum ContactNotificationKind
         {
@@ -247,6 +288,7 @@ namespace nau::physics::jolt
         eastl::unique_ptr<JPH::PhysicsSystem> m_joltPhysicsSystem;
         eastl::unique_ptr<JPH::TempAllocatorImpl> m_joltTempAllocator;
         eastl::unique_ptr<JPH::JobSystem> m_joltJobSystem;
+        async::Executor::Ptr m_joltJobsExecutor; /** < Dedicated executor for the simulation jobs, if configured. */
 
         IPhysicsContactListener::Ptr m_engineContactListener;
         IPhysicsMaterial::Ptr m_engineDefaultMaterial;
@@ -266,6 +308,16 @@ namespace nau::physics::jolt
 
         eastl::vector<InternalContactManifoldEntry> m_contactsData;
 
+        /**
+         * @brief Rigid body components of the contacting scene objects, so the contacts are dispatched without the scene queries.
+         *
+         * Entries whose components are destroyed are dropped lazily.
+         */
+        eastl::unordered_map<Uid, scene::ObjectWeakRef<RigidBodyComponent>> m_contactComponents;
+        size_t m_contactComponentsPurgeSize = 64;
+
+        mutable JPH::BodyIDVector m_activeBodyIds; /** < Scratch storage of getActiveBodiesTransforms. */
+
     };
 } // namespace nau::physics::jolt
 
@@ -0,0 +1,97 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "jolt_job_system.h"
+
+#include <thread>
+
+#include "nau/diag/assertion.h"
+
+namespace nau::physics::jolt
+{
+    JoltJobSystem::JoltJobSystem(async::Executor::Ptr executor, JPH::uint maxJobs, JPH::uint maxBarriers) :
+        m_executor(std::move(executor))
+    {
+        NAU_FATAL(m_executor);
+
+        JobSystemWithBarrier::Init(maxBarriers);
+        m_jobs.Init(maxJobs, maxJobs);
+
+        // The thread waiting on the barrier takes part in the execution too.
+        const size_t threadsCount = m_executor->getStatistics().threadsCount;
+        m_maxConcurrency = static_cast<int>(threadsCount > 0 ? threadsCount : std::thread::hardware_concurrency()) + 1;
+    }
+
+    JoltJobSystem::~JoltJobSystem()
+    {
+        while (m_scheduledJobsCount.load(std::memory_order_acquire) > 0)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    int JoltJobSystem::GetMaxConcurrency() const
+    {
+        return m_maxConcurrency;
+    }
+
+    JoltJobSystem::JobHandle JoltJobSystem::CreateJob(const char* inName, JPH::ColorArg inColor, const JobFunction& inJobFunction, JPH::uint32 inNumDependencies)
+    {
+        JPH::uint32 index;
+        for (;;)
+        {
+            index = m_jobs.ConstructObject(inName, inColor, this, inJobFunction, inNumDependencies);
+            if (index != AvailableJobs::cInvalidObjectIndex)
+            {
+                break;
+            }
+
+            NAU_ASSERT(false, "No Jolt jobs available");
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+
+        Job* const job = &m_jobs.Get(index);
+
+        // The handle keeps a reference: the job is queued below and may complete immediately.
+        JobHandle handle(job);
+        if (inNumDependencies == 0)
+        {
+            QueueJob(job);
+        }
+
+        return handle;
+    }
+
+    void JoltJobSystem::QueueJob(Job* inJob)
+    {
+        // The reference is released by the executor invocation.
+        inJob->AddRef();
+        m_scheduledJobsCount.fetch_add(1, std::memory_order_relaxed);
+
+        m_executor->execute([](void* jobPtr, void* selfPtr) noexcept
+        {
+            Job* const job = reinterpret_cast<Job*>(jobPtr);
+            auto& self = *reinterpret_cast<JoltJobSystem*>(selfPtr);
+
+            // Does nothing if the job has already been executed by the thread waiting on the barrier.
+            job->Execute();
+            job->Release();
+
+            self.m_scheduledJobsCount.fetch_sub(1, std::memory_order_release);
+        }, inJob, this);
+    }
+
+    void JoltJobSystem::QueueJobs(Job** inJobs, JPH::uint inNumJobs)
+    {
+        for (JPH::uint i = 0; i < inNumJobs; ++i)
+        {
+            QueueJob(inJobs[i]);
+        }
+    }
+
+    void JoltJobSystem::FreeJob(Job* inJob)
+    {
+        m_jobs.DestructObject(inJob);
+    }
+}  // namespace nau::physics::jolt
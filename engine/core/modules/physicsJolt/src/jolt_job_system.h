@@ -0,0 +1,63 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <Jolt/Jolt.h>
+#include <Jolt/Core/FixedSizeFreeList.h>
+#include <Jolt/Core/JobSystemWithBarrier.h>
+
+#include <atomic>
+
+#include "nau/async/executor.h"
+
+namespace nau::physics::jolt
+{
+    /**
+     * @brief Implements JPH::JobSystem on top of the engine executor.
+     *
+     * Each Jolt job that becomes ready is scheduled as a single executor invocation.
+     * The thread that waits on a barrier (i.e. the one calling JPH::PhysicsSystem::Update) executes the barrier's jobs as well,
+     * so the simulation makes progress even when every executor thread is busy (or the update itself runs on the executor).
+     */
+    class JoltJobSystem final : public JPH::JobSystemWithBarrier
+    {
+    public:
+        /**
+         * @brief Constructor.
+         *
+         * @param [in] executor     Executor to run the jobs on.
+         * @param [in] maxJobs      Maximum amount of jobs that can be allocated at the same time.
+         * @param [in] maxBarriers  Maximum amount of barriers that can be allocated at the same time.
+         */
+        JoltJobSystem(async::Executor::Ptr executor, JPH::uint maxJobs, JPH::uint maxBarriers);
+
+        /**
+         * @brief Destructor.
+         *
+         * Waits until the executor has released all scheduled jobs.
+         */
+        ~JoltJobSystem() override;
+
+        int GetMaxConcurrency() const override;
+
+        JobHandle CreateJob(const char* inName, JPH::ColorArg inColor, const JobFunction& inJobFunction, JPH::uint32 inNumDependencies = 0) override;
+
+    protected:
+        void QueueJob(Job* inJob) override;
+
+        void QueueJobs(Job** inJobs, JPH::uint inNumJobs) override;
+
+        void FreeJob(Job* inJob) override;
+
+    private:
+        using AvailableJobs = JPH::FixedSizeFreeList<Job>;
+
+        AvailableJobs m_jobs;
+        async::Executor::Ptr m_executor;
+        int m_maxConcurrency = 1;
+
+        std::atomic<size_t> m_scheduledJobsCount = 0; /** < Jobs passed to the executor and not yet released by it. */
+    };
+}  // namespace nau::physics::jolt
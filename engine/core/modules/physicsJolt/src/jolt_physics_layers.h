@@ -7,9 +7,13 @@
 #include "nau/physics/physics_defines.h"
 
 #include <Jolt/Jolt.h>
+#include <Jolt/Physics/Body/Body.h>
+#include <Jolt/Physics/Body/BodyFilter.h>
 #include <Jolt/Physics/Collision/BroadPhase/BroadPhaseLayer.h>
 #include <Jolt/Physics/Collision/ObjectLayer.h>
 
+#include <EASTL/algorithm.h>
+#include <EASTL/span.h>
 #include <EASTL/vector.h>
 #include <EASTL/set.h>
 
@@ -45,4 +49,45 @@ namespace nau::physics::jolt
         eastl::set<nau::physics::CollisionChannel> m_interestLayers;
     };
 
+    /**
+     * Same as DefaultRayCastChannelFilter, but does not copy the channels: used by the batched queries.
+     * Channel lists are expected to be short, so the linear search is used.
+     */
+    class QueryChannelFilter : public JPH::ObjectLayerFilter
+    {
+    public:
+        QueryChannelFilter(eastl::span<const nau::physics::CollisionChannel> interestLayers)
+            : m_interestLayers(interestLayers)
+        {
+        }
+
+        bool ShouldCollide(JPH::ObjectLayer layer) const override
+        {
+            return m_interestLayers.empty() || eastl::find(m_interestLayers.begin(), m_interestLayers.end(), layer) != m_interestLayers.end();
+        }
+
+    private:
+        eastl::span<const nau::physics::CollisionChannel> m_interestLayers;
+    };
+
+    /**
+     * Skips sensor (trigger) bodies if requested.
+     */
+    class QueryTriggersFilter : public JPH::BodyFilter
+    {
+    public:
+        QueryTriggersFilter(bool ignoreTriggers)
+            : m_ignoreTriggers(ignoreTriggers)
+        {
+        }
+
+        bool ShouldCollideLocked(const JPH::Body& body) const override
+        {
+            return !m_ignoreTriggers || !body.IsSensor();
+        }
+
+    private:
+        bool m_ignoreTriggers;
+    };
+
 }  // namespace nau::physics::jolt
@@ -0,0 +1,107 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "jolt_physics_queries.h"
+
+#include <Jolt/Physics/Collision/CastResult.h>
+#include <Jolt/Physics/Collision/CollideShape.h>
+#include <Jolt/Physics/Collision/CollisionCollectorImpl.h>
+#include <Jolt/Physics/Collision/RayCast.h>
+#include <Jolt/Physics/Collision/ShapeCast.h>
+
+#include "jolt_physics_layers.h"
+#include "nau/diag/assertion.h"
+#include "nau/physics/jolt/jolt_physics_math.h"
+
+namespace nau::physics::jolt
+{
+    namespace
+    {
+        /**
+         * The shape is swept along the whole cast: longer casts overflow the swept bounds.
+         */
+        constexpr TFloat JOLT_MAX_SHAPE_CAST_DISTANCE = 1e6;
+    }  // namespace
+
+    eastl::optional<JoltQueryHit> performJoltQuery(const JPH::NarrowPhaseQuery& narrowPhase, const PhysicsQuery& query,
+                                                   const JPH::Shape* shape, JPH::Vec3Arg scale)
+    {
+        const QueryChannelFilter channelFilter(query.reactChannels);
+        const QueryTriggersFilter triggersFilter(query.ignoreTriggers);
+
+        if (query.type == PhysicsQueryType::RayCast)
+        {
+            NAU_ASSERT(query.maxDistance > 0, "Ray cast ({}) with invalid distance", query.id);
+
+            const JPH::RRayCast ray{vec3ToJolt(query.origin), vec3ToJolt(query.maxDistance * query.direction)};
+
+            JPH::RayCastResult hit;
+            if (!narrowPhase.CastRay(ray, hit, {}, channelFilter, triggersFilter))
+            {
+                return eastl::nullopt;
+            }
+
+            return JoltQueryHit{
+                .bodyId = hit.mBodyID,
+                .subShapeId = hit.mSubShapeID2,
+                .position = ray.GetPointOnRay(hit.mFraction),
+                .distance = static_cast<float>(hit.mFraction * query.maxDistance)};
+        }
+
+        NAU_ASSERT(shape, "Shape query ({}) without a valid shape", query.id);
+        if (!shape)
+        {
+            return eastl::nullopt;
+        }
+
+        const JPH::RMat44 transform = JPH::RMat44::sRotationTranslation(quatToJolt(query.rotation), vec3ToJolt(query.origin));
+
+        // Hits are reported relative to the base offset: it keeps the precision far from the world origin.
+        const JPH::RVec3 baseOffset = transform.GetTranslation();
+
+        if (query.type == PhysicsQueryType::ShapeCast)
+        {
+            const bool validDistance = query.maxDistance > 0 && query.maxDistance <= JOLT_MAX_SHAPE_CAST_DISTANCE;
+            NAU_ASSERT(validDistance, "Shape cast ({}) distance ({}) must be in (0, {}]", query.id, query.maxDistance, JOLT_MAX_SHAPE_CAST_DISTANCE);
+            if (!validDistance)
+            {
+                return eastl::nullopt;
+            }
+
+            const JPH::RShapeCast shapeCast = JPH::RShapeCast::sFromWorldTransform(shape, scale, transform, vec3ToJolt(query.maxDistance * query.direction));
+
+            JPH::ClosestHitCollisionCollector<JPH::CastShapeCollector> collector;
+            narrowPhase.CastShape(shapeCast, JPH::ShapeCastSettings{}, baseOffset, collector, {}, channelFilter, triggersFilter);
+            if (!collector.HadHit())
+            {
+                return eastl::nullopt;
+            }
+
+            const JPH::ShapeCastResult& hit = collector.mHit;
+            return JoltQueryHit{
+                .bodyId = hit.mBodyID2,
+                .subShapeId = hit.mSubShapeID2,
+                .position = baseOffset + hit.mContactPointOn2,
+                .normal = -hit.mPenetrationAxis.NormalizedOr(JPH::Vec3::sZero()),
+                .distance = static_cast<float>(hit.mFraction * query.maxDistance)};
+        }
+
+        const JPH::RMat44 centerOfMassTransform = transform.PreTranslated(shape->GetCenterOfMass());
+
+        JPH::AnyHitCollisionCollector<JPH::CollideShapeCollector> collector;
+        narrowPhase.CollideShape(shape, scale, centerOfMassTransform, JPH::CollideShapeSettings{}, baseOffset, collector, {}, channelFilter, triggersFilter);
+        if (!collector.HadHit())
+        {
+            return eastl::nullopt;
+        }
+
+        const JPH::CollideShapeResult& hit = collector.mHit;
+        return JoltQueryHit{
+            .bodyId = hit.mBodyID2,
+            .subShapeId = hit.mSubShapeID2,
+            .position = baseOffset + hit.mContactPointOn2,
+            .normal = -hit.mPenetrationAxis.NormalizedOr(JPH::Vec3::sZero())};
+    }
+
+}  // namespace nau::physics::jolt
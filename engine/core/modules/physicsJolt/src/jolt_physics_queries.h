@@ -0,0 +1,47 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <Jolt/Jolt.h>
+#include <Jolt/Physics/Body/BodyID.h>
+#include <Jolt/Physics/Collision/NarrowPhaseQuery.h>
+#include <Jolt/Physics/Collision/Shape/SubShapeID.h>
+
+#include <EASTL/optional.h>
+
+#include "nau/physics/physics_query.h"
+
+namespace nau::physics::jolt
+{
+    /**
+     * @brief Closest hit of the single PhysicsQuery in the Jolt terms: the engine body and material are resolved by the physics world.
+     */
+    struct JoltQueryHit
+    {
+        JPH::BodyID bodyId;
+        JPH::SubShapeID subShapeId;
+        JPH::RVec3 position;
+
+        /**
+         * @brief Not set for the ray casts: the normal is taken from the hit body surface.
+         */
+        eastl::optional<JPH::Vec3> normal;
+
+        float distance = 0.f;
+    };
+
+    /**
+     * @brief Performs the single query on the calling thread.
+     *
+     * @param [in] narrowPhase  Narrow phase of the physics system that is not being updated.
+     * @param [in] query        Query to perform. PhysicsQuery::shape is ignored: the Jolt shape is passed separately.
+     * @param [in] shape        Shape of the shape cast and overlap queries, ignored by the ray casts.
+     * @param [in] scale        Scale of the shape.
+     * @return                  Closest hit (any hit for the overlap queries) or nullopt.
+     */
+    eastl::optional<JoltQueryHit> performJoltQuery(const JPH::NarrowPhaseQuery& narrowPhase, const PhysicsQuery& query,
+                                                   const JPH::Shape* shape, JPH::Vec3Arg scale);
+
+}  // namespace nau::physics::jolt
@@ -17,10 +17,15 @@
 #include <Jolt/Physics/PhysicsSystem.h>
 #include <Jolt/RegisterTypes.h>
 
+#include "jolt_job_system.h"
 #include "jolt_physics_layers.h"
+#include "jolt_physics_queries.h"
+#include "nau/app/global_properties.h"
+#include "nau/async/thread_pool_executor.h"
 #include "nau/diag/assertion.h"
 #include "nau/physics/internal/core_physics_internal.h"
 #include "nau/physics/jolt/jolt_physics_body.h"
+#include "nau/physics/jolt/jolt_physics_collider.h"
 #include "nau/physics/jolt/jolt_physics_material.h"
 #include "nau/physics/jolt/jolt_physics_math.h"
 #include "nau/scene/scene_manager.h"
@@ -32,6 +37,13 @@ namespace nau::physics::jolt
     {
         constexpr int JOLT_TEMP_ALLOC_SIZE = 1 << 20;
         constexpr int JOLT_MAX_JOBS = 32;
+        constexpr int JOLT_MAX_MULTITHREADED_JOBS = 2048;
+        constexpr int JOLT_MAX_BARRIERS = 8;
+
+        /**
+         * Minimal amount of queries executed by a single job of the batch.
+         */
+        constexpr size_t JOLT_MIN_QUERIES_PER_JOB = 32;
 
         constexpr int JOLT_SETTING_MAX_BODIES = 16384;
         constexpr int JOLT_SETTING_NUM_BODY_MUTEXES = 32;
@@ -46,6 +58,70 @@ namespace nau::physics::jolt
         constexpr unsigned JOLT_SETTING_OBJECT_LAYERS_COUNTS = 1000;
 
         static const JPH::Vec3 gravityAcceleration{.0f, -9.81f, .0f};
+
+        struct JoltPhysicsConfig
+        {
+            // -1: jobs run on the engine default executor, 0: single threaded simulation, N: dedicated pool of N threads.
+            int jobThreadsCount = -1;
+
+            NAU_CLASS_FIELDS(
+                CLASS_FIELD(jobThreadsCount))
+        };
+
+        JoltPhysicsConfig getJoltPhysicsConfig()
+        {
+            if (GlobalProperties* const properties = getServiceProvider().find<GlobalProperties>())
+            {
+                return properties->getValue<JoltPhysicsConfig>("/physics").value_or(JoltPhysicsConfig{});
+            }
+
+            return {};
+        }
+
+        void fillQueryResult(const JPH::BodyLockInterface& bodyLocks, const JoltQueryHit& hit, PhysicsQueryResult& result)
+        {
+            JPH::BodyLockRead lock(bodyLocks, hit.bodyId);
+            if (!lock.Succeeded())
+            {
+                return;
+            }
+
+            const JPH::Body& hitBody = lock.GetBody();
+            const auto* const hitMaterial = static_cast<const JoltPhysicsMaterial*>(hitBody.GetShape()->GetMaterial(hit.subShapeId));
+            const auto& joltBody = *reinterpret_cast<const JoltPhysicsBody*>(hitBody.GetUserData());
+
+            result.sceneObjectUid = joltBody.getSceneObjectUid();
+            result.material = hitMaterial->engineMaterial();
+            result.position = joltVec3ToNauVec3(hit.position);
+            result.normal = joltVec3ToNauVec3(hit.normal ? *hit.normal : hitBody.GetWorldSpaceSurfaceNormal(hit.subShapeId, hit.position));
+            result.distance = hit.distance;
+        }
+
+        /**
+         * Performs the queries one by one on the calling thread.
+         */
+        void performQueriesRange(const JPH::PhysicsSystem& physicsSystem, eastl::span<const PhysicsQuery> queries, eastl::span<PhysicsQueryResult> results)
+        {
+            // using NoLock API, because we known that tick is not performed
+            const JPH::NarrowPhaseQuery& narrowPhase = physicsSystem.GetNarrowPhaseQueryNoLock();
+            const JPH::BodyLockInterface& bodyLocks = physicsSystem.GetBodyLockInterfaceNoLock();
+
+            for (size_t i = 0; i < queries.size(); ++i)
+            {
+                const PhysicsQuery& query = queries[i];
+                PhysicsQueryResult& result = results[i];
+                result = PhysicsQueryResult{.queryId = query.id};
+
+                const JoltCollisionShape* const shape = query.type != PhysicsQueryType::RayCast && query.shape ? query.shape->as<const JoltCollisionShape*>() : nullptr;
+                const JPH::RefConst<JPH::Shape> joltShape = shape ? shape->getCollisionShape() : nullptr;
+                const JPH::Vec3 scale = shape ? vec3ToJolt(query.shape->getShapeTransform().getScale()) : JPH::Vec3::sReplicate(1.f);
+
+                if (const eastl::optional<JoltQueryHit> hit = performJoltQuery(narrowPhase, query, joltShape.GetPtr(), scale))
+                {
+                    fillQueryResult(bodyLocks, *hit, result);
+                }
+            }
+        }
     };  // namespace
 
     JoltPhysicsWorld::JoltPhysicsWorld()
@@ -72,7 +148,24 @@ namespace nau::physics::jolt
         m_joltDebugRender = eastl::make_unique<DebugRendererImp>();
 
         m_joltPhysicsSystem = eastl::make_unique<JPH::PhysicsSystem>();
-        m_joltJobSystem = eastl::make_unique<JPH::JobSystemSingleThreaded>(JOLT_MAX_JOBS);
+        const JoltPhysicsConfig config = getJoltPhysicsConfig();
+        if (config.jobThreadsCount > 0)
+        {
+            m_joltJobsExecutor = async::createWorkStealingThreadPoolExecutor(static_cast<size_t>(config.jobThreadsCount));
+        }
+        else if (config.jobThreadsCount < 0)
+        {
+            m_joltJobsExecutor = async::Executor::getDefault();
+        }
+
+        if (m_joltJobsExecutor)
+        {
+            m_joltJobSystem = eastl::make_unique<JoltJobSystem>(m_joltJobsExecutor, JOLT_MAX_MULTITHREADED_JOBS, JOLT_MAX_BARRIERS);
+        }
+        else
+        {
+            m_joltJobSystem = eastl::make_unique<JPH::JobSystemSingleThreaded>(JOLT_MAX_JOBS);
+        }
         m_joltTempAllocator = eastl::make_unique<JPH::TempAllocatorImpl>(JOLT_TEMP_ALLOC_SIZE);
 
         m_joltPhysicsSystem->Init(
@@ -91,6 +184,10 @@ namespace nau::physics::jolt
 
     JoltPhysicsWorld::~JoltPhysicsWorld()
     {
+        // All jobs scheduled on the executor are released by the job system destructor.
+        m_joltJobSystem.reset();
+        m_joltJobsExecutor.reset();
+
         // Unregisters all types with the factory and cleans up the default material
         JPH::UnregisterTypes();
     }
@@ -197,79 +294,55 @@ namespace nau::physics::jolt
 
     async::Task<eastl::vector<RayCastResult>> JoltPhysicsWorld::castRaysAsync(eastl::vector<physics::RayCastQuery> queries) const
     {
-        using namespace nau::async;
         using namespace nau::scene;
 
-        auto performCastsOnPhysicsExecutor = [](const JoltPhysicsWorld& self, const decltype(queries)& queries) -> Task<eastl::vector<RayCastResult>>
-        {
-            const auto FailureDebugColor = math::Color4(1.0, 0.0, 0.0);
-            const auto SuccessDebugColor = math::Color4(0.0, 1.0, 0.0);
-
-            auto& corePhysics = getServiceProvider().get<ICorePhysicsInternal>();
-            co_await corePhysics.getExecutor();
-
-            eastl::vector<RayCastResult> castResults;
-            castResults.reserve(queries.size());
-
-            for (const physics::RayCastQuery& query : queries)
-            {
-                RayCastResult& result = castResults.emplace_back();
-                result.queryId = query.id;
-
-                const JPH::RRayCast ray{vec3ToJolt(query.origin), vec3ToJolt(query.maxDistance * query.direction)};
-
-                const math::Point3 debugRayStart{query.origin.get128()};
-                const math::Point3 debugRayEnd = debugRayStart + query.direction * query.maxDistance;
+        const auto FailureDebugColor = math::Color4(1.0, 0.0, 0.0);
+        const auto SuccessDebugColor = math::Color4(0.0, 1.0, 0.0);
 
-                JPH::RayCastResult hit;
-                const DefaultRayCastChannelFilter channelFilter(query.reactChannels);
-
-                // using NoLock API, because we known that tick is not performed
-                if (!self.m_joltPhysicsSystem->GetNarrowPhaseQueryNoLock().CastRay(ray, hit, {}, channelFilter))
-                {
-                    debugDrawLine(debugRayStart, debugRayEnd, FailureDebugColor, query.debugDrawDuration);
-                    continue;
-                }
-
-                // using NoLock API, because we known that tick is not performed
-                JPH::BodyLockRead lock(self.m_joltPhysicsSystem->GetBodyLockInterfaceNoLock(), hit.mBodyID);
-                if (!lock.Succeeded())
-                {
-                    debugDrawLine(debugRayStart, debugRayEnd, FailureDebugColor, query.debugDrawDuration);
-                    continue;
-                }
-
-                const JPH::Body& hitBody = lock.GetBody();
-
-                const JPH::PhysicsMaterial* hitMaterial = hitBody.GetShape()->GetMaterial(hit.mSubShapeID2);
-                const JPH::Vec3 hitPosition = ray.GetPointOnRay(hit.mFraction);
-                const JPH::Vec3 normal = hitBody.GetWorldSpaceSurfaceNormal(hit.mSubShapeID2, hitPosition);
-
-                auto& joltBody = *reinterpret_cast<JoltPhysicsBody*>(hitBody.GetUserData());
+        eastl::vector<PhysicsQuery> batch;
+        batch.reserve(queries.size());
+        for (const physics::RayCastQuery& query : queries)
+        {
+            batch.push_back({
+                .id = query.id,
+                .type = PhysicsQueryType::RayCast,
+                .origin = query.origin,
+                .direction = query.direction,
+                .maxDistance = query.maxDistance,
+                .reactChannels = query.reactChannels,
+                .ignoreTriggers = query.ignoreTriggers});
+        }
 
-                result.position = jolt::joltVec3ToNauVec3(hitPosition),
-                result.normal = jolt::joltVec3ToNauVec3(normal);
-                result.sceneObjectUid = joltBody.getSceneObjectUid();
-                result.material = static_cast<const JoltPhysicsMaterial*>(hitMaterial)->engineMaterial();
+        eastl::vector<PhysicsQueryResult> batchResults(queries.size());
+        co_await castQueriesAsync(batch, batchResults);
 
-                debugDrawLine(debugRayStart, math::Point3(result.position.get128()), SuccessDebugColor, query.debugDrawDuration);
-            }
+        ISceneManager& sceneManger = getServiceProvider().get<ISceneManager>();
 
-            co_return castResults;
-        };
+        eastl::vector<RayCastResult> castResults;
+        castResults.reserve(queries.size());
 
-        auto castResults = co_await performCastsOnPhysicsExecutor(*this, queries);
-        NAU_ASSERT(castResults.size() == queries.size());
+        for (size_t i = 0; i < queries.size(); ++i)
+        {
+            const physics::RayCastQuery& query = queries[i];
+            PhysicsQueryResult& hit = batchResults[i];
 
-        ISceneManager& sceneManger = getServiceProvider().get<ISceneManager>();
+            RayCastResult& result = castResults.emplace_back();
+            result.queryId = query.id;
 
-        for (RayCastResult& result : castResults)
-        {
-            if (result.sceneObjectUid == NullUid)
+            const math::Point3 debugRayStart{query.origin.get128()};
+            if (!hit.hasHit())
             {
+                debugDrawLine(debugRayStart, debugRayStart + query.direction * query.maxDistance, FailureDebugColor, query.debugDrawDuration);
                 continue;
             }
 
+            result.sceneObjectUid = hit.sceneObjectUid;
+            result.material = std::move(hit.material);
+            result.position = hit.position;
+            result.normal = hit.normal;
+
+            debugDrawLine(debugRayStart, math::Point3(result.position.get128()), SuccessDebugColor, query.debugDrawDuration);
+
             ObjectWeakRef<> object = sceneManger.querySingleObject({QueryObjectCategory::Object, result.sceneObjectUid});
             if (object)
             {
@@ -292,6 +365,48 @@ namespace nau::physics::jolt
         co_return castResults;
     }
 
+    async::Task<> JoltPhysicsWorld::castQueriesAsync(eastl::span<const PhysicsQuery> queries, eastl::span<PhysicsQueryResult> results) const
+    {
+        NAU_ASSERT(results.size() >= queries.size());
+
+        auto& corePhysics = getServiceProvider().get<ICorePhysicsInternal>();
+        co_await corePhysics.getExecutor();
+
+        performQueries(queries, results);
+    }
+
+    void JoltPhysicsWorld::performQueries(eastl::span<const PhysicsQuery> queries, eastl::span<PhysicsQueryResult> results) const
+    {
+        const size_t queriesCount = eastl::min(queries.size(), results.size());
+        const size_t workersCount = static_cast<size_t>(eastl::max(m_joltJobSystem->GetMaxConcurrency(), 1));
+
+        if (workersCount == 1 || queriesCount <= JOLT_MIN_QUERIES_PER_JOB)
+        {
+            performQueriesRange(*m_joltPhysicsSystem, queries.first(queriesCount), results.first(queriesCount));
+            return;
+        }
+
+        // A few jobs per worker: the cost of the queries varies a lot, so it helps to balance the load.
+        const size_t jobsCount = workersCount * 4;
+        const size_t queriesPerJob = eastl::max((queriesCount + jobsCount - 1) / jobsCount, JOLT_MIN_QUERIES_PER_JOB);
+
+        JPH::JobSystem::Barrier* const barrier = m_joltJobSystem->CreateBarrier();
+        for (size_t begin = 0; begin < queriesCount; begin += queriesPerJob)
+        {
+            const size_t count = eastl::min(queriesPerJob, queriesCount - begin);
+            JPH::JobHandle job = m_joltJobSystem->CreateJob("PhysicsQueries", JPH::Color::sCyan,
+                                                            [this, jobQueries = queries.subspan(begin, count), jobResults = results.subspan(begin, count)]
+            {
+                performQueriesRange(*m_joltPhysicsSystem, jobQueries, jobResults);
+            });
+
+            barrier->AddJob(job);
+        }
+
+        m_joltJobSystem->WaitForJobs(barrier);
+        m_joltJobSystem->DestroyBarrier(barrier);
+    }
+
     void JoltPhysicsWorld::drawDebug(nau::DebugRenderSystem& dr)
     {
         m_joltDebugRender->setDebugRenderer(&dr);
@@ -306,6 +421,34 @@ namespace nau::physics::jolt
         m_joltPhysicsSystem->SetGravity(vec3ToJolt(gravity));
     }
 
+    void JoltPhysicsWorld::getActiveBodiesTransforms(eastl::vector<PhysicsBodyTransform>& transforms) const
+    {
+        transforms.clear();
+
+        m_joltPhysicsSystem->GetActiveBodies(JPH::EBodyType::RigidBody, m_activeBodyIds);
+        transforms.reserve(m_activeBodyIds.size());
+
+        // using NoLock API, because we known that tick is not performed
+        const JPH::BodyLockInterface& bodyLocks = m_joltPhysicsSystem->GetBodyLockInterfaceNoLock();
+        for (const JPH::BodyID& bodyId : m_activeBodyIds)
+        {
+            JPH::BodyLockRead lock(bodyLocks, bodyId);
+            if (!lock.Succeeded())
+            {
+                continue;
+            }
+
+            const JPH::Body& body = lock.GetBody();
+            if (auto* const joltBody = reinterpret_cast<JoltPhysicsBody*>(body.GetUserData()))
+            {
+                transforms.push_back({
+                    .body = joltBody,
+                    .position = joltVec3ToNauVec3(body.GetPosition()),
+                    .rotation = math::quat{joltVec4ToNauVec4(body.GetRotation().GetXYZW())}});
+            }
+        }
+    }
+
     void JoltPhysicsWorld::OnContactAdded(const JPH::Body& body1, const JPH::Body& body2, const JPH::ContactManifold& manifold, JPH::ContactSettings& settings)
     {
         handleBodiesContact(body1, body2, manifold, settings);
@@ -469,6 +612,38 @@ namespace nau::physics::jolt
                                  reinterpret_cast<const JoltPhysicsMaterial*>(JPH::PhysicsMaterial::sDefault.GetPtr()));
     }
 
+    RigidBodyComponent* JoltPhysicsWorld::findContactComponent(scene::ISceneManager& sceneManager, Uid sceneObjectUid)
+    {
+        using namespace nau::scene;
+
+        if (auto iter = m_contactComponents.find(sceneObjectUid); iter != m_contactComponents.end())
+        {
+            if (iter->second)
+            {
+                return iter->second.get();
+            }
+
+            // The component has been destroyed: the object can be recreated with the same uid, so query it again.
+            m_contactComponents.erase(iter);
+        }
+
+        ObjectWeakRef<> object = sceneManager.querySingleObject({QueryObjectCategory::Object, sceneObjectUid});
+        if (!object)
+        {
+            return nullptr;
+        }
+
+        RigidBodyComponent* const component = object->as<SceneObject&>().findFirstComponent<RigidBodyComponent>();
+        if (!component)
+        {
+            NAU_LOG_WARNING("Contact notification, but rigid body does not exists:({})", object->as<SceneObject&>().getName());
+            return nullptr;
+        }
+
+        m_contactComponents.emplace(sceneObjectUid, *component);
+        return component;
+    }
+
     void JoltPhysicsWorld::syncSceneState()
     {
         using namespace nau::scene;
@@ -482,27 +657,22 @@ namespace nau::physics::jolt
 
             ISceneManager& sceneManager = getServiceProvider().get<ISceneManager>();
 
-            for (InternalContactManifoldEntry& contact : m_contactsData)
+            // Objects that stop contacting are never looked up again: drop their destroyed components from time to time.
+            if (m_contactComponents.size() >= m_contactComponentsPurgeSize)
             {
-                ObjectWeakRef<> object1 = sceneManager.querySingleObject({QueryObjectCategory::Object, contact.object1.sceneObjectUid});
-                ObjectWeakRef<> object2 = sceneManager.querySingleObject({QueryObjectCategory::Object, contact.object2.sceneObjectUid});
-
-                if (!object1 || !object2)
+                for (auto iter = m_contactComponents.begin(); iter != m_contactComponents.end();)
                 {
-                    continue;
-                }
-
-                RigidBodyComponent* const rb1 = object1->as<SceneObject&>().findFirstComponent<RigidBodyComponent>();
-                if (!rb1)
-                {
-                    NAU_LOG_WARNING("Contact notification, but rigid body does not exists:({})", object1->as<SceneObject&>().getName());
-                    continue;
+                    iter = iter->second ? eastl::next(iter) : m_contactComponents.erase(iter);
                 }
+                m_contactComponentsPurgeSize = eastl::max<size_t>(m_contactComponents.size() * 2, 64);
+            }
 
-                RigidBodyComponent* const rb2 = object1->as<SceneObject&>().findFirstComponent<RigidBodyComponent>();
-                if (!rb2)
+            for (InternalContactManifoldEntry& contact : m_contactsData)
+            {
+                RigidBodyComponent* const rb1 = findContactComponent(sceneManager, contact.object1.sceneObjectUid);
+                RigidBodyComponent* const rb2 = findContactComponent(sceneManager, contact.object2.sceneObjectUid);
+                if (!rb1 || !rb2)
                 {
-                    NAU_LOG_WARNING("Contact notification, but rigid body does not exists:({})", object2->as<SceneObject&>().getName());
                     continue;
                 }
 
@@ -0,0 +1,130 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include <Jolt/Jolt.h>
+#include <Jolt/Core/JobSystem.h>
+#include <Jolt/Core/TempAllocator.h>
+#include <Jolt/Physics/Body/BodyCreationSettings.h>
+#include <Jolt/Physics/Collision/BroadPhase/BroadPhaseLayerInterfaceTable.h>
+#include <Jolt/Physics/Collision/BroadPhase/ObjectVsBroadPhaseLayerFilterTable.h>
+#include <Jolt/Physics/Collision/ObjectLayerPairFilterTable.h>
+#include <Jolt/Physics/Collision/Shape/BoxShape.h>
+#include <Jolt/Physics/PhysicsSystem.h>
+
+#include <EASTL/unique_ptr.h>
+#include <EASTL/vector.h>
+
+#include <cmath>
+
+namespace nau::test
+{
+    inline constexpr JPH::ObjectLayer StaticLayer = 0;
+    inline constexpr JPH::ObjectLayer MovingLayer = 1;
+    inline constexpr JPH::uint LayersCount = 2;
+
+    struct JoltBodyState
+    {
+        JPH::RVec3 position;
+        JPH::Quat rotation;
+        JPH::Vec3 linearVelocity;
+        JPH::Vec3 angularVelocity;
+
+        bool operator==(const JoltBodyState&) const = default;
+    };
+
+    /**
+     * @brief Headless Jolt world: a floor and a grid of falling boxes.
+     */
+    class JoltBoxesWorld
+    {
+    public:
+        JoltBoxesWorld(JPH::uint bodiesCount) :
+            m_layerPairFilter(LayersCount),
+            m_broadPhaseLayerInterface(LayersCount, LayersCount),
+            m_tempAllocator(64 * 1024 * 1024)
+        {
+            m_layerPairFilter.EnableCollision(StaticLayer, MovingLayer);
+            m_layerPairFilter.EnableCollision(MovingLayer, MovingLayer);
+            m_broadPhaseLayerInterface.MapObjectToBroadPhaseLayer(StaticLayer, JPH::BroadPhaseLayer(0));
+            m_broadPhaseLayerInterface.MapObjectToBroadPhaseLayer(MovingLayer, JPH::BroadPhaseLayer(1));
+
+            // The table is filled from the layers mapping on construction.
+            m_objectVsBroadPhaseFilter = eastl::make_unique<JPH::ObjectVsBroadPhaseLayerFilterTable>(
+                m_broadPhaseLayerInterface, LayersCount, m_layerPairFilter, LayersCount);
+
+            m_physicsSystem.Init(bodiesCount + 1, 0, 1 << 16, 1 << 16, m_broadPhaseLayerInterface, *m_objectVsBroadPhaseFilter, m_layerPairFilter);
+
+            JPH::BodyInterface& bodies = m_physicsSystem.GetBodyInterface();
+            bodies.CreateAndAddBody(JPH::BodyCreationSettings(new JPH::BoxShape(JPH::Vec3(500.f, 1.f, 500.f)), JPH::RVec3(0.f, -1.f, 0.f),
+                                                              JPH::Quat::sIdentity(), JPH::EMotionType::Static, StaticLayer),
+                                    JPH::EActivation::DontActivate);
+
+            const JPH::RefConst<JPH::Shape> boxShape = new JPH::BoxShape(JPH::Vec3::sReplicate(0.5f));
+            const JPH::uint side = static_cast<JPH::uint>(std::ceil(std::sqrt(bodiesCount / 4.f)));
+            for (JPH::uint i = 0; i < bodiesCount; ++i)
+            {
+                const JPH::uint layer = i / (side * side);
+                const JPH::uint x = i % side;
+                const JPH::uint z = (i / side) % side;
+                const JPH::RVec3 position(static_cast<float>(x) * 1.5f - side * 0.75f, 1.f + static_cast<float>(layer) * 1.2f,
+                                          static_cast<float>(z) * 1.5f - side * 0.75f);
+
+                m_boxes.push_back(bodies.CreateAndAddBody(JPH::BodyCreationSettings(boxShape, position, JPH::Quat::sIdentity(), JPH::EMotionType::Dynamic, MovingLayer),
+                                                          JPH::EActivation::Activate));
+            }
+
+            m_physicsSystem.OptimizeBroadPhase();
+        }
+
+        void step(JPH::JobSystem& jobSystem, float dt = 1.f / 60.f)
+        {
+            m_physicsSystem.Update(dt, 1, &m_tempAllocator, &jobSystem);
+        }
+
+        JPH::uint getActiveBodiesCount() const
+        {
+            return m_physicsSystem.GetNumActiveBodies(JPH::EBodyType::RigidBody);
+        }
+
+        eastl::vector<JPH::RVec3> getBoxPositions() const
+        {
+            const JPH::BodyInterface& bodies = m_physicsSystem.GetBodyInterface();
+
+            eastl::vector<JPH::RVec3> positions;
+            positions.reserve(m_boxes.size());
+            for (const JPH::BodyID box : m_boxes)
+            {
+                positions.push_back(bodies.GetCenterOfMassPosition(box));
+            }
+            return positions;
+        }
+
+        eastl::vector<JoltBodyState> getBoxStates() const
+        {
+            const JPH::BodyInterface& bodies = m_physicsSystem.GetBodyInterface();
+
+            eastl::vector<JoltBodyState> states;
+            states.reserve(m_boxes.size());
+            for (const JPH::BodyID box : m_boxes)
+            {
+                states.push_back({
+                    .position = bodies.GetCenterOfMassPosition(box),
+                    .rotation = bodies.GetRotation(box),
+                    .linearVelocity = bodies.GetLinearVelocity(box),
+                    .angularVelocity = bodies.GetAngularVelocity(box)});
+            }
+            return states;
+        }
+
+    private:
+        JPH::ObjectLayerPairFilterTable m_layerPairFilter;
+        JPH::BroadPhaseLayerInterfaceTable m_broadPhaseLayerInterface;
+        eastl::unique_ptr<JPH::ObjectVsBroadPhaseLayerFilterTable> m_objectVsBroadPhaseFilter;
+        JPH::TempAllocatorImpl m_tempAllocator;
+        JPH::PhysicsSystem m_physicsSystem;
+        eastl::vector<JPH::BodyID> m_boxes;
+    };
+}  // namespace nau::test
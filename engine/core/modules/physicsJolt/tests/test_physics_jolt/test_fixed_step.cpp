@@ -0,0 +1,137 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include <Jolt/Core/Factory.h>
+#include <Jolt/Core/Memory.h>
+#include <Jolt/RegisterTypes.h>
+
+#include "jolt_boxes_world.h"
+#include "jolt_job_system.h"
+#include "nau/async/thread_pool_executor.h"
+#include "nau/physics/internal/fixed_step_accumulator.h"
+
+namespace nau::test
+{
+    namespace
+    {
+        // Binary fractions of a second: the accumulated time is exact, so the steps count does not depend on the rounding.
+        constexpr float FixedStep = 1.f / 64.f;
+        constexpr uint32_t MaxStepsCount = 4;
+
+        class TestFixedStep : public testing::Test
+        {
+        protected:
+            static void SetUpTestSuite()
+            {
+                JPH::RegisterDefaultAllocator();
+                JPH::Factory::sInstance = new JPH::Factory;
+                JPH::RegisterTypes();
+            }
+
+            static void TearDownTestSuite()
+            {
+                JPH::UnregisterTypes();
+                delete JPH::Factory::sInstance;
+                JPH::Factory::sInstance = nullptr;
+            }
+
+            /**
+             * Steps the world with the fixed step through the accumulator, as PhysicsService does.
+             */
+            static eastl::vector<JoltBodyState> simulate(eastl::span<const double> frameDeltas, size_t framesCount, uint32_t& stepsCount)
+            {
+                async::Executor::Ptr executor = async::createWorkStealingThreadPoolExecutor(4);
+                eastl::vector<JoltBodyState> states;
+                {
+                    physics::jolt::JoltJobSystem jobSystem(executor, 2048, 8);
+                    physics::FixedStepAccumulator accumulator{FixedStep, MaxStepsCount};
+                    JoltBoxesWorld world(500);
+
+                    stepsCount = 0;
+                    for (size_t frame = 0; frame < framesCount; ++frame)
+                    {
+                        const uint32_t frameStepsCount = accumulator.advance(frameDeltas[frame % frameDeltas.size()]);
+                        for (uint32_t step = 0; step < frameStepsCount; ++step)
+                        {
+                            world.step(jobSystem, accumulator.getFixedStep());
+                        }
+
+                        stepsCount += frameStepsCount;
+                    }
+
+                    states = world.getBoxStates();
+                }
+
+                using namespace std::chrono_literals;
+                EXPECT_TRUE(executor->waitAnyActivityFor(5s));
+
+                return states;
+            }
+        };
+    }  // namespace
+
+    /**
+        The accumulator carries over the time that is not enough for the whole step (it is the interpolation alpha)
+        and drops the time beyond the steps limit.
+    */
+    TEST_F(TestFixedStep, InterpolationAlpha)
+    {
+        physics::FixedStepAccumulator accumulator{FixedStep, MaxStepsCount};
+        ASSERT_TRUE(accumulator.isEnabled());
+        ASSERT_EQ(accumulator.getInterpolationAlpha(), 0.f);
+
+        ASSERT_EQ(accumulator.advance(FixedStep / 2.0), 0u);
+        ASSERT_EQ(accumulator.getInterpolationAlpha(), 0.5f);
+
+        ASSERT_EQ(accumulator.advance(FixedStep / 4.0), 0u);
+        ASSERT_EQ(accumulator.getInterpolationAlpha(), 0.75f);
+
+        ASSERT_EQ(accumulator.advance(FixedStep / 4.0), 1u);
+        ASSERT_EQ(accumulator.getInterpolationAlpha(), 0.f);
+
+        ASSERT_EQ(accumulator.advance(FixedStep * 1.5), 1u);
+        ASSERT_EQ(accumulator.getInterpolationAlpha(), 0.5f);
+
+        // a long frame: the steps are capped and the rest of the time is dropped
+        ASSERT_EQ(accumulator.advance(1.0), MaxStepsCount);
+        ASSERT_EQ(accumulator.getInterpolationAlpha(), 0.f);
+
+        ASSERT_EQ(accumulator.advance(FixedStep * 0.25), 0u);
+        ASSERT_EQ(accumulator.getInterpolationAlpha(), 0.25f);
+
+        const physics::FixedStepAccumulator disabled;
+        ASSERT_FALSE(disabled.isEnabled());
+        ASSERT_EQ(disabled.getInterpolationAlpha(), 1.f);
+    }
+
+    /**
+        The same inputs stepped twice give the same body states, and with the fixed step the states do not depend on the frame rate.
+    */
+    TEST_F(TestFixedStep, Determinism)
+    {
+        constexpr uint32_t ExpectedStepsCount = 64;
+
+        const double regularFrames[] = {FixedStep};
+        // sums up to 4 steps, the longest frame is within the steps limit
+        const double irregularFrames[] = {FixedStep / 2.0, FixedStep * 1.5, FixedStep / 4.0, FixedStep * 1.75};
+
+        uint32_t stepsCount = 0;
+        const eastl::vector<JoltBodyState> expectedStates = simulate(regularFrames, ExpectedStepsCount, stepsCount);
+        ASSERT_EQ(stepsCount, ExpectedStepsCount);
+
+        const eastl::vector<JoltBodyState> repeatedStates = simulate(regularFrames, ExpectedStepsCount, stepsCount);
+        ASSERT_EQ(stepsCount, ExpectedStepsCount);
+
+        const eastl::vector<JoltBodyState> irregularStates = simulate(irregularFrames, ExpectedStepsCount, stepsCount);
+        ASSERT_EQ(stepsCount, ExpectedStepsCount);
+
+        ASSERT_EQ(repeatedStates.size(), expectedStates.size());
+        ASSERT_EQ(irregularStates.size(), expectedStates.size());
+        for (size_t i = 0; i < expectedStates.size(); ++i)
+        {
+            ASSERT_TRUE(repeatedStates[i] == expectedStates[i]) << "box: " << i;
+            ASSERT_TRUE(irregularStates[i] == expectedStates[i]) << "box: " << i;
+        }
+    }
+}  // namespace nau::test
@@ -0,0 +1,136 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include <Jolt/Core/Factory.h>
+#include <Jolt/Core/JobSystemSingleThreaded.h>
+#include <Jolt/Core/Memory.h>
+#include <Jolt/RegisterTypes.h>
+
+#include "jolt_boxes_world.h"
+#include "jolt_job_system.h"
+#include "nau/async/thread_pool_executor.h"
+
+namespace nau::test
+{
+    namespace
+    {
+        constexpr JPH::uint MaxJobs = 2048;
+        constexpr JPH::uint MaxBarriers = 8;
+
+        class TestJoltJobSystem : public testing::Test
+        {
+        protected:
+            static void SetUpTestSuite()
+            {
+                JPH::RegisterDefaultAllocator();
+                JPH::Factory::sInstance = new JPH::Factory;
+                JPH::RegisterTypes();
+            }
+
+            static void TearDownTestSuite()
+            {
+                JPH::UnregisterTypes();
+                delete JPH::Factory::sInstance;
+                JPH::Factory::sInstance = nullptr;
+            }
+        };
+    }  // namespace
+
+    /**
+        Jolt jobs (including the dependent ones) are executed on the executor and the barrier completes.
+    */
+    TEST_F(TestJoltJobSystem, JobsWithDependencies)
+    {
+        constexpr size_t JobsCount = 1000;
+
+        async::Executor::Ptr executor = async::createWorkStealingThreadPoolExecutor(4);
+        {
+            physics::jolt::JoltJobSystem jobSystem(executor, MaxJobs, MaxBarriers);
+            ASSERT_EQ(jobSystem.GetMaxConcurrency(), 5);
+
+            std::atomic<size_t> counter = 0;
+            std::atomic<size_t> counterBeforeFinalJob = 0;
+
+            JPH::JobSystem::Barrier* const barrier = jobSystem.CreateBarrier();
+
+            JPH::JobHandle finalJob = jobSystem.CreateJob("Final", JPH::Color::sRed, [&]
+            {
+                counterBeforeFinalJob = counter.load();
+            }, static_cast<JPH::uint32>(JobsCount));
+            barrier->AddJob(finalJob);
+
+            for (size_t i = 0; i < JobsCount; ++i)
+            {
+                JPH::JobHandle job = jobSystem.CreateJob("Increment", JPH::Color::sGreen, [&counter, finalJob]() mutable
+                {
+                    counter.fetch_add(1);
+                    finalJob.RemoveDependency();
+                });
+                barrier->AddJob(job);
+            }
+
+            jobSystem.WaitForJobs(barrier);
+            jobSystem.DestroyBarrier(barrier);
+
+            ASSERT_EQ(counter.load(), JobsCount);
+            ASSERT_EQ(counterBeforeFinalJob.load(), JobsCount);
+        }
+
+        using namespace std::chrono_literals;
+        ASSERT_TRUE(executor->waitAnyActivityFor(5s));
+    }
+
+    /**
+        Steps the same world with the single threaded Jolt job system and with the executor backed one for the growing amount of threads:
+        Jolt simulation does not depend on the amount of threads, so the results must be the same.
+    */
+    TEST_F(TestJoltJobSystem, StepMatchesSingleThreaded)
+    {
+        constexpr JPH::uint BodiesCount = 2000;
+        constexpr size_t StepsCount = 60;
+
+        auto simulate = [&](JPH::JobSystem& jobSystem)
+        {
+            JoltBoxesWorld world(BodiesCount);
+            for (size_t i = 0; i < StepsCount; ++i)
+            {
+                world.step(jobSystem);
+            }
+
+            EXPECT_GT(world.getActiveBodiesCount(), 0);
+            return world.getBoxPositions();
+        };
+
+        eastl::vector<JPH::RVec3> expectedPositions;
+        {
+            JPH::JobSystemSingleThreaded jobSystem(MaxJobs);
+            expectedPositions = simulate(jobSystem);
+        }
+
+        // Boxes are falling on the floor and must not pass through it.
+        for (const JPH::RVec3& position : expectedPositions)
+        {
+            ASSERT_GT(position.GetY(), 0.f);
+        }
+
+        const size_t maxThreadsCount = std::max<size_t>(std::thread::hardware_concurrency(), 2);
+        for (size_t threadsCount = 1; threadsCount <= maxThreadsCount; threadsCount *= 2)
+        {
+            async::Executor::Ptr executor = async::createWorkStealingThreadPoolExecutor(threadsCount);
+            {
+                physics::jolt::JoltJobSystem jobSystem(executor, MaxJobs, MaxBarriers);
+                const eastl::vector<JPH::RVec3> positions = simulate(jobSystem);
+
+                ASSERT_EQ(positions.size(), expectedPositions.size());
+                for (size_t i = 0; i < positions.size(); ++i)
+                {
+                    ASSERT_TRUE(positions[i] == expectedPositions[i]) << "threads: " << threadsCount << ", box: " << i;
+                }
+            }
+
+            using namespace std::chrono_literals;
+            ASSERT_TRUE(executor->waitAnyActivityFor(5s));
+        }
+    }
+}  // namespace nau::test
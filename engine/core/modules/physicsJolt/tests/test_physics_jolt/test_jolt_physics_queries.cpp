@@ -0,0 +1,245 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include <Jolt/Core/Factory.h>
+#include <Jolt/Core/Memory.h>
+#include <Jolt/Physics/Body/BodyCreationSettings.h>
+#include <Jolt/Physics/Collision/BroadPhase/BroadPhaseLayerInterfaceTable.h>
+#include <Jolt/Physics/Collision/BroadPhase/ObjectVsBroadPhaseLayerFilterTable.h>
+#include <Jolt/Physics/Collision/ObjectLayerPairFilterTable.h>
+#include <Jolt/Physics/Collision/Shape/BoxShape.h>
+#include <Jolt/Physics/Collision/Shape/SphereShape.h>
+#include <Jolt/Physics/PhysicsSystem.h>
+#include <Jolt/RegisterTypes.h>
+
+#include "jolt_physics_queries.h"
+
+namespace nau::test
+{
+    namespace
+    {
+        constexpr JPH::ObjectLayer FloorLayer = 0;
+        constexpr JPH::ObjectLayer BoxesLayer = 1;
+        constexpr JPH::uint LayersCount = 2;
+
+        constexpr float Tolerance = 1e-3f;
+
+        /**
+         * @brief Headless Jolt world: a floor (top at y = 0), a box at z = -5 and a trigger box at x = 5, all boxes have 0.5 half extent.
+         */
+        class JoltQueriesWorld
+        {
+        public:
+            JoltQueriesWorld() :
+                m_layerPairFilter(LayersCount),
+                m_broadPhaseLayerInterface(LayersCount, LayersCount)
+            {
+                m_broadPhaseLayerInterface.MapObjectToBroadPhaseLayer(FloorLayer, JPH::BroadPhaseLayer(0));
+                m_broadPhaseLayerInterface.MapObjectToBroadPhaseLayer(BoxesLayer, JPH::BroadPhaseLayer(1));
+
+                m_objectVsBroadPhaseFilter = eastl::make_unique<JPH::ObjectVsBroadPhaseLayerFilterTable>(
+                    m_broadPhaseLayerInterface, LayersCount, m_layerPairFilter, LayersCount);
+
+                m_physicsSystem.Init(16, 0, 1024, 1024, m_broadPhaseLayerInterface, *m_objectVsBroadPhaseFilter, m_layerPairFilter);
+
+                JPH::BodyInterface& bodies = m_physicsSystem.GetBodyInterface();
+                m_floor = bodies.CreateAndAddBody(JPH::BodyCreationSettings(new JPH::BoxShape(JPH::Vec3(10.f, 1.f, 10.f)), JPH::RVec3(0.f, -1.f, 0.f),
+                                                                            JPH::Quat::sIdentity(), JPH::EMotionType::Static, FloorLayer),
+                                                  JPH::EActivation::DontActivate);
+
+                const JPH::RefConst<JPH::Shape> boxShape = new JPH::BoxShape(JPH::Vec3::sReplicate(0.5f));
+                m_box = bodies.CreateAndAddBody(JPH::BodyCreationSettings(boxShape, JPH::RVec3(0.f, 0.5f, -5.f), JPH::Quat::sIdentity(), JPH::EMotionType::Static, BoxesLayer),
+                                                JPH::EActivation::DontActivate);
+
+                JPH::BodyCreationSettings triggerSettings(boxShape, JPH::RVec3(5.f, 0.5f, 0.f), JPH::Quat::sIdentity(), JPH::EMotionType::Static, BoxesLayer);
+                triggerSettings.mIsSensor = true;
+                m_trigger = bodies.CreateAndAddBody(triggerSettings, JPH::EActivation::DontActivate);
+
+                m_physicsSystem.OptimizeBroadPhase();
+            }
+
+            eastl::optional<physics::jolt::JoltQueryHit> perform(const physics::PhysicsQuery& query, const JPH::Shape* shape = nullptr) const
+            {
+                return physics::jolt::performJoltQuery(m_physicsSystem.GetNarrowPhaseQuery(), query, shape, JPH::Vec3::sReplicate(1.f));
+            }
+
+            JPH::BodyID getFloor() const
+            {
+                return m_floor;
+            }
+
+            JPH::BodyID getBox() const
+            {
+                return m_box;
+            }
+
+            JPH::BodyID getTrigger() const
+            {
+                return m_trigger;
+            }
+
+        private:
+            JPH::ObjectLayerPairFilterTable m_layerPairFilter;
+            JPH::BroadPhaseLayerInterfaceTable m_broadPhaseLayerInterface;
+            eastl::unique_ptr<JPH::ObjectVsBroadPhaseLayerFilterTable> m_objectVsBroadPhaseFilter;
+            JPH::PhysicsSystem m_physicsSystem;
+            JPH::BodyID m_floor;
+            JPH::BodyID m_box;
+            JPH::BodyID m_trigger;
+        };
+
+        class TestJoltPhysicsQueries : public testing::Test
+        {
+        protected:
+            static void SetUpTestSuite()
+            {
+                JPH::RegisterDefaultAllocator();
+                JPH::Factory::sInstance = new JPH::Factory;
+                JPH::RegisterTypes();
+            }
+
+            static void TearDownTestSuite()
+            {
+                JPH::UnregisterTypes();
+                delete JPH::Factory::sInstance;
+                JPH::Factory::sInstance = nullptr;
+            }
+        };
+    }  // namespace
+
+    /**
+        Ray casts report the closest hit within the distance and respect the channels and the triggers filters.
+    */
+    TEST_F(TestJoltPhysicsQueries, RayCast)
+    {
+        const JoltQueriesWorld world;
+
+        const physics::PhysicsQuery down{
+            .type = physics::PhysicsQueryType::RayCast,
+            .origin = math::vec3(0.f, 5.f, 0.f),
+            .direction = math::vec3(0.f, -1.f, 0.f),
+            .maxDistance = 10.f};
+
+        const auto floorHit = world.perform(down);
+        ASSERT_TRUE(floorHit);
+        ASSERT_EQ(floorHit->bodyId, world.getFloor());
+        ASSERT_NEAR(floorHit->distance, 5.f, Tolerance);
+        ASSERT_NEAR(floorHit->position.GetY(), 0.f, Tolerance);
+
+        physics::PhysicsQuery forward{
+            .type = physics::PhysicsQueryType::RayCast,
+            .origin = math::vec3(0.f, 0.5f, 0.f),
+            .direction = math::vec3(0.f, 0.f, -1.f),
+            .maxDistance = 10.f};
+
+        const auto boxHit = world.perform(forward);
+        ASSERT_TRUE(boxHit);
+        ASSERT_EQ(boxHit->bodyId, world.getBox());
+        ASSERT_NEAR(boxHit->distance, 4.5f, Tolerance);
+        ASSERT_NEAR(boxHit->position.GetZ(), -4.5f, Tolerance);
+
+        // too short
+        forward.maxDistance = 4.f;
+        ASSERT_FALSE(world.perform(forward));
+
+        // filtered out by the channel
+        const physics::CollisionChannel floorChannel = FloorLayer;
+        forward.maxDistance = 10.f;
+        forward.reactChannels = {&floorChannel, 1};
+        ASSERT_FALSE(world.perform(forward));
+
+        // nothing behind
+        forward.reactChannels = {};
+        forward.direction = math::vec3(0.f, 0.f, 1.f);
+        ASSERT_FALSE(world.perform(forward));
+
+        physics::PhysicsQuery side{
+            .type = physics::PhysicsQueryType::RayCast,
+            .origin = math::vec3(0.f, 0.5f, 0.f),
+            .direction = math::vec3(1.f, 0.f, 0.f),
+            .maxDistance = 10.f};
+
+        const auto triggerHit = world.perform(side);
+        ASSERT_TRUE(triggerHit);
+        ASSERT_EQ(triggerHit->bodyId, world.getTrigger());
+
+        side.ignoreTriggers = true;
+        ASSERT_FALSE(world.perform(side));
+    }
+
+    /**
+        Shape casts report the first contact of the swept shape within the distance.
+    */
+    TEST_F(TestJoltPhysicsQueries, ShapeCast)
+    {
+        const JoltQueriesWorld world;
+        const JPH::RefConst<JPH::Shape> sphere = new JPH::SphereShape(0.25f);
+
+        physics::PhysicsQuery query{
+            .type = physics::PhysicsQueryType::ShapeCast,
+            .origin = math::vec3(0.f, 0.5f, 0.f),
+            .direction = math::vec3(0.f, 0.f, -1.f),
+            .maxDistance = 10.f};
+
+        const auto hit = world.perform(query, sphere);
+        ASSERT_TRUE(hit);
+        ASSERT_EQ(hit->bodyId, world.getBox());
+        ASSERT_NEAR(hit->distance, 4.25f, Tolerance);
+        ASSERT_NEAR(hit->position.GetZ(), -4.5f, Tolerance);
+        ASSERT_TRUE(hit->normal);
+        ASSERT_NEAR(hit->normal->GetZ(), 1.f, Tolerance);
+
+        // too short
+        query.maxDistance = 4.f;
+        ASSERT_FALSE(world.perform(query, sphere));
+
+        // nothing behind
+        query.maxDistance = 10.f;
+        query.direction = math::vec3(0.f, 0.f, 1.f);
+        ASSERT_FALSE(world.perform(query, sphere));
+
+        // the default distance is finite and can be swept
+        query.maxDistance = physics::PhysicsQuery::DefaultMaxDistance;
+        query.direction = math::vec3(0.f, 0.f, -1.f);
+        const auto defaultDistanceHit = world.perform(query, sphere);
+        ASSERT_TRUE(defaultDistanceHit);
+        ASSERT_EQ(defaultDistanceHit->bodyId, world.getBox());
+        ASSERT_NEAR(defaultDistanceHit->distance, 4.25f, Tolerance);
+    }
+
+    /**
+        Overlap queries report a body intersecting the shape placed at the origin.
+    */
+    TEST_F(TestJoltPhysicsQueries, Overlap)
+    {
+        const JoltQueriesWorld world;
+        const JPH::RefConst<JPH::Shape> sphere = new JPH::SphereShape(0.25f);
+
+        physics::PhysicsQuery query{
+            .type = physics::PhysicsQueryType::Overlap,
+            .origin = math::vec3(0.f, 0.5f, -4.4f)};
+
+        const auto hit = world.perform(query, sphere);
+        ASSERT_TRUE(hit);
+        ASSERT_EQ(hit->bodyId, world.getBox());
+        ASSERT_EQ(hit->distance, 0.f);
+
+        // above the floor, away from the boxes
+        query.origin = math::vec3(0.f, 0.5f, 0.f);
+        ASSERT_FALSE(world.perform(query, sphere));
+
+        // touching the floor
+        query.origin = math::vec3(0.f, 0.2f, 0.f);
+        const auto floorHit = world.perform(query, sphere);
+        ASSERT_TRUE(floorHit);
+        ASSERT_EQ(floorHit->bodyId, world.getFloor());
+
+        // inside the trigger
+        query.origin = math::vec3(5.f, 0.5f, 0.f);
+        ASSERT_TRUE(world.perform(query, sphere));
+
+        query.ignoreTriggers = true;
+        ASSERT_FALSE(world.perform(query, sphere));
+    }
+}  // namespace nau::test
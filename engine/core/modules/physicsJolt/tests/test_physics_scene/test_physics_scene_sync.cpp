@@ -0,0 +1,211 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/physics/components/rigid_body_component.h"
+#include "nau/physics/core_physics.h"
+#include "nau/physics/physics_contact_listener.h"
+#include "nau/rtti/rtti_impl.h"
+#include "scene_test_base.h"
+
+namespace nau::test
+{
+    namespace
+    {
+        constexpr physics::CollisionChannel StaticChannel = 0;
+        constexpr physics::CollisionChannel MovingChannel = 1;
+
+        // The simulation runs in real time: the frames are limited only to not hang the test.
+        constexpr unsigned MaxWaitFramesCount = 5000;
+
+        class ContactsRecorder : public physics::IPhysicsContactListener
+        {
+            NAU_CLASS(nau::test::ContactsRecorder, rtti::RCPolicy::Concurrent, physics::IPhysicsContactListener)
+
+        public:
+            struct Contact
+            {
+                const physics::RigidBodyComponent* rigidBody1;
+                const physics::RigidBodyComponent* rigidBody2;
+            };
+
+            void onContactAdded(const ContactManifold& data1, const ContactManifold& data2, const eastl::vector<math::vec3>&) override
+            {
+                const std::lock_guard lock(m_mutex);
+                m_contacts.push_back({&data1.rigidBody, &data2.rigidBody});
+            }
+
+            void onContactContinued(const ContactManifold&, const ContactManifold&, const eastl::vector<math::vec3>&) override
+            {
+            }
+
+            void onContactRemovedCompletely(const ContactManifold&, const ContactManifold&) override
+            {
+            }
+
+            eastl::vector<Contact> getContacts() const
+            {
+                const std::lock_guard lock(m_mutex);
+                return m_contacts;
+            }
+
+        private:
+            mutable std::mutex m_mutex;
+            eastl::vector<Contact> m_contacts;
+        };
+
+        physics::RigidBodyComponent& addRigidBody(scene::SceneObject& object, physics::MotionType motionType, physics::CollisionChannel channel)
+        {
+            auto& rigidBody = object.addComponent<physics::RigidBodyComponent>();
+            rigidBody.setMotionType(motionType);
+            rigidBody.setCollisionChannel(channel);
+            if (motionType == physics::MotionType::Dynamic)
+            {
+                rigidBody.setMass(1.f);
+                rigidBody.getCollisions().addSphere(0.5f);
+            }
+            else
+            {
+                rigidBody.getCollisions().addBox(math::vec3{20.f, 1.f, 20.f});
+            }
+
+            return rigidBody;
+        }
+    }  // namespace
+
+    /**
+     */
+    class TestPhysicsSceneSync : public SceneTestBase
+    {
+    protected:
+        static physics::ICorePhysics& getCorePhysics()
+        {
+            return getServiceProvider().get<physics::ICorePhysics>();
+        }
+
+        /**
+            The physics world is created with the first activated rigid body.
+         */
+        async::Task<nau::Ptr<physics::IPhysicsWorld>> waitDefaultPhysicsWorld()
+        {
+            for (unsigned i = 0; i < MaxWaitFramesCount; ++i)
+            {
+                if (auto physWorld = getCorePhysics().getDefaultPhysicsWorld())
+                {
+                    co_return physWorld;
+                }
+
+                co_await skipFrames(1);
+            }
+
+            co_return nullptr;
+        }
+    };
+
+    /**
+        Test: contact notification references the rigid bodies of both contacting objects.
+        (Regression: the second rigid body was looked up on the first object.)
+     */
+    TEST_F(TestPhysicsSceneSync, ContactReportsBothRigidBodies)
+    {
+        using namespace testing;
+        using namespace nau::async;
+        using namespace nau::scene;
+
+        const AssertionResult testResult = runTestApp([&]() -> Task<AssertionResult>
+        {
+            IScene::Ptr scene = createEmptyScene();
+
+            ObjectWeakRef floor = scene->getRoot().attachChild(createObject("Floor"));
+            floor->setTranslation(math::vec3{0.f, -1.f, 0.f});
+            const physics::RigidBodyComponent* const floorRigidBody = &addRigidBody(*floor, physics::MotionType::Static, StaticChannel);
+
+            ObjectWeakRef ball = scene->getRoot().attachChild(createObject("Ball"));
+            // high enough to set the listener and the channels before the contact
+            ball->setTranslation(math::vec3{0.f, 3.f, 0.f});
+            const physics::RigidBodyComponent* const ballRigidBody = &addRigidBody(*ball, physics::MotionType::Dynamic, MovingChannel);
+
+            co_await getSceneManager().activateScene(std::move(scene));
+
+            nau::Ptr<physics::IPhysicsWorld> physWorld = co_await waitDefaultPhysicsWorld();
+            ASSERT_ASYNC(physWorld);
+
+            auto contactsRecorder = rtti::createInstance<ContactsRecorder>();
+            physWorld->setContactListener(contactsRecorder);
+            physWorld->setChannelsCollidable(StaticChannel, MovingChannel);
+
+            for (unsigned i = 0; i < MaxWaitFramesCount && contactsRecorder->getContacts().empty(); ++i)
+            {
+                co_await skipFrames(1);
+            }
+
+            const eastl::vector<ContactsRecorder::Contact> contacts = contactsRecorder->getContacts();
+            ASSERT_ASYNC(!contacts.empty());
+
+            const ContactsRecorder::Contact& contact = contacts.front();
+            ASSERT_ASYNC(contact.rigidBody1 != contact.rigidBody2);
+            ASSERT_ASYNC(contact.rigidBody1 == floorRigidBody || contact.rigidBody1 == ballRigidBody);
+            ASSERT_ASYNC(contact.rigidBody2 == floorRigidBody || contact.rigidBody2 == ballRigidBody);
+
+            physWorld->setContactListener(nullptr);
+
+            co_return AssertionSuccess();
+        });
+
+        ASSERT_TRUE(testResult);
+    }
+
+    /**
+        Test: removing a rigid body keeps synchronizing the other bodies of the world.
+        (Regression: the deactivation predicate removed every body.)
+     */
+    TEST_F(TestPhysicsSceneSync, RemovedBodyKeepsOthersSynchronized)
+    {
+        using namespace testing;
+        using namespace nau::async;
+        using namespace nau::scene;
+
+        const AssertionResult testResult = runTestApp([&]() -> Task<AssertionResult>
+        {
+            constexpr float StartHeight = 100.f;
+
+            IScene::Ptr scene = createEmptyScene();
+
+            ObjectWeakRef removedBall = scene->getRoot().attachChild(createObject("RemovedBall"));
+            removedBall->setTranslation(math::vec3{-5.f, StartHeight, 0.f});
+            addRigidBody(*removedBall, physics::MotionType::Dynamic, MovingChannel);
+
+            ObjectWeakRef ball = scene->getRoot().attachChild(createObject("Ball"));
+            ball->setTranslation(math::vec3{5.f, StartHeight, 0.f});
+            addRigidBody(*ball, physics::MotionType::Dynamic, MovingChannel);
+
+            ObjectWeakRef sceneRef = co_await getSceneManager().activateScene(std::move(scene));
+
+            const auto waitFalling = [&](float fromHeight) -> Task<bool>
+            {
+                for (unsigned i = 0; i < MaxWaitFramesCount; ++i)
+                {
+                    if (ball->getTranslation().getY() < fromHeight - 0.5f)
+                    {
+                        co_return true;
+                    }
+
+                    co_await skipFrames(1);
+                }
+
+                co_return false;
+            };
+
+            ASSERT_ASYNC(co_await waitFalling(StartHeight));
+
+            sceneRef->getRoot().removeChild(removedBall);
+            co_await skipFrames(5);
+
+            ASSERT_ASYNC(co_await waitFalling(ball->getTranslation().getY()));
+
+            co_return AssertionSuccess();
+        });
+
+        ASSERT_TRUE(testResult);
+    }
+}  // namespace nau::test
@@ -5,6 +5,7 @@
 
 #include <EASTL/intrusive_list.h>
 
+#include <atomic>
 #include <concepts>
 #include <type_traits>
 
@@ -28,6 +29,7 @@ namespace nau::scene
 {
     class SceneObject;
     class SceneManagerImpl;
+    class ComponentChangesQueue;
 
     /**
      */
@@ -65,6 +67,24 @@ namespace nau::scene
 
         ActivationState getActivationState() const;
 
+        /**
+         * @brief Binds the component to the queue that collects the changed components.
+         *
+         * @param [in] queue    Queue to bind the component to or `NULL` to unbind the component.
+         *
+         * @note    Only a single queue can be bound to the component.
+         *          The binding must not be changed while the component can be modified concurrently.
+         */
+        void setChangesQueue(ComponentChangesQueue* queue);
+
+        /**
+         * @brief Puts the component into the bound changes queue (if any).
+         *
+         * Must be called after the component state that is mirrored by the other systems has been changed.
+         * The call is cheap when the component has already been enqueued and can be done concurrently.
+         */
+        void notifyStateChanged();
+
     protected:
         Component();
 
@@ -126,7 +146,12 @@ namespace nau::scene
         //  should not be used (excluded) when scene listener support is off.
         SceneManagerImpl* m_sceneManager = nullptr;
 
+        std::atomic<ComponentChangesQueue*> m_changesQueue = nullptr;
+        std::atomic<bool> m_isChangeEnqueued = false;
+
         friend SceneObject;
+        friend ComponentChangesQueue;
+        friend class SceneComponent;
         friend class SceneManagerImpl;
     };
 
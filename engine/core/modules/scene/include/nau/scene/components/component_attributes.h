@@ -12,4 +12,14 @@ namespace nau::scene
     NAU_DEFINE_ATTRIBUTE(ComponentDescriptionAttrib, "nau.scene.component_description", meta::AttributeOptionsNone)
 
     NAU_DEFINE_ATTRIBUTE(HiddenAttributeAttr, "nau.scene.hidden_component", meta::AttributeOptionsNone)
+
+    /**
+        Marks the component whose IComponentUpdate::updateComponent can be called concurrently with the other components marked so:
+        the update must only modify the component's own state and must not create, destroy or (de)activate any scene objects or components.
+        The update must not change the transforms of the scene components either (the deferred world transform updates are not synchronized).
+        Such components are updated by the scene manager in parallel chunks (batched by the component type) prior to the regular update:
+        all of them are updated before any not marked component, regardless of the activation order
+        (also when the parallel update is disabled, see ISceneManagerInternal::setParallelUpdateEnabled).
+     */
+    NAU_DEFINE_ATTRIBUTE(ComponentParallelUpdateAttrib, "nau.scene.component_parallel_update", meta::AttributeOptionsNone)
 }  // namespace nau::scene
@@ -0,0 +1,51 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#pragma once
+
+#include "nau/kernel/kernel_config.h"
+#include "nau/memory/eastl_aliases.h"
+#include "nau/threading/spin_lock.h"
+
+namespace nau::scene
+{
+    class Component;
+
+    /**
+        @brief Collects the components whose state has been changed since the queue was consumed last time.
+
+        A system that mirrors the components state (e.g. the graphics scene) binds the components to its queue (Component::setChangesQueue)
+        and synchronizes only the enqueued components instead of checking all of them every frame.
+        A component is enqueued at most once until the queue is consumed. The components can be enqueued concurrently.
+        The bound components must be unbound before the queue is destroyed (a destroyed component is removed from the queue automatically).
+    */
+    class NAU_CORESCENE_EXPORT ComponentChangesQueue
+    {
+    public:
+        ComponentChangesQueue() = default;
+        ComponentChangesQueue(const ComponentChangesQueue&) = delete;
+        ComponentChangesQueue& operator=(const ComponentChangesQueue&) = delete;
+
+        /**
+            @brief Moves the enqueued components into the output collection (its previous content is discarded).
+
+            The taken components can be enqueued again right after the call.
+        */
+        void takeChangedComponents(Vector<Component*>& components);
+
+        bool isEmpty() const;
+
+    private:
+        /**
+            @return `false` if the component is not bound to the queue anymore.
+        */
+        bool enqueue(Component& component);
+        void remove(Component& component);
+
+        mutable threading::SpinLock m_mutex;
+        Vector<Component*> m_components;
+
+        friend class Component;
+    };
+}  // namespace nau::scene
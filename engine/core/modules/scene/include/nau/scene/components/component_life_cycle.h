@@ -32,6 +32,10 @@ namespace nau::scene
          *          IComponentAsyncUpdate::updateComponentAsync calls completion, until it can proceed to the next frame.
          *          Consequently, all lasting operations are to be avoided within these calls. Instead, address to
          *          IComponentAsyncListener::listenComponent.
+         *
+         * @note    Components are updated world by world and, within the world, grouped by the component type
+         *          (the types are ordered by their first activation within the world). Components of the same type are updated in their activation order.
+         *          Components marked with ComponentParallelUpdateAttrib are updated before all others.
          */
         virtual void updateComponent(float dt) = 0;
     };
@@ -6,6 +6,8 @@
 
 #include <EASTL/optional.h>
 
+#include <limits>
+
 #include "nau/math/transform.h"
 #include "nau/meta/class_info.h"
 #include "nau/scene/components/component.h"
@@ -73,12 +75,29 @@ namespace nau::scene
         math::vec3 getScale() const final;
 
     private:
+        static constexpr size_t NoTransformUpdate = std::numeric_limits<size_t>::max();
+
         void appendTransformChild(SceneComponent& child);
         void removeTransformChild(SceneComponent& child);
+        void setTransformDepth(size_t depth);
+
+        /**
+            @brief Resets the cached world transforms of the component and all its transform children.
+
+            Active components changed within the scene update are queued into the scene manager's transform update (that is performed at the end of the update):
+            the subtree that is already invalidated and queued is skipped, so repeated changes within the frame cost O(1).
+            Inactive components and the changes made outside of the scene update are notified immediately.
+        */
+        void invalidateWorldTransform();
 
     protected:
+        /**
+            @brief Called when the world transform of the component has been changed (directly or by any of its transform parents).
+
+            For the active components changed within the scene update the call is deferred until the end of the update
+            and happens once, after the world transforms of all changed components have been recalculated.
+        */
         virtual void notifyTransformChanged();
-        virtual void notifyTransformChanged(const math::Transform& worldTransformCache);
 
     protected:
         math::Transform m_transform;
@@ -87,8 +106,11 @@ namespace nau::scene
     private:
         SceneComponent* m_transformParent = nullptr;
         eastl::intrusive_list<scene_internal::TransformListNode> m_transformChildren;
+        size_t m_transformUpdateIndex = NoTransformUpdate;
+        size_t m_transformDepth = 0;
 
         friend class SceneObject;
+        friend class SceneManagerImpl;
     };
 
 }  // namespace nau::scene
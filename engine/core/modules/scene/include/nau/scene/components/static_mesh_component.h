@@ -61,7 +61,6 @@ namespace nau::scene
 
     protected:
         void notifyTransformChanged() override;
-        void notifyTransformChanged(const math::Transform& worldTransformCache) override;
 
     private:
         mutable StaticMeshAssetRef m_geometryAsset;
@@ -44,6 +44,12 @@ namespace nau::scene
 
         virtual void update(float dt) = 0;
 
+        /**
+            Enables/disables the parallel update of the components marked with ComponentParallelUpdateAttrib.
+            When disabled such components are updated serially in the same (deterministic) order. Enabled by default.
+         */
+        virtual void setParallelUpdateEnabled(bool enabled) = 0;
+
         virtual Component* findComponent(Uid componentId) = 0;
 
         virtual async::Task<> shutdown() = 0;
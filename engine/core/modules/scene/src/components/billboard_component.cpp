@@ -13,6 +13,7 @@ namespace nau::scene
     {
         m_texture = assetRef;
         isBillboardTextureDirty = true;
+        notifyStateChanged();
     }
 
     nau::TextureAssetRef BillboardComponent::getTextureRef() const
@@ -23,6 +24,7 @@ namespace nau::scene
     void BillboardComponent::setScreenPercentageSize(float newScreenPercSize)
     {
         m_screenPercentageSize = newScreenPercSize;
+        notifyStateChanged();
     }
 
     float BillboardComponent::getScreenPercentageSize()
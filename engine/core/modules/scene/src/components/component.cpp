@@ -3,6 +3,7 @@
 
 #include "nau/scene/components/component.h"
 
+#include "nau/scene/components/component_changes_queue.h"
 #include "nau/scene/components/component_life_cycle.h"
 #include "nau/scene/scene_object.h"
 #include "scene_management/scene_manager_impl.h"
@@ -13,6 +14,8 @@ namespace nau::scene
     {
         NAU_ASSERT(m_asyncTasks.isEmpty());
         NAU_ASSERT(!m_parentObject);
+
+        setChangesQueue(nullptr);
     }
 
     Component::Component()
@@ -53,6 +56,36 @@ namespace nau::scene
         return m_activationState;
     }
 
+    void Component::setChangesQueue(ComponentChangesQueue* queue)
+    {
+        // The queue is replaced before the component is removed from the old one:
+        // the concurrent notification can not put the component back (see ComponentChangesQueue::enqueue).
+        ComponentChangesQueue* const oldQueue = m_changesQueue.exchange(queue, std::memory_order_acq_rel);
+        if (oldQueue && oldQueue != queue)
+        {
+            oldQueue->remove(*this);
+        }
+    }
+
+    void Component::notifyStateChanged()
+    {
+        if (!m_changesQueue.load(std::memory_order_acquire) || m_isChangeEnqueued.exchange(true, std::memory_order_acq_rel))
+        {
+            return;
+        }
+
+        // The queue is rechecked by the queue itself: the component is enqueued into the queue it is currently bound to.
+        while (ComponentChangesQueue* const queue = m_changesQueue.load(std::memory_order_acquire))
+        {
+            if (queue->enqueue(*this))
+            {
+                return;
+            }
+        }
+
+        m_isChangeEnqueued.store(false, std::memory_order_release);
+    }
+
     void Component::changeActivationState(ActivationState newState)
     {
         [[maybe_unused]] const auto oldState = std::exchange(m_activationState, newState);
@@ -93,6 +126,8 @@ namespace nau::scene
 
     void Component::onThisValueChanged(std::string_view key)
     {
+        notifyStateChanged();
+
         if (m_activationState == ActivationState::Active)
         {
             NAU_FATAL(m_sceneManager);
@@ -0,0 +1,61 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/scene/components/component_changes_queue.h"
+
+#include "nau/scene/components/component.h"
+
+namespace nau::scene
+{
+    void ComponentChangesQueue::takeChangedComponents(Vector<Component*>& components)
+    {
+        components.clear();
+
+        lock_(m_mutex);
+
+        // Flags are reset under the lock: the component that is changed right after the reset
+        // is put into the new (empty) collection and will be taken by the next call.
+        for (Component* const component : m_components)
+        {
+            component->m_isChangeEnqueued.store(false, std::memory_order_release);
+        }
+
+        components.swap(m_components);
+    }
+
+    bool ComponentChangesQueue::isEmpty() const
+    {
+        lock_(m_mutex);
+        return m_components.empty();
+    }
+
+    bool ComponentChangesQueue::enqueue(Component& component)
+    {
+        lock_(m_mutex);
+
+        // The component is being unbound from the queue (see Component::setChangesQueue).
+        if (component.m_changesQueue.load(std::memory_order_acquire) != this)
+        {
+            return false;
+        }
+
+        m_components.push_back(&component);
+        return true;
+    }
+
+    void ComponentChangesQueue::remove(Component& component)
+    {
+        lock_(m_mutex);
+
+        if (!component.m_isChangeEnqueued.exchange(false, std::memory_order_acq_rel))
+        {
+            return;
+        }
+
+        if (auto iter = eastl::find(m_components.begin(), m_components.end(), &component); iter != m_components.end())
+        {
+            m_components.erase_unsorted(iter);
+        }
+    }
+}  // namespace nau::scene
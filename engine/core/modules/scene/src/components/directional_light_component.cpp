@@ -14,31 +14,37 @@ namespace nau::scene
         m_red = color.r;
         m_green = color.g;
         m_blue = color.b;
+        notifyStateChanged();
     }
 
     void DirectionalLightComponent::setIntensity(float intensity)
     {
         m_intensity = intensity;
+        notifyStateChanged();
     }
 
     void DirectionalLightComponent::setCastShadows(bool hasShadows)
     {
         m_castShadows = hasShadows;
+        notifyStateChanged();
     }
 
     void DirectionalLightComponent::setShadowMapSize(uint32_t size)
     {
         m_csmSize = size;
+        notifyStateChanged();
     }
 
     void DirectionalLightComponent::setShadowCascadeCount(uint32_t count)
     {
         m_csmCascadesCount = count;
+        notifyStateChanged();
     }
 
     void DirectionalLightComponent::setCsmPowWeight(float weight)
     {
         m_csmPowWeight = weight;
+        notifyStateChanged();
     }
 
     math::Vector3 DirectionalLightComponent::getDirection() const
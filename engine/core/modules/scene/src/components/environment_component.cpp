@@ -17,6 +17,7 @@ namespace nau::scene
     {
         m_textureAsset = texture;
         m_isTextureDirty = true;
+        notifyStateChanged();
     }
 
     bool EnvironmentComponent::isTextureDirty() const
@@ -32,6 +33,7 @@ namespace nau::scene
     void EnvironmentComponent::setIntensity(float intensity)
     {
         m_enviIntensity = intensity;
+        notifyStateChanged();
     }
 
     float EnvironmentComponent::getIntensity() const
@@ -36,6 +36,7 @@ namespace nau::scene
     void OmnilightComponent::setShift(math::Vector3 shift)
     {
         m_shift = shift;
+        notifyStateChanged();
     }
 
     void OmnilightComponent::setColor(math::Color3 color)
@@ -44,20 +45,24 @@ namespace nau::scene
         m_red = color.r;
         m_green = color.g;
         m_blue = color.b;
+        notifyStateChanged();
     }
 
     void OmnilightComponent::setRadius(float radius)
     {
         m_radius = radius;
+        notifyStateChanged();
     }
 
     void OmnilightComponent::setAttenuation(float attenuation)
     {
         m_attenuation = attenuation;
+        notifyStateChanged();
     }
 
     void OmnilightComponent::setIntensity(float intensity)
     {
         m_intensity = intensity;
+        notifyStateChanged();
     }
 }  // namespace nau::scene
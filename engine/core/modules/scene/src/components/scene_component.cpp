@@ -3,6 +3,8 @@
 
 #include "nau/scene/components/scene_component.h"
 
+#include "scene_management/scene_manager_impl.h"
+
 namespace nau::scene
 {
     NAU_IMPLEMENT_DYNAMIC_OBJECT(SceneComponent)
@@ -36,7 +38,8 @@ namespace nau::scene
             m_transform = worldTransform;
         }
 
-        notifyTransformChanged(worldTransform);
+        invalidateWorldTransform();
+        m_worldTransformCache.emplace(worldTransform);
     }
 
     const math::Transform& SceneComponent::getTransform() const
@@ -47,25 +50,25 @@ namespace nau::scene
     void SceneComponent::setTransform(const math::Transform& transform)
     {
         m_transform = transform;
-        notifyTransformChanged();
+        invalidateWorldTransform();
     }
 
     void SceneComponent::setRotation(math::quat rotation)
     {
         m_transform.setRotation(rotation);
-        notifyTransformChanged();
+        invalidateWorldTransform();
     }
 
     void SceneComponent::setTranslation(math::vec3 position)
     {
         m_transform.setTranslation(position);
-        notifyTransformChanged();
+        invalidateWorldTransform();
     }
 
     void SceneComponent::setScale(math::vec3 scale)
     {
         m_transform.setScale(scale);
-        notifyTransformChanged();
+        invalidateWorldTransform();
     }
 
     math::quat SceneComponent::getRotation() const
@@ -90,6 +93,7 @@ namespace nau::scene
 
         m_transformChildren.push_back(child);
         child.m_transformParent = this;
+        child.setTransformDepth(m_transformDepth + 1);
     }
 
     void SceneComponent::removeTransformChild(SceneComponent& child)
@@ -100,28 +104,52 @@ namespace nau::scene
 
         m_transformChildren.remove(child);
         child.m_transformParent = nullptr;
+        child.setTransformDepth(0);
     }
 
-    void SceneComponent::notifyTransformChanged()
+    void SceneComponent::setTransformDepth(size_t depth)
     {
-        m_worldTransformCache.reset();
-        notifyChanged();
+        m_transformDepth = depth;
 
         for (auto& transformChild : m_transformChildren)
         {
-            static_cast<SceneComponent&>(transformChild).notifyTransformChanged();
+            static_cast<SceneComponent&>(transformChild).setTransformDepth(depth + 1);
         }
     }
 
-    void SceneComponent::notifyTransformChanged(const math::Transform& worldTransformCache)
+    void SceneComponent::invalidateWorldTransform()
     {
-        m_worldTransformCache.emplace(worldTransformCache);
-        notifyChanged();
+        // Changes made outside of the scene update (i.e. by the post update writers) must be visible within the same frame.
+        const bool isDeferred = m_activationState == ActivationState::Active && m_sceneManager && m_sceneManager->isInsideUpdate();
+        if (isDeferred && !m_worldTransformCache && m_transformUpdateIndex != NoTransformUpdate)
+        {
+            // Cached world transform of the component can only exist when all its transform parents have it,
+            // so the whole subtree is already invalidated and queued.
+            return;
+        }
+
+        m_worldTransformCache.reset();
+
+        if (!isDeferred)
+        {
+            notifyTransformChanged();
+        }
+        else if (m_transformUpdateIndex == NoTransformUpdate)
+        {
+            NAU_FATAL(m_sceneManager);
+            m_sceneManager->enqueueTransformUpdate(*this);
+        }
 
         for (auto& transformChild : m_transformChildren)
         {
-            static_cast<SceneComponent&>(transformChild).notifyTransformChanged();
+            static_cast<SceneComponent&>(transformChild).invalidateWorldTransform();
         }
     }
 
+    void SceneComponent::notifyTransformChanged()
+    {
+        notifyChanged();
+        notifyStateChanged();
+    }
+
 }  // namespace nau::scene
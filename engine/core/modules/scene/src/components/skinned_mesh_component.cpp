@@ -27,6 +27,7 @@ namespace nau
     {
         m_materialAsset = assetRef;
         m_isMaterialDirty = true;
+        notifyStateChanged();
     }
 
     bool SkinnedMeshComponent::isMaterialDirty() const
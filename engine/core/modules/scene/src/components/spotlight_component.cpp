@@ -31,6 +31,7 @@ namespace nau::scene
     void SpotlightComponent::setShift(math::Vector3 shift)
     {
         m_shift = shift;
+        notifyStateChanged();
     }
 
     void SpotlightComponent::setColor(math::Color3 color)
@@ -39,16 +40,19 @@ namespace nau::scene
         m_red = color.r;
         m_green = color.g;
         m_blue = color.b;
+        notifyStateChanged();
     }
 
     void SpotlightComponent::setRadius(float radius)
     {
         m_radius = radius;
+        notifyStateChanged();
     }
 
     void SpotlightComponent::setAttenuation(float attenuation)
     {
         m_attenuation = attenuation;
+        notifyStateChanged();
     }
 
     math::Vector3 SpotlightComponent::getDirection() const
@@ -69,16 +73,19 @@ namespace nau::scene
     void SpotlightComponent::setDirection(math::Vector3 direction)
     {
         m_direction = direction;
+        notifyStateChanged();
     }
 
     void SpotlightComponent::setIntensity(float intensity)
     {
         m_intensity = intensity;
+        notifyStateChanged();
     }
 
     void SpotlightComponent::setAngle(float angle)
     {
         m_angle = angle;
+        notifyStateChanged();
     }
 
 }  // namespace nau::scene
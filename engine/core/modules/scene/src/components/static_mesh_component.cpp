@@ -27,6 +27,7 @@ namespace nau::scene
     {
         m_materialAsset = assetRef;
         m_dirtyFlags |= static_cast<uint32_t>(DirtyFlags::Material);
+        notifyStateChanged();
     }
 
     uint32_t StaticMeshComponent::getDirtyFlags() const
@@ -48,6 +49,7 @@ namespace nau::scene
     {
         m_isVisible = isVisible;
         m_dirtyFlags |= static_cast<uint32_t>(DirtyFlags::Visibility);
+        notifyStateChanged();
     }
 
     bool StaticMeshComponent::getCastShadow()
@@ -59,6 +61,7 @@ namespace nau::scene
     {
         m_castShadow = castShadow;
         m_dirtyFlags |= static_cast<uint32_t>(DirtyFlags::CastShadow);
+        notifyStateChanged();
     }
 
     void StaticMeshComponent::notifyTransformChanged()
@@ -67,10 +70,4 @@ namespace nau::scene
         m_dirtyFlags |= static_cast<uint32_t>(DirtyFlags::WorldPos);
     }
 
-    void StaticMeshComponent::notifyTransformChanged(const math::Transform& worldTransformCache)
-    {
-        SceneComponent::notifyTransformChanged(worldTransformCache);
-        m_dirtyFlags |= static_cast<uint32_t>(DirtyFlags::WorldPos);
-    }
-
 }  // namespace nau
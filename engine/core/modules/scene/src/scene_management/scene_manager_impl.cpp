@@ -4,7 +4,12 @@
 
 #include "scene_manager_impl.h"
 
+#include <EASTL/sort.h>
+#include <EASTL/span.h>
+
+#include "nau/async/parallel_for.h"
 #include "nau/memory/stack_allocator.h"
+#include "nau/scene/components/component_attributes.h"
 #include "nau/scene/scene_processor.h"
 #include "scene_impl.h"
 #include <nau/assets/asset_ref.h>
@@ -290,7 +295,7 @@ namespace nau::scene
                 const bool isUpdatable = component->is<IComponentUpdate>() || component->is<IComponentAsyncUpdate>();
                 if (isUpdatable)
                 {
-                    m_updatableComponents.emplace_back(*component);
+                    addUpdatableComponent(*component);
                 }
 
                 // IComponentEvents::onComponentActivated must be called inside transferActivationState
@@ -511,6 +516,10 @@ namespace nau::scene
             NAU_FATAL(component->isOperable());
 
             component->changeActivationState(ActivationState::Deactivating);
+            if (SceneComponent* const sceneComponent = component->as<SceneComponent*>())
+            {
+                cancelTransformUpdate(*sceneComponent);
+            }
             component->clearAllWeakReferences();
             component->getParentObject().removeComponentFromList(*component);
 
@@ -526,22 +535,10 @@ namespace nau::scene
             co_await m_postUpdateWorkQueue;
         }
 
-        m_updatableComponents.remove_if([](UpdatableComponentEntry& entry)
+        for (Component* const component : components)
         {
-            NAU_FATAL(entry.component);
-            const bool deactivating = entry.component->m_activationState == ActivationState::Deactivating;
-            if (deactivating)
-            {
-                // keep listener's finalization as component's internal async operation
-                // that will be awaited prior component deletion
-                if (entry.asyncUpdateTask && !entry.asyncUpdateTask.isReady())
-                {
-                    entry.component->m_asyncTasks.push(std::move(entry.asyncUpdateTask));
-                }
-            }
-
-            return deactivating;
-        });
+            removeUpdatableComponent(*component);
+        }
 
         {
             // all scene processors will be notified through ISceneProcessor/IComponentsActivator or ISceneProcessor/IComponentsAsyncActivator
@@ -766,6 +763,7 @@ namespace nau::scene
         scope_on_leave
         {
             m_insideUpdate = false;
+            updateWorldTransforms();
             m_postUpdateWorkQueue->poll();
             Executor::setThisThreadExecutor(std::move(prevThisThreadExecutor));
 
@@ -774,42 +772,298 @@ namespace nau::scene
 
         m_updateWorkQueue->poll();
 
-        for (auto iter = m_updatableComponents.begin(); iter != m_updatableComponents.end(); ++iter)
-        {
-            UpdatableComponentEntry& entry = *iter;
+        compactUpdatableComponents();
+        updateComponentsParallel(dt);
 
-            NAU_FATAL(entry.component);
-            if (!entry.isActive())
+        for (WorldUpdatableComponents& worldComponents : m_updatableComponents)
+        {
+            if (!worldComponents.world || worldComponents.world->isSimulationPaused())
             {
                 continue;
             }
 
-            // TODO: this is very temporal solution.
-            // m_updatableComponents must keeps components in separated groups related to different worlds.
-            if (entry.component->getParentObject().getScene()->getWorld()->isSimulationPaused())
+            // Components activated from within the update are appended to the same storage,
+            // so the groups and entries are accessed only by index (references can be invalidated after each update call).
+            for (size_t groupIndex = 0; groupIndex < worldComponents.groups.size(); ++groupIndex)
+            {
+                const bool parallelUpdate = worldComponents.groups[groupIndex].parallelUpdate;
+
+                for (size_t entryIndex = 0; entryIndex < worldComponents.groups[groupIndex].entries.size(); ++entryIndex)
+                {
+                    UpdatableComponentEntry* entry = &worldComponents.groups[groupIndex].entries[entryIndex];
+                    if (!entry->isActive())
+                    {
+                        continue;
+                    }
+
+                    // Already updated within the parallel phase.
+                    if (entry->componentUpdate && !parallelUpdate)
+                    {
+                        entry->componentUpdate->updateComponent(dt);
+
+                        entry = &worldComponents.groups[groupIndex].entries[entryIndex];
+                        if (!entry->isActive())
+                        {
+                            continue;
+                        }
+                    }
+
+                    if (entry->componentAsyncUpdate && entry->isActive())
+                    {
+                        if (!entry->asyncUpdateTask || entry->asyncUpdateTask.isReady())
+                        {
+                            // TODO:
+                            // Most likely, using 'dt' in this case is incorrect and a time interval between the previous and current updateComponentAsync calls is required.
+                            entry->asyncUpdateTask = entry->componentAsyncUpdate->updateComponentAsync(dt);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    void SceneManagerImpl::setParallelUpdateEnabled(bool enabled)
+    {
+        m_parallelUpdateEnabled = enabled;
+    }
+
+    SceneManagerImpl::WorldUpdatableComponents& SceneManagerImpl::getWorldUpdatableComponents(IWorld& world)
+    {
+        auto iter = eastl::find_if(m_updatableComponents.begin(), m_updatableComponents.end(), [&world](const WorldUpdatableComponents& worldComponents)
+        {
+            return worldComponents.world.get() == &world;
+        });
+
+        if (iter != m_updatableComponents.end())
+        {
+            return *iter;
+        }
+
+        // Storage of the destroyed worlds are released as soon as they become empty.
+        m_updatableComponents.remove_if([](const WorldUpdatableComponents& worldComponents)
+        {
+            return !worldComponents.world && worldComponents.componentsCount == 0;
+        });
+
+        m_updatableComponents.emplace_back(world);
+        return m_updatableComponents.back();
+    }
+
+    void SceneManagerImpl::addUpdatableComponent(Component& component)
+    {
+        NAU_ASSERT(!m_updatableComponentHandles.contains(&component));
+
+        WorldUpdatableComponents& worldComponents = getWorldUpdatableComponents(*component.getParentObject().getScene()->getWorld());
+
+        const IClassDescriptor::Ptr classDescriptor = component.getClassDescriptor();
+        const size_t componentType = classDescriptor->getClassTypeInfo().getHashCode();
+
+        auto [groupIter, groupInserted] = worldComponents.groupIndices.emplace(componentType, worldComponents.groups.size());
+        if (groupInserted)
+        {
+            const meta::IRuntimeAttributeContainer* const attributes = classDescriptor->getClassAttributes();
+
+            UpdatableComponentsGroup& group = worldComponents.groups.emplace_back();
+            group.componentType = componentType;
+            group.parallelUpdate = component.is<IComponentUpdate>() && attributes && attributes->get<ComponentParallelUpdateAttrib, bool>().value_or(false);
+        }
+
+        const size_t groupIndex = groupIter->second;
+        Vector<UpdatableComponentEntry>& entries = worldComponents.groups[groupIndex].entries;
+
+        m_updatableComponentHandles.emplace(&component, UpdatableComponentHandle{&worldComponents, groupIndex, entries.size()});
+        entries.emplace_back(component);
+        ++worldComponents.componentsCount;
+    }
+
+    void SceneManagerImpl::removeUpdatableComponent(Component& component)
+    {
+        const auto handleIter = m_updatableComponentHandles.find(&component);
+        if (handleIter == m_updatableComponentHandles.end())
+        {
+            return;
+        }
+
+        const UpdatableComponentHandle handle = handleIter->second;
+        m_updatableComponentHandles.erase(handleIter);
+
+        Vector<UpdatableComponentEntry>& entries = handle.worldComponents->groups[handle.groupIndex].entries;
+        NAU_FATAL(handle.entryIndex < entries.size());
+
+        UpdatableComponentEntry& entry = entries[handle.entryIndex];
+        NAU_FATAL(entry.component == &component);
+
+        // keep listener's finalization as component's internal async operation
+        // that will be awaited prior component deletion
+        if (entry.asyncUpdateTask && !entry.asyncUpdateTask.isReady())
+        {
+            component.m_asyncTasks.push(std::move(entry.asyncUpdateTask));
+        }
+
+        // The entry can be removed from within the update loop: it is compacted later to not shift the entries that are not updated yet.
+        entry.component = nullptr;
+        entry.componentUpdate = nullptr;
+        entry.componentAsyncUpdate = nullptr;
+        entry.asyncUpdateTask = nullptr;
+
+        handle.worldComponents->hasRemovedEntries = true;
+        --handle.worldComponents->componentsCount;
+    }
+
+    void SceneManagerImpl::compactUpdatableComponents()
+    {
+        for (WorldUpdatableComponents& worldComponents : m_updatableComponents)
+        {
+            if (!std::exchange(worldComponents.hasRemovedEntries, false))
             {
                 continue;
             }
 
-            if (entry.componentUpdate)
+            for (UpdatableComponentsGroup& group : worldComponents.groups)
             {
-                entry.componentUpdate->updateComponent(dt);
-                if (!entry.isActive())
+                size_t count = 0;
+                for (size_t entryIndex = 0; entryIndex < group.entries.size(); ++entryIndex)
                 {
-                    continue;
+                    if (!group.entries[entryIndex].component)
+                    {
+                        continue;
+                    }
+
+                    if (count != entryIndex)
+                    {
+                        group.entries[count] = std::move(group.entries[entryIndex]);
+                        m_updatableComponentHandles[group.entries[count].component].entryIndex = count;
+                    }
+
+                    ++count;
                 }
+
+                group.entries.erase(group.entries.begin() + count, group.entries.end());
+            }
+        }
+    }
+
+    void SceneManagerImpl::updateComponentsParallel(float dt)
+    {
+        m_parallelUpdates.clear();
+
+        // Groups are already batched by the component type: each chunk mostly calls the same updateComponent implementation.
+        for (WorldUpdatableComponents& worldComponents : m_updatableComponents)
+        {
+            if (!worldComponents.world || worldComponents.world->isSimulationPaused())
+            {
+                continue;
             }
 
-            if (entry.componentAsyncUpdate && entry.isActive())
+            for (UpdatableComponentsGroup& group : worldComponents.groups)
             {
-                if (!entry.asyncUpdateTask || entry.asyncUpdateTask.isReady())
+                if (!group.parallelUpdate)
                 {
-                    // TODO:
-                    // Most likely, using 'dt' in this case is incorrect and a time interval between the previous and current updateComponentAsync calls is required.
-                    entry.asyncUpdateTask = entry.componentAsyncUpdate->updateComponentAsync(dt);
+                    continue;
+                }
+
+                for (UpdatableComponentEntry& entry : group.entries)
+                {
+                    if (entry.isActive())
+                    {
+                        m_parallelUpdates.push_back(entry.componentUpdate);
+                    }
                 }
             }
         }
+
+        if (m_parallelUpdates.empty())
+        {
+            return;
+        }
+
+        // Each chunk mostly calls the same updateComponent implementation.
+        constexpr size_t ChunkSize = 64;
+
+        async::Executor::Ptr executor = m_parallelUpdateEnabled ? async::Executor::getDefault() : nullptr;
+        async::ParallelFor parallelUpdate{executor.get(), (m_parallelUpdates.size() + ChunkSize - 1) / ChunkSize};
+
+        m_insideParallelUpdate = true;
+        parallelUpdate.run([this, dt](size_t chunk, size_t)
+        {
+            const size_t end = std::min((chunk + 1) * ChunkSize, m_parallelUpdates.size());
+            for (size_t i = chunk * ChunkSize; i < end; ++i)
+            {
+                m_parallelUpdates[i]->updateComponent(dt);
+            }
+        }, m_parallelUpdateCompleted);
+        m_insideParallelUpdate = false;
+    }
+
+    bool SceneManagerImpl::isInsideUpdate() const
+    {
+        return m_insideUpdate;
+    }
+
+    void SceneManagerImpl::enqueueTransformUpdate(SceneComponent& component)
+    {
+        NAU_ASSERT(m_insideUpdate);
+        NAU_ASSERT(!m_insideParallelUpdate, "Transform of the component ({}) can not be changed by the parallel update (see ComponentParallelUpdateAttrib)", toString(component.getUid()));
+        NAU_ASSERT(component.m_transformUpdateIndex == SceneComponent::NoTransformUpdate);
+
+        component.m_transformUpdateIndex = m_transformUpdates.size();
+        m_transformUpdates.push_back(&component);
+    }
+
+    void SceneManagerImpl::cancelTransformUpdate(SceneComponent& component)
+    {
+        if (component.m_transformUpdateIndex == SceneComponent::NoTransformUpdate)
+        {
+            return;
+        }
+
+        NAU_FATAL(component.m_transformUpdateIndex < m_transformUpdates.size());
+        NAU_FATAL(m_transformUpdates[component.m_transformUpdateIndex] == &component);
+
+        m_transformUpdates[component.m_transformUpdateIndex] = nullptr;
+        component.m_transformUpdateIndex = SceneComponent::NoTransformUpdate;
+    }
+
+    void SceneManagerImpl::updateWorldTransforms()
+    {
+        // The queue is not modified by the notifications below: the scene update is already finished, so the changes are notified immediately.
+        eastl::swap(m_transformUpdates, m_transformUpdatesInProgress);
+        Vector<SceneComponent*>& components = m_transformUpdatesInProgress;
+
+        components.erase(eastl::remove(components.begin(), components.end(), nullptr), components.end());
+        if (components.empty())
+        {
+            return;
+        }
+
+        // Parents are always placed before their children, so the world transforms can be calculated in a single linear pass.
+        eastl::stable_sort(components.begin(), components.end(), [](const SceneComponent* left, const SceneComponent* right)
+        {
+            return left->m_transformDepth < right->m_transformDepth;
+        });
+
+        for (SceneComponent* const component : components)
+        {
+            component->m_transformUpdateIndex = SceneComponent::NoTransformUpdate;
+
+            // World transform that was set directly (SceneComponent::setWorldTransform) is kept.
+            if (!component->m_worldTransformCache)
+            {
+                const SceneComponent* const parent = component->m_transformParent;
+                component->m_worldTransformCache = parent ? parent->getWorldTransform() * component->m_transform : component->m_transform;
+            }
+        }
+
+        // Notifications are sent only when all world transforms are up to date.
+        for (SceneComponent* const component : components)
+        {
+            if (component->getActivationState() == ActivationState::Active)
+            {
+                component->notifyTransformChanged();
+            }
+        }
+
+        components.clear();
     }
 
     Component* SceneManagerImpl::findComponent(Uid componentUid)
@@ -827,7 +1081,7 @@ namespace nau::scene
             NAU_ASSERT(m_scenes.empty());
             NAU_ASSERT(m_activeObjects.empty());
             NAU_ASSERT(m_activeComponents.empty());
-            NAU_ASSERT(m_updatableComponents.empty());
+            NAU_ASSERT(m_updatableComponentHandles.empty());
             NAU_ASSERT(m_asyncTasks.isEmpty());
         };
 #endif
@@ -10,6 +10,7 @@
 #include "nau/scene/scene_manager.h"
 #include "nau/scene/scene_object.h"
 #include "nau/memory/eastl_aliases.h"
+#include "nau/threading/event.h"
 #include "scene_impl.h"
 #include "world_impl.h"
 
@@ -58,12 +59,18 @@ namespace nau::scene
 
         void update(float dt) override;
 
+        void setParallelUpdateEnabled(bool enabled) override;
+
         Component* findComponent(Uid componentId) override;
 
         async::Task<> shutdown() override;
 
         void notifyListenerComponentWasChanged(const Component& component);
 
+        bool isInsideUpdate() const;
+
+        void enqueueTransformUpdate(SceneComponent& component);
+
     private:
         struct UpdatableComponentEntry
         {
@@ -77,10 +84,47 @@ namespace nau::scene
             UpdatableComponentEntry& operator=(UpdatableComponentEntry&&) = default;
             bool isActive() const
             {
-                return component->getActivationState() == ActivationState::Active;
+                return component && component->getActivationState() == ActivationState::Active;
+            }
+        };
+
+        /**
+            Updatable components of the same type within the same world, in their activation order.
+            Removed entry is left empty (component == nullptr) to keep the order and the indices of the other entries (see m_updatableComponentHandles):
+            the empty entries are compacted prior the next update.
+         */
+        struct UpdatableComponentsGroup
+        {
+            size_t componentType = 0;
+            bool parallelUpdate = false;
+            Vector<UpdatableComponentEntry> entries;
+        };
+
+        /**
+            All updatable components of the single world: the whole world can be skipped at once (i.e. when its simulation is paused).
+            Groups are never removed, so the group index remains valid while the world's storage exists.
+         */
+        struct WorldUpdatableComponents
+        {
+            IWorld::WeakRef world;
+            Vector<UpdatableComponentsGroup> groups;
+            eastl::unordered_map<size_t, size_t> groupIndices;
+            size_t componentsCount = 0;
+            bool hasRemovedEntries = false;
+
+            WorldUpdatableComponents(IWorld& inWorld) :
+                world(&inWorld)
+            {
             }
         };
 
+        struct UpdatableComponentHandle
+        {
+            WorldUpdatableComponents* worldComponents = nullptr;
+            size_t groupIndex = 0;
+            size_t entryIndex = 0;
+        };
+
         struct SceneEntry
         {
             ObjectUniquePtr<SceneImpl> scene;
@@ -110,13 +154,37 @@ namespace nau::scene
 
         ObjectWeakRef<> lookupSceneObject(const SceneQuery& query);
 
+        WorldUpdatableComponents& getWorldUpdatableComponents(IWorld& world);
+
+        void addUpdatableComponent(Component& component);
+
+        void removeUpdatableComponent(Component& component);
+
+        void compactUpdatableComponents();
+
+        void updateComponentsParallel(float dt);
+
+        void cancelTransformUpdate(SceneComponent& component);
+
+        void updateWorldTransforms();
+
         eastl::list<ObjectUniquePtr<WorldImpl>> m_worlds;
         eastl::list<SceneEntry> m_scenes;
-        eastl::list<UpdatableComponentEntry> m_updatableComponents;
+        eastl::list<WorldUpdatableComponents> m_updatableComponents;
+        eastl::unordered_map<const Component*, UpdatableComponentHandle> m_updatableComponentHandles;
         eastl::unordered_map<Uid, SceneObject*> m_activeObjects;
     eastl::unordered_map<Uid, Component*> m_activeComponents;
 
         bool m_insideUpdate = false;
+        bool m_parallelUpdateEnabled = true;
+        bool m_insideParallelUpdate = false;
+        Vector<IComponentUpdate*> m_parallelUpdates;
+        threading::Event m_parallelUpdateCompleted;
+
+        // Active scene components whose world transforms have been invalidated within the current update (see SceneComponent::invalidateWorldTransform).
+        // Removed (deactivated) components are replaced with nullptr (see SceneComponent::m_transformUpdateIndex).
+        Vector<SceneComponent*> m_transformUpdates;
+        Vector<SceneComponent*> m_transformUpdatesInProgress;
         async::TaskCollection m_asyncTasks;
         WorkQueue::Ptr m_updateWorkQueue = WorkQueue::create();
         WorkQueue::Ptr m_postUpdateWorkQueue = WorkQueue::create();
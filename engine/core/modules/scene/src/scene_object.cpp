@@ -230,7 +230,7 @@ namespace nau::scene
             }
             else
             {
-                m_rootComponent->notifyTransformChanged();
+                m_rootComponent->invalidateWorldTransform();
             }
         };
 
@@ -4,13 +4,22 @@
 
 #include "scene_test_components.h"
 
+#include <atomic>
+
 namespace nau::scene_test
 {
     NAU_IMPLEMENT_DYNAMIC_OBJECT(MyDefaultSceneComponent)
+    NAU_IMPLEMENT_DYNAMIC_OBJECT(MyParallelUpdateComponent)
     NAU_IMPLEMENT_DYNAMIC_OBJECT(MyDisposableComponent)
     NAU_IMPLEMENT_DYNAMIC_OBJECT(MyComponentWithAsyncUpdate)
     NAU_IMPLEMENT_DYNAMIC_OBJECT(MyCustomUpdateAction)
 
+    size_t takeUpdateSequence()
+    {
+        static std::atomic<size_t> updateSequence = 0;
+        return ++updateSequence;
+    }
+
     WithDestructor::~WithDestructor()
     {
         if (m_onDestructorCallback)
@@ -103,9 +112,31 @@ namespace nau::scene_test
         m_deactivateWasCalled = true;
     }
 
+    size_t MyDefaultSceneComponent::getLastUpdateSequence() const
+    {
+        return m_lastUpdateSequence;
+    }
+
     void MyDefaultSceneComponent::updateComponent([[maybe_unused]] float dt)
     {
         ++m_updateCounter;
+        m_lastUpdateSequence = takeUpdateSequence();
+    }
+
+    size_t MyParallelUpdateComponent::getUpdateCounter() const
+    {
+        return m_updateCounter;
+    }
+
+    size_t MyParallelUpdateComponent::getLastUpdateSequence() const
+    {
+        return m_lastUpdateSequence;
+    }
+
+    void MyParallelUpdateComponent::updateComponent([[maybe_unused]] float dt)
+    {
+        ++m_updateCounter;
+        m_lastUpdateSequence = takeUpdateSequence();
     }
 
     void MyDisposableComponent::setOnDeactivated(Functor<void()> callback)
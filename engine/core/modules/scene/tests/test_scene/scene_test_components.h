@@ -4,11 +4,17 @@
 
 #pragma once
 #include "nau/runtime/disposable.h"
+#include "nau/scene/components/component_attributes.h"
 #include "nau/scene/components/component_life_cycle.h"
 #include "nau/scene/components/scene_component.h"
 
 namespace nau::scene_test
 {
+    /**
+        Global update counter: the test components remember its value at their last update to check the update order.
+     */
+    size_t takeUpdateSequence();
+
     /**
      */
     class WithDestructor : public virtual IDisposable
@@ -61,6 +67,8 @@ namespace nau::scene_test
 
         size_t getUpdateCounter() const;
 
+        size_t getLastUpdateSequence() const;
+
     private:
         void onComponentActivated() override;
 
@@ -79,6 +87,30 @@ namespace nau::scene_test
         bool m_activationIsBlocked = false;
         bool m_deletionIsBlocked = false;
         size_t m_updateCounter = 0;
+        size_t m_lastUpdateSequence = 0;
+    };
+
+    /**
+     */
+    class MyParallelUpdateComponent final : public scene::SceneComponent,
+                                            public scene::IComponentUpdate
+    {
+        NAU_OBJECT(MyParallelUpdateComponent, scene::SceneComponent, scene::IComponentUpdate)
+        NAU_DECLARE_DYNAMIC_OBJECT
+
+        NAU_CLASS_ATTRIBUTES(
+            CLASS_ATTRIBUTE(scene::ComponentParallelUpdateAttrib, true))
+
+    public:
+        size_t getUpdateCounter() const;
+
+        size_t getLastUpdateSequence() const;
+
+    private:
+        void updateComponent(float dt) override;
+
+        size_t m_updateCounter = 0;
+        size_t m_lastUpdateSequence = 0;
     };
 
     /**
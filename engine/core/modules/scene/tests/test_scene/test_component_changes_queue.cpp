@@ -0,0 +1,96 @@
+// Copyright 2024 N-GINN LLC. All rights reserved.
+// Use of this source code is governed by a BSD-3 Clause license that can be found in the LICENSE file.
+
+
+#include "nau/scene/components/component_changes_queue.h"
+#include "scene_test_base.h"
+
+namespace nau::test
+{
+    /**
+     */
+    class TestComponentChangesQueue : public SceneTestBase
+    {
+    };
+
+    /**
+        Test: the changed component is enqueued only once until the queue is consumed.
+     */
+    TEST_F(TestComponentChangesQueue, EnqueueOnce)
+    {
+        using namespace nau::math;
+        using namespace nau::scene;
+
+        ComponentChangesQueue queue;
+        Vector<Component*> changedComponents;
+
+        SceneObject::Ptr object = createObject();
+        SceneComponent& component = object->getRootComponent();
+        component.setChangesQueue(&queue);
+
+        object->setTranslation({1, 1, 1});
+        object->setRotation(quat::rotationX(1.f));
+        component.notifyStateChanged();
+
+        queue.takeChangedComponents(changedComponents);
+        ASSERT_EQ(changedComponents.size(), 1u);
+        ASSERT_EQ(changedComponents.front(), &component);
+        ASSERT_TRUE(queue.isEmpty());
+
+        object->setScale({2, 2, 2});
+        queue.takeChangedComponents(changedComponents);
+        ASSERT_EQ(changedComponents.size(), 1u);
+
+        queue.takeChangedComponents(changedComponents);
+        ASSERT_TRUE(changedComponents.empty());
+
+        component.setChangesQueue(nullptr);
+    }
+
+    /**
+        Test: the component changes are propagated to the queue from the transform parent.
+     */
+    TEST_F(TestComponentChangesQueue, EnqueueFromParent)
+    {
+        using namespace nau::scene;
+
+        ComponentChangesQueue queue;
+        Vector<Component*> changedComponents;
+
+        SceneObject::Ptr object = createObject();
+        ObjectWeakRef child = object->attachChild(createObject());
+        child->getRootComponent().setChangesQueue(&queue);
+
+        object->setTranslation({1, 1, 1});
+
+        queue.takeChangedComponents(changedComponents);
+        ASSERT_EQ(changedComponents.size(), 1u);
+        ASSERT_EQ(changedComponents.front(), &child->getRootComponent());
+
+        child->getRootComponent().setChangesQueue(nullptr);
+    }
+
+    /**
+        Test: the unbound and the destroyed components are removed from the queue.
+     */
+    TEST_F(TestComponentChangesQueue, RemoveUnboundAndDestroyed)
+    {
+        using namespace nau::scene;
+
+        ComponentChangesQueue queue;
+
+        SceneObject::Ptr object1 = createObject();
+        object1->getRootComponent().setChangesQueue(&queue);
+        object1->setTranslation({1, 1, 1});
+
+        SceneObject::Ptr object2 = createObject();
+        object2->getRootComponent().setChangesQueue(&queue);
+        object2->setTranslation({1, 1, 1});
+
+        object1->getRootComponent().setChangesQueue(nullptr);
+        object1->setTranslation({2, 2, 2});
+        object2.reset();
+
+        ASSERT_TRUE(queue.isEmpty());
+    }
+}  // namespace nau::test
@@ -250,4 +250,105 @@ namespace nau::test
         ASSERT_FALSE(child2->getWorldTransform().similar(child2InitialWorldTransform));
     }
 
+    /**
+        TEST:
+            Change the transform of the active object multiple times from within the scene update.
+            Check that the world transforms of the children are always actual,
+            but the change notifications (from the parent) are delivered only once at the end of the update.
+     */
+    TEST_F(TestSceneTransform, ActiveObjectDeferredChangeNotification)
+    {
+        using namespace testing;
+        using namespace nau::async;
+        using namespace nau::math;
+        using namespace nau::scene;
+
+        const AssertionResult testResult = runTestApp([&]() -> Task<AssertionResult>
+        {
+            IScene::Ptr scene = createEmptyScene();
+            ObjectWeakRef parent = scene->getRoot().attachChild(createObject());
+            ObjectWeakRef child1 = parent->attachChild(createObject());
+            ObjectWeakRef child2 = child1->attachChild(createObject());
+            child2->setTranslation({0, 1, 0});
+            ObjectWeakRef updateAction = scene->getRoot().attachChild(createObject<scene_test::MyCustomUpdateAction>());
+
+            co_await getSceneManager().activateScene(std::move(scene));
+            co_await skipFrames(1);
+
+            size_t changesCount = 0;
+            auto subscription = child2->getRootComponent().subscribeOnChanges([&changesCount](const RuntimeValue&, std::string_view)
+            {
+                ++changesCount;
+            });
+
+            bool worldTransformsAreActual = true;
+            size_t changesCountWithinUpdate = 0;
+
+            updateAction->getRootComponent<scene_test::MyCustomUpdateAction>().setUpdateAsyncCallback([&](SceneObject&) -> Task<>
+            {
+                for (float offset = 1.f; offset <= 3.f; offset += 1.f)
+                {
+                    parent->setTranslation({offset, 0, 0});
+                    worldTransformsAreActual = worldTransformsAreActual && child2->getWorldTransform().getTranslation().similar(vec3{offset, 1, 0});
+                }
+
+                child1->setWorldTransform(Transform{quat::identity(), {0, 0, 5}});
+                worldTransformsAreActual = worldTransformsAreActual && child2->getWorldTransform().getTranslation().similar(vec3{0, 1, 5});
+                changesCountWithinUpdate = changesCount;
+
+                return makeResolvedTask();
+            });
+
+            co_await skipFrames(2);
+            ASSERT_ASYNC(worldTransformsAreActual);
+            ASSERT_ASYNC(changesCountWithinUpdate == 0);
+            ASSERT_ASYNC(changesCount == 1);
+            ASSERT_ASYNC(child2->getWorldTransform().getTranslation().similar(vec3{0, 1, 5}));
+
+            co_return AssertionSuccess();
+        });
+
+        ASSERT_TRUE(testResult);
+    }
+
+    /**
+        TEST:
+            Change the transform of the active object outside of the scene update (as the post update writers do).
+            Check that the change notifications are delivered immediately.
+     */
+    TEST_F(TestSceneTransform, ActiveObjectChangeNotificationOutsideOfUpdate)
+    {
+        using namespace testing;
+        using namespace nau::async;
+        using namespace nau::math;
+        using namespace nau::scene;
+
+        const AssertionResult testResult = runTestApp([&]() -> Task<AssertionResult>
+        {
+            IScene::Ptr scene = createEmptyScene();
+            ObjectWeakRef parent = scene->getRoot().attachChild(createObject());
+            ObjectWeakRef child = parent->attachChild(createObject());
+            child->setTranslation({0, 1, 0});
+
+            co_await getSceneManager().activateScene(std::move(scene));
+            co_await skipFrames(1);
+
+            size_t changesCount = 0;
+            auto subscription = child->getRootComponent().subscribeOnChanges([&changesCount](const RuntimeValue&, std::string_view)
+            {
+                ++changesCount;
+            });
+
+            parent->setTranslation({1, 0, 0});
+            ASSERT_ASYNC(changesCount == 1);
+            ASSERT_ASYNC(child->getWorldTransform().getTranslation().similar(vec3{1, 1, 0}));
+
+            co_await skipFrames(1);
+            ASSERT_ASYNC(changesCount == 1);
+
+            co_return AssertionSuccess();
+        });
+
+        ASSERT_TRUE(testResult);
+    }
 }  // namespace nau::test
@@ -4,6 +4,7 @@
 
 #include "nau/scene/components/component_life_cycle.h"
 #include "nau/scene/scene_processor.h"
+#include "nau/scene/world.h"
 #include "scene_test_base.h"
 #include "scene_test_components.h"
 
@@ -47,6 +48,58 @@ namespace nau::test
         ASSERT_TRUE(testResult);
     }
 
+    /**
+        Test:
+            - scene with a lot of components marked with ComponentParallelUpdateAttrib is activated
+              (enough to be split across the multiple update chunks)
+            - wait some frames
+            - check that every parallel updatable component (and regular component) is updated exactly once per frame
+            - check that the parallel updatable components are updated before the regular one, regardless of the activation order
+     */
+    TEST_F(TestSceneUpdate, ComponentParallelUpdate)
+    {
+        using namespace testing;
+        using namespace nau::async;
+        using namespace nau::scene;
+
+        const AssertionResult testResult = runTestApp([&]() -> Task<AssertionResult>
+        {
+            constexpr unsigned FrameCount = 3;
+            constexpr size_t ObjectsCount = 500;
+
+            IScene::Ptr scene = createEmptyScene();
+            // The regular component is activated first, but must be updated after all the parallel ones.
+            auto& regularObject = scene->getRoot().attachChild(createObject<scene_test::MyDefaultSceneComponent>());
+            for (size_t i = 0; i < ObjectsCount; ++i)
+            {
+                scene->getRoot().attachChild(createObject<scene_test::MyParallelUpdateComponent>());
+            }
+
+            co_await getSceneManager().activateScene(std::move(scene));
+            co_await skipFrames(FrameCount);
+
+            const auto& regularComponent = regularObject.getRootComponent<scene_test::MyDefaultSceneComponent>();
+            ASSERT_ASYNC(regularComponent.getUpdateCounter() == FrameCount);
+
+            size_t parallelComponentsCount = 0;
+            for (SceneObject* const child : regularObject.getParentObject()->getDirectChildObjects())
+            {
+                if (auto* const component = child->getRootComponent().as<scene_test::MyParallelUpdateComponent*>())
+                {
+                    ++parallelComponentsCount;
+                    ASSERT_ASYNC(component->getUpdateCounter() == FrameCount);
+                    ASSERT_ASYNC(component->getLastUpdateSequence() < regularComponent.getLastUpdateSequence());
+                }
+            }
+
+            ASSERT_ASYNC(parallelComponentsCount == ObjectsCount);
+
+            co_return AssertionSuccess();
+        });
+
+        ASSERT_TRUE(testResult);
+    }
+
     /**
         Test:
             - scene is activated
@@ -354,4 +407,115 @@ namespace nau::test
         ASSERT_TRUE(testResult);
     }
 
+    /**
+        Test:
+            - components of the same type are activated, then some of them are destroyed
+            - check that the rest are still updated in their activation order
+     */
+    TEST_F(TestSceneUpdate, UpdateOrderOfSameTypeComponents)
+    {
+        using namespace testing;
+        using namespace nau::async;
+        using namespace nau::scene;
+
+        const AssertionResult testResult = runTestApp([&]() -> Task<AssertionResult>
+        {
+            constexpr size_t ObjectsCount = 8;
+
+            IScene::Ptr scene = createEmptyScene();
+            eastl::vector<ObjectWeakRef<SceneObject>> objects;
+            for (size_t i = 0; i < ObjectsCount; ++i)
+            {
+                objects.emplace_back(scene->getRoot().attachChild(createObject<scene_test::MyDefaultSceneComponent>()));
+            }
+
+            co_await getSceneManager().activateScene(std::move(scene));
+            co_await skipFrames(1);
+
+            objects[1]->destroy();
+            objects[4]->destroy();
+            co_await skipFrames(2);
+
+            size_t prevUpdateSequence = 0;
+            for (size_t i = 0; i < ObjectsCount; ++i)
+            {
+                if (i == 1 || i == 4)
+                {
+                    ASSERT_ASYNC(!objects[i])
+                    continue;
+                }
+
+                const size_t updateSequence = objects[i]->getRootComponent<scene_test::MyDefaultSceneComponent>().getLastUpdateSequence();
+                ASSERT_ASYNC(updateSequence > prevUpdateSequence)
+                prevUpdateSequence = updateSequence;
+            }
+
+            co_return AssertionSuccess();
+        });
+
+        ASSERT_TRUE(testResult);
+    }
+
+    /**
+        Test:
+            - components are activated within the default world and within the additional (paused) world
+            - check that components from the paused world are not updated until the world is resumed
+     */
+    TEST_F(TestSceneUpdate, PausedWorldComponentsUpdate)
+    {
+        using namespace testing;
+        using namespace nau::async;
+        using namespace nau::scene;
+
+        const AssertionResult testResult = runTestApp([&]() -> Task<AssertionResult>
+        {
+            constexpr unsigned FrameCount = 5;
+            constexpr size_t ObjectsCount = 100;
+
+            const auto createSceneWithObjects = []
+            {
+                IScene::Ptr scene = createEmptyScene();
+                for (size_t i = 0; i < ObjectsCount; ++i)
+                {
+                    scene->getRoot().attachChild(createObject<scene_test::MyDefaultSceneComponent>());
+                }
+
+                return scene;
+            };
+
+            const auto checkUpdateCounter = [](IScene& scene, size_t expectedCounter)
+            {
+                for (SceneObject* const object : scene.getRoot().getDirectChildObjects())
+                {
+                    if (object->getRootComponent<scene_test::MyDefaultSceneComponent>().getUpdateCounter() != expectedCounter)
+                    {
+                        return false;
+                    }
+                }
+
+                return true;
+            };
+
+            IWorld::WeakRef pausedWorld = getSceneManager().createWorld();
+            pausedWorld->setSimulationPause(true);
+            IScene::WeakRef pausedScene = co_await pausedWorld->addScene(createSceneWithObjects());
+            IScene::WeakRef activeScene = co_await getSceneManager().activateScene(createSceneWithObjects());
+            co_await skipFrames(FrameCount);
+
+            ASSERT_ASYNC(checkUpdateCounter(*pausedScene, 0))
+            ASSERT_ASYNC(checkUpdateCounter(*activeScene, FrameCount))
+
+            pausedWorld->setSimulationPause(false);
+            co_await skipFrames(FrameCount);
+
+            ASSERT_ASYNC(checkUpdateCounter(*pausedScene, FrameCount))
+            ASSERT_ASYNC(checkUpdateCounter(*activeScene, FrameCount * 2))
+
+            getSceneManager().destroyWorld(pausedWorld);
+
+            co_return AssertionSuccess();
+        });
+
+        ASSERT_TRUE(testResult);
+    }
 }  // namespace nau::test